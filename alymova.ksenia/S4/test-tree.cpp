@@ -1,6 +1,34 @@
 #include <boost/test/unit_test.hpp>
+#include <map>
+#include <random>
 #include <tree/tree-2-3.hpp>
 
+namespace
+{
+  using LookupTree = alymova::TwoThreeTree< int, int, std::less< int > >;
+  using LookupMap = std::map< int, int >;
+
+  template< class It, class MapIt >
+  bool same_position(It it, It end, const LookupMap& map, MapIt map_it)
+  {
+    if (map_it == map.end())
+    {
+      return it == end;
+    }
+    return it != end && it->first == map_it->first && it->second == map_it->second;
+  }
+
+  bool same_lookup(LookupTree& tree, const LookupMap& map, int key)
+  {
+    const LookupTree& ctree = tree;
+    return same_position(tree.find(key), tree.end(), map, map.find(key))
+      && same_position(ctree.find(key), ctree.end(), map, map.find(key))
+      && same_position(tree.lower_bound(key), tree.end(), map, map.lower_bound(key))
+      && same_position(tree.upper_bound(key), tree.end(), map, map.upper_bound(key))
+      && tree.count(key) == map.count(key);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(test_constructors_operators)
 {
   using Tree = alymova::TwoThreeTree< size_t, std::string, std::less< size_t > >;
@@ -448,3 +476,52 @@ BOOST_AUTO_TEST_CASE(test_erase)
   BOOST_TEST(tree.size() == 0);
   BOOST_TEST((it == tree.end()));
 }
+
+BOOST_AUTO_TEST_CASE(test_lookup_node_boundaries)
+{
+  for (int n = 1; n <= 12; n++)
+  {
+    LookupTree tree;
+    LookupMap map;
+    for (int i = 1; i <= n; i++)
+    {
+      tree.emplace(2 * i, i);
+      map.emplace(2 * i, i);
+    }
+    for (int key = 0; key <= 2 * n + 1; key++)
+    {
+      BOOST_TEST(same_lookup(tree, map, key), "size " << n << ", key " << key);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_lookup_random)
+{
+  std::mt19937 gen(45);
+  std::uniform_int_distribution< int > keys(0, 300);
+  LookupTree tree;
+  LookupMap map;
+  for (size_t step = 0; step < 3000; step++)
+  {
+    int key = keys(gen);
+    if (gen() % 3 == 0)
+    {
+      BOOST_TEST(tree.erase(key) == map.erase(key));
+    }
+    else
+    {
+      tree.emplace(key, step);
+      map.emplace(key, step);
+    }
+    BOOST_TEST(tree.size() == map.size());
+    for (int i = 0; i < 4; i++)
+    {
+      int probe = keys(gen);
+      BOOST_TEST(same_lookup(tree, map, probe), "step " << step << ", key " << probe);
+    }
+  }
+  for (int key = -1; key <= 301; key++)
+  {
+    BOOST_TEST(same_lookup(tree, map, key), "key " << key);
+  }
+}
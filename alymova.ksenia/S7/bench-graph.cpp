@@ -0,0 +1,180 @@
+#define BENCH_MAIN
+#include <harness.hpp>
+#include <random>
+#include <string>
+#include <vector>
+#include "graph.hpp"
+
+namespace
+{
+  struct Edge
+  {
+    size_t from;
+    size_t to;
+    size_t weight;
+  };
+
+  struct Workload
+  {
+    std::vector< std::string > names;
+    std::vector< Edge > edges;
+    std::vector< size_t > queries;
+    alymova::Graph graph;
+  };
+
+  constexpr size_t vertexCount = 100000;
+  constexpr size_t edgeCount = 200000;
+  constexpr size_t queryCount = 100000;
+
+  const Workload& workload()
+  {
+    static const Workload result = []()
+    {
+      Workload data;
+      std::mt19937 gen(45);
+      for (size_t i = 0; i < vertexCount; i++)
+      {
+        data.names.push_back("vertex" + std::to_string(gen() % (vertexCount * 10)) + '_' + std::to_string(i));
+        data.graph.addVertex(data.names.back());
+      }
+      std::uniform_int_distribution< size_t > pick(0, vertexCount - 1);
+      for (size_t i = 0; i < edgeCount; i++)
+      {
+        data.edges.push_back({pick(gen), pick(gen), gen() % 100});
+      }
+      for (size_t i = 0; i < queryCount; i++)
+      {
+        data.queries.push_back(pick(gen));
+      }
+      for (const Edge& edge: data.edges)
+      {
+        data.graph.addEdge(data.names[edge.from], data.names[edge.to], edge.weight);
+      }
+      return data;
+    }();
+    return result;
+  }
+
+  alymova::Graph queryPart()
+  {
+    alymova::Graph part;
+    for (size_t i = 0; i < queryCount / 10; i++)
+    {
+      part.addVertex(workload().names[workload().queries[i]]);
+    }
+    return part;
+  }
+}
+
+BENCH_CASE(graph_add_vertex)
+{
+  state.setItems(vertexCount);
+  state.run([]()
+  {
+    alymova::Graph graph;
+    for (const std::string& name: workload().names)
+    {
+      graph.addVertex(name);
+    }
+    bench::doNotOptimize(graph);
+  });
+}
+
+BENCH_CASE(graph_add_edge)
+{
+  state.setItems(edgeCount);
+  state.run([]()
+  {
+    alymova::Graph graph;
+    for (const Edge& edge: workload().edges)
+    {
+      graph.addEdge(workload().names[edge.from], workload().names[edge.to], edge.weight);
+    }
+    bench::doNotOptimize(graph);
+  });
+}
+
+BENCH_CASE(graph_has_vertex)
+{
+  state.setItems(queryCount);
+  state.run([]()
+  {
+    size_t found = 0;
+    for (size_t query: workload().queries)
+    {
+      found += workload().graph.hasVertex(workload().names[query]);
+    }
+    bench::doNotOptimize(found);
+  });
+}
+
+BENCH_CASE(graph_outbound)
+{
+  state.setItems(queryCount);
+  state.run([]()
+  {
+    size_t bound = 0;
+    for (size_t query: workload().queries)
+    {
+      bound += workload().graph.getOutbound(workload().names[query]).size();
+    }
+    bench::doNotOptimize(bound);
+  });
+}
+
+BENCH_CASE(graph_inbound)
+{
+  state.setItems(queryCount);
+  state.run([]()
+  {
+    size_t bound = 0;
+    for (size_t query: workload().queries)
+    {
+      bound += workload().graph.getInbound(workload().names[query]).size();
+    }
+    bench::doNotOptimize(bound);
+  });
+}
+
+BENCH_CASE(graph_extract)
+{
+  state.setItems(queryCount / 10);
+  state.run([]()
+  {
+    alymova::Graph part = queryPart();
+    part.extractEdges(workload().graph);
+    bench::doNotOptimize(part);
+  });
+}
+
+BENCH_CASE(graph_merge)
+{
+  state.setItems(edgeCount);
+  state.run([]()
+  {
+    alymova::Graph graph;
+    graph.merge(workload().graph);
+    bench::doNotOptimize(graph);
+  });
+}
+
+BENCH_CASE(graph_cut_and_readd_edge)
+{
+  alymova::Graph graph = workload().graph;
+  state.setItems(queryCount);
+  state.run([&graph]()
+  {
+    const Workload& data = workload();
+    for (size_t i = 0; i < queryCount; i++)
+    {
+      const Edge& edge = data.edges[i];
+      graph.cutEdge(data.names[edge.from], data.names[edge.to], edge.weight);
+    }
+    for (size_t i = 0; i < queryCount; i++)
+    {
+      const Edge& edge = data.edges[i];
+      graph.addEdge(data.names[edge.from], data.names[edge.to], edge.weight);
+    }
+    bench::doNotOptimize(graph);
+  });
+}
@@ -0,0 +1,220 @@
+#include <boost/container_hash/hash.hpp>
+#include <harness.hpp>
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "hash-functions.hpp"
+#include "hash-table.hpp"
+
+namespace
+{
+  using Edge = std::pair< std::string, std::string >;
+
+  struct CombinedSipHasher
+  {
+    size_t operator()(const Edge& edge) const
+    {
+      size_t hash = alymova::Hasher< std::string, alymova::SipHashPolicy >{}(edge.first);
+      boost::hash_combine(hash, edge.second);
+      return hash;
+    }
+  };
+
+  std::vector< Edge > makeEdges(size_t vertexes, size_t edges, std::mt19937& gen)
+  {
+    std::vector< std::string > names;
+    std::uniform_int_distribution< size_t > length(3, 12);
+    std::uniform_int_distribution< int > letter('a', 'z');
+    for (size_t i = 0; i < vertexes; i++)
+    {
+      std::string name(length(gen), 'a');
+      for (size_t j = 0; j < name.size(); j++)
+      {
+        name[j] = static_cast< char >(letter(gen));
+      }
+      names.push_back(name + std::to_string(i));
+    }
+    std::uniform_int_distribution< size_t > pick(0, vertexes - 1);
+    std::vector< Edge > result;
+    for (size_t i = 0; i < edges; i++)
+    {
+      result.emplace_back(names[pick(gen)], names[pick(gen)]);
+    }
+    return result;
+  }
+
+  size_t nextPrime(size_t value)
+  {
+    for (;; value++)
+    {
+      bool prime = value > 1;
+      for (size_t d = 2; d * d <= value && prime; d++)
+      {
+        prime = value % d != 0;
+      }
+      if (prime)
+      {
+        return value;
+      }
+    }
+  }
+
+  const std::vector< Edge >& workload()
+  {
+    static const std::vector< Edge > edges = []()
+    {
+      std::mt19937 gen(44);
+      return makeEdges(20000, 200000, gen);
+    }();
+    return edges;
+  }
+
+  size_t workloadBytes()
+  {
+    size_t bytes = 0;
+    for (const Edge& edge: workload())
+    {
+      bytes += edge.first.size() + edge.second.size();
+    }
+    return bytes;
+  }
+
+  template< class Hash >
+  void reportQuality(const char* name)
+  {
+    const std::vector< Edge >& edges = workload();
+    Hash hasher;
+    size_t capacity = nextPrime(static_cast< size_t >(edges.size() / 0.7));
+    std::vector< size_t > buckets(capacity);
+    std::vector< bool > used(capacity);
+    size_t totalProbe = 0;
+    size_t maxProbe = 0;
+    for (size_t i = 0; i < edges.size(); i++)
+    {
+      size_t home = hasher(edges[i]) % capacity;
+      buckets[home]++;
+      size_t probe = 0;
+      while (used[(home + probe) % capacity])
+      {
+        probe++;
+      }
+      used[(home + probe) % capacity] = true;
+      totalProbe += probe;
+      maxProbe = std::max(maxProbe, probe);
+    }
+    double expected = static_cast< double >(edges.size()) / capacity;
+    double chiSquared = 0;
+    size_t maxBucket = 0;
+    for (size_t i = 0; i < capacity; i++)
+    {
+      chiSquared += (buckets[i] - expected) * (buckets[i] - expected) / expected;
+      maxBucket = std::max(maxBucket, buckets[i]);
+    }
+    std::clog << name << ": chi2/cap " << chiSquared / capacity << ", max bucket " << maxBucket;
+    std::clog << ", avg psl " << static_cast< double >(totalProbe) / edges.size() << ", max psl " << maxProbe << '\n';
+  }
+
+  template< class Hash >
+  void benchHash(bench::State& state, const char* name)
+  {
+    reportQuality< Hash >(name);
+    state.setItems(workload().size());
+    state.setBytes(workloadBytes());
+    state.run([]()
+    {
+      Hash hasher;
+      size_t checksum = 0;
+      for (const Edge& edge: workload())
+      {
+        checksum += hasher(edge);
+      }
+      bench::doNotOptimize(checksum);
+    });
+  }
+
+  template< class Hash >
+  void benchInsert(bench::State& state)
+  {
+    state.setItems(workload().size());
+    state.run([]()
+    {
+      alymova::HashTable< Edge, size_t, Hash > table;
+      for (size_t i = 0; i < workload().size(); i++)
+      {
+        table.insert(std::make_pair(workload()[i], i));
+      }
+      bench::doNotOptimize(table);
+    });
+  }
+
+  template< class Hash >
+  void benchFind(bench::State& state)
+  {
+    alymova::HashTable< Edge, size_t, Hash > table;
+    for (size_t i = 0; i < workload().size(); i++)
+    {
+      table.insert(std::make_pair(workload()[i], i));
+    }
+    state.setItems(workload().size());
+    state.run([&table]()
+    {
+      size_t found = 0;
+      for (const Edge& edge: workload())
+      {
+        found += table.find(edge) != table.end();
+      }
+      bench::doNotOptimize(found);
+    });
+  }
+
+  using SipStream = alymova::PairHasher< std::string, alymova::SipHashPolicy >;
+  using FastStream = alymova::PairHasher< std::string, alymova::FastHashPolicy >;
+}
+
+BENCH_CASE(hash_siphash_combine)
+{
+  benchHash< CombinedSipHasher >(state, "siphash+hash_combine");
+}
+
+BENCH_CASE(hash_siphash_stream)
+{
+  benchHash< SipStream >(state, "siphash stream");
+}
+
+BENCH_CASE(hash_fast_stream)
+{
+  benchHash< FastStream >(state, "fast stream");
+}
+
+BENCH_CASE(table_insert_siphash_combine)
+{
+  benchInsert< CombinedSipHasher >(state);
+}
+
+BENCH_CASE(table_insert_siphash_stream)
+{
+  benchInsert< SipStream >(state);
+}
+
+BENCH_CASE(table_insert_fast_stream)
+{
+  benchInsert< FastStream >(state);
+}
+
+BENCH_CASE(table_find_siphash_combine)
+{
+  benchFind< CombinedSipHasher >(state);
+}
+
+BENCH_CASE(table_find_siphash_stream)
+{
+  benchFind< SipStream >(state);
+}
+
+BENCH_CASE(table_find_fast_stream)
+{
+  benchFind< FastStream >(state);
+}
@@ -21,9 +21,7 @@ void alymova::VertexesCommand::operator()(const GraphSet& graphs)
   {
     throw std::logic_error("<INVALID COMMAND>");
   }
-  List< std::string > copy_vertexes(it_name->second.vertexes);
-  copy_vertexes.sort();
-  out << copy_vertexes;
+  out << it_name->second.getVertexes();
 }
 
 void alymova::OutboundCommand::operator()(const GraphSet& graphs)
@@ -139,13 +137,7 @@ void alymova::ExtractCommand::operator()(GraphSet& graphs)
     }
     graph_new.addVertex(vertex);
   }
-  for (auto it = it_name->second.edges.begin(); it != it_name->second.edges.end(); it++)
-  {
-    if (graph_new.hasVertex(it->first.first) && graph_new.hasVertex(it->first.second))
-    {
-      graph_new.addEdge(it->first.first, it->first.second, it->second);
-    }
-  }
+  graph_new.extractEdges(it_name->second);
   graphs.insert(std::make_pair(name_new, graph_new));
 }
 
@@ -2,62 +2,76 @@
 
 void alymova::Graph::addEdge(const std::string& vertex1, const std::string& vertex2, size_t weight)
 {
-  edges.insert(std::make_pair(std::make_pair(vertex1, vertex2), weight));
   addVertex(vertex1);
   addVertex(vertex2);
+  Edge edge(vertex1, vertex2);
+  auto it = edges.find(edge);
+  if (it != edges.end())
+  {
+    it->second.push_back(weight);
+    return;
+  }
+  edges.insert(std::make_pair(edge, List< size_t >{weight}));
+  vertexes.at(vertex1).outgoing.push_back(vertex2);
+  vertexes.at(vertex2).incoming.push_back(vertex1);
 }
 
 void alymova::Graph::cutEdge(const std::string& vertex1, const std::string& vertex2, size_t weight)
 {
-  std::pair< std::string, std::string > vertex_pair(vertex1, vertex2);
-  for (auto it = edges.begin(); it != edges.end(); it++)
+  auto it = edges.find(Edge(vertex1, vertex2));
+  if (it == edges.end())
   {
-    if (it->first == vertex_pair && it->second == weight)
-    {
-      edges.erase(it);
-      return;
-    }
+    throw std::logic_error("<INVALID COMMAND>");
+  }
+  List< size_t >& weights = it->second;
+  auto it_weight = weights.begin();
+  while (it_weight != weights.end() && *it_weight != weight)
+  {
+    it_weight++;
+  }
+  if (it_weight == weights.end())
+  {
+    throw std::logic_error("<INVALID COMMAND>");
+  }
+  weights.erase(it_weight);
+  if (weights.empty())
+  {
+    edges.erase(it);
+    vertexes.at(vertex1).outgoing.remove(vertex2);
+    vertexes.at(vertex2).incoming.remove(vertex1);
   }
-  throw std::logic_error("<INVALID COMMAND>");
 }
 
 void alymova::Graph::addVertex(const std::string& vertex)
 {
   if (!hasVertex(vertex))
   {
-    vertexes.push_back(vertex);
+    vertexes.insert(std::make_pair(vertex, Adjacency{}));
   }
 }
 
 bool alymova::Graph::hasVertex(const std::string& vertex) const
 {
-  for (auto it = vertexes.begin(); it != vertexes.end(); it++)
-  {
-    if (*it == vertex)
-    {
-      return true;
-    }
-  }
-  return false;
+  return vertexes.find(vertex) != vertexes.end();
 }
 
-void alymova::Graph::merge(const Graph& other)
+alymova::List< std::string > alymova::Graph::getVertexes() const
 {
-  for (auto it = other.edges.begin(); it != other.edges.end(); it++)
+  List< std::string > names;
+  for (auto it = vertexes.begin(); it != vertexes.end(); it++)
   {
-    addEdge(it->first.first, it->first.second, it->second);
+    names.push_back(it->first);
   }
+  return names;
 }
 
 alymova::BoundMap alymova::Graph::getOutbound(const std::string& vertex) const
 {
   BoundMap outbound;
-  for (auto it = edges.begin(); it != edges.end(); it++)
+  const List< std::string >& outgoing = vertexes.at(vertex).outgoing;
+  for (auto it = outgoing.begin(); it != outgoing.end(); it++)
   {
-    if (it->first.first == vertex)
-    {
-      outbound[it->first.second].push_back(it->second);
-    }
+    outbound[*it] = edges.at(Edge(vertex, *it));
   }
   return outbound;
 }
@@ -65,14 +79,42 @@ alymova::BoundMap alymova::Graph::getOutbound(const std::string& vertex) const
 alymova::BoundMap alymova::Graph::getInbound(const std::string& vertex) const
 {
   BoundMap inbound;
-  for (auto it = edges.begin(); it != edges.end(); it++)
+  const List< std::string >& incoming = vertexes.at(vertex).incoming;
+  for (auto it = incoming.begin(); it != incoming.end(); it++)
+  {
+    inbound[*it] = edges.at(Edge(*it, vertex));
+  }
+  return inbound;
+}
+
+void alymova::Graph::merge(const Graph& other)
+{
+  for (auto it = other.edges.begin(); it != other.edges.end(); it++)
   {
-    if (it->first.second == vertex)
+    for (auto it_weight = it->second.begin(); it_weight != it->second.end(); it_weight++)
     {
-      inbound[it->first.first].push_back(it->second);
+      addEdge(it->first.first, it->first.second, *it_weight);
+    }
+  }
+}
+
+void alymova::Graph::extractEdges(const Graph& source)
+{
+  for (auto it = vertexes.begin(); it != vertexes.end(); it++)
+  {
+    const List< std::string >& outgoing = source.vertexes.at(it->first).outgoing;
+    for (auto it_out = outgoing.begin(); it_out != outgoing.end(); it_out++)
+    {
+      if (hasVertex(*it_out))
+      {
+        const List< size_t >& weights = source.edges.at(Edge(it->first, *it_out));
+        for (auto it_weight = weights.begin(); it_weight != weights.end(); it_weight++)
+        {
+          addEdge(it->first, *it_out, *it_weight);
+        }
+      }
     }
   }
-  return inbound;
 }
 
 std::istream& alymova::operator>>(std::istream& in, Graph& graph)
@@ -104,15 +146,14 @@ std::ostream& alymova::operator<<(std::ostream& out, const Graph& graph)
   {
     return out;
   }
-  auto it = graph.edges.begin();
-  if (it != graph.edges.end())
+  bool first = true;
+  for (auto it = graph.edges.begin(); it != graph.edges.end(); it++)
   {
-    out << it->first.first << ' ' << it->first.second << ' ' << it->second;
-    it++;
-  }
-  for (; it != graph.edges.end(); it++)
-  {
-    out << '\n' << it->first.first << ' ' << it->first.second << ' ' << it->second;
+    for (auto it_weight = it->second.begin(); it_weight != it->second.end(); it_weight++)
+    {
+      out << (first ? "" : "\n") << it->first.first << ' ' << it->first.second << ' ' << *it_weight;
+      first = false;
+    }
   }
   return out;
 }
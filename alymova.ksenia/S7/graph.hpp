@@ -2,7 +2,6 @@
 #define GRAPH_HPP
 #include <iostream>
 #include <string>
-#include <unordered_map>
 #include <utility>
 #include <tree/tree-2-3.hpp>
 #include <list/list.hpp>
@@ -15,16 +14,26 @@ namespace alymova
 
   struct Graph
   {
-    HashTable< std::pair< std::string, std::string >, size_t, PairHasher< std::string > > edges;
-    List< std::string > vertexes;
+    using Edge = std::pair< std::string, std::string >;
+    struct Adjacency
+    {
+      List< std::string > outgoing;
+      List< std::string > incoming;
+    };
+    using VertexIndex = TwoThreeTree< std::string, Adjacency, std::less< std::string > >;
+
+    HashTable< Edge, List< size_t >, PairHasher< std::string > > edges;
+    VertexIndex vertexes;
 
     void addEdge(const std::string& vertex1, const std::string& vertex2, size_t weight);
     void cutEdge(const std::string& vertex1, const std::string& vertex2, size_t weight);
     void addVertex(const std::string& vertex);
     bool hasVertex(const std::string& vertex) const;
+    List< std::string > getVertexes() const;
     BoundMap getOutbound(const std::string& vertex) const;
     BoundMap getInbound(const std::string& vertex) const;
     void merge(const Graph& other);
+    void extractEdges(const Graph& source);
   };
 
   std::istream& operator>>(std::istream& in, Graph& graph);
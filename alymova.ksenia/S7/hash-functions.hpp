@@ -1,16 +1,48 @@
 #ifndef HASH_FUNCTIONS_HPP
 #define HASH_FUNCTIONS_HPP
 
-#include <boost/container_hash/hash.hpp>
 #include <boost/hash2/siphash.hpp>
 #include <boost/hash2/hash_append.hpp>
 #include <boost/hash2/get_integral_result.hpp>
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
 
 namespace alymova
 {
-  template< class T, class H = boost::hash2::siphash_64 >
+  // boost::hash2-compatible seeded hash for table keys; fast, but not collision-resistant.
+  class FastHash64
+  {
+  public:
+    using result_type = std::uint64_t;
+    static constexpr size_t block_size = 8;
+
+    FastHash64() noexcept;
+    explicit FastHash64(std::uint64_t seed) noexcept;
+    FastHash64(const void* seed, size_t n) noexcept;
+
+    void update(const void* data, size_t n) noexcept;
+    result_type result() noexcept;
+  private:
+    static constexpr std::uint64_t prime1 = 0x9e3779b185ebca87ULL;
+    static constexpr std::uint64_t prime2 = 0xc2b2ae3d27d4eb4fULL;
+    static constexpr std::uint64_t prime3 = 0x165667b19e3779f9ULL;
+
+    std::uint64_t state_;
+    std::uint64_t length_;
+    unsigned char tail_[block_size];
+
+    void mixBlock(std::uint64_t block) noexcept;
+    static std::uint64_t readBlock(const unsigned char* bytes) noexcept;
+    static std::uint64_t avalanche(std::uint64_t value) noexcept;
+  };
+
+  using SipHashPolicy = boost::hash2::siphash_64;
+  using FastHashPolicy = FastHash64;
+
+  template< class T, class H = FastHashPolicy >
   struct Hasher
   {
     size_t operator()(const T& value) const
@@ -21,16 +53,92 @@ namespace alymova
     }
   };
 
-  template< class T >
+  template< class T, class H = FastHashPolicy >
   struct PairHasher
   {
-    std::size_t operator()(const std::pair< T, T >& s) const
+    size_t operator()(const std::pair< T, T >& s) const
     {
-      size_t hash = Hasher< T >{}(s.first);
-      boost::hash_combine(hash, s.second);
-      return hash;
+      H hasher{};
+      boost::hash2::hash_append(hasher, {}, s.first);
+      boost::hash2::hash_append(hasher, {}, s.second);
+      return boost::hash2::get_integral_result< size_t >(hasher);
     }
   };
+
+  inline FastHash64::FastHash64() noexcept:
+    FastHash64(std::uint64_t(0))
+  {}
+
+  inline FastHash64::FastHash64(std::uint64_t seed) noexcept:
+    state_(seed + prime3),
+    length_(0),
+    tail_{}
+  {}
+
+  inline FastHash64::FastHash64(const void* seed, size_t n) noexcept:
+    FastHash64(std::uint64_t(0))
+  {
+    update(seed, n);
+    state_ = result();
+    length_ = 0;
+  }
+
+  inline void FastHash64::update(const void* data, size_t n) noexcept
+  {
+    const unsigned char* bytes = static_cast< const unsigned char* >(data);
+    size_t used = length_ % block_size;
+    length_ += n;
+    if (used != 0)
+    {
+      size_t take = block_size - used < n ? block_size - used : n;
+      std::memcpy(tail_ + used, bytes, take);
+      if (used + take < block_size)
+      {
+        return;
+      }
+      mixBlock(readBlock(tail_));
+      bytes += take;
+      n -= take;
+    }
+    for (; n >= block_size; bytes += block_size, n -= block_size)
+    {
+      mixBlock(readBlock(bytes));
+    }
+    std::memcpy(tail_, bytes, n);
+  }
+
+  inline FastHash64::result_type FastHash64::result() noexcept
+  {
+    unsigned char last[block_size] = {};
+    std::memcpy(last, tail_, length_ % block_size);
+    std::uint64_t value = state_ ^ (readBlock(last) * prime2) ^ (length_ * prime1);
+    state_ += prime1;
+    return avalanche(value);
+  }
+
+  inline void FastHash64::mixBlock(std::uint64_t block) noexcept
+  {
+    state_ += block * prime2;
+    state_ = (state_ << 31) | (state_ >> 33);
+    state_ *= prime1;
+  }
+
+  inline std::uint64_t FastHash64::readBlock(const unsigned char* bytes) noexcept
+  {
+    std::uint64_t block;
+    std::memcpy(&block, bytes, block_size);
+    return block;
+  }
+
+  inline std::uint64_t FastHash64::avalanche(std::uint64_t value) noexcept
+  {
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+    return value;
+  }
 }
 
 #endif
@@ -511,29 +511,20 @@ namespace alymova
   HashIterator< Key, Value, Hash, KeyEqual >
     HashTable< Key, Value, Hash, KeyEqual >::insert_node(size_t index, const Node& node)
   {
-    size_t home_index;
-    if (index < node.psl)
+    if (array_[index].first == NodeState::Empty)
     {
-      home_index = capacity_ - node.psl;
+      array_[index].first = NodeState::Fill;
+      array_[index].second = node;
+      return Iterator{array_ + index, array_ + capacity_};
     }
-    else
-    {
-      home_index = index - node.psl;
-    }
-    if (array_[home_index].first == NodeState::Empty)
-    {
-      array_[home_index].first = NodeState::Fill;
-      array_[home_index].second = node;
-      return Iterator{array_ + home_index, array_ + capacity_};
-    }
-    std::pair< size_t, T > rob_res = rob_rich(home_index, node);
-    if (rob_res.first == home_index)
+    std::pair< size_t, T > rob_res = rob_rich(index, node);
+    if (rob_res.first == index)
     {
       rehash();
     }
     if (rob_res.second.first == NodeState::Fill)
     {
-      return insert_node(rob_res.first, rob_res.second.second);
+      insert_node(rob_res.first, rob_res.second.second);
     }
     return Iterator{array_ + rob_res.first, array_ + capacity_};
   }
@@ -0,0 +1,61 @@
+#include <boost/test/unit_test.hpp>
+#include <stdexcept>
+#include "graph.hpp"
+
+BOOST_AUTO_TEST_CASE(test_graph_parallel_edges)
+{
+  using List = alymova::List< size_t >;
+
+  alymova::Graph graph;
+  graph.addEdge("a", "b", 5);
+  graph.addEdge("a", "b", 3);
+  graph.addEdge("a", "b", 5);
+  BOOST_TEST(graph.edges.size() == 1);
+  BOOST_TEST((graph.edges.at({"a", "b"}) == List{5, 3, 5}));
+  BOOST_TEST(graph.vertexes.at("a").outgoing.size() == 1);
+  BOOST_TEST(graph.vertexes.at("b").incoming.size() == 1);
+
+  graph.addEdge("c", "b", 1);
+  alymova::BoundMap inbound = graph.getInbound("b");
+  BOOST_TEST(inbound.size() == 2);
+  BOOST_TEST((inbound.at("a") == List{5, 3, 5}));
+  BOOST_TEST((inbound.at("c") == List{1}));
+  alymova::BoundMap outbound = graph.getOutbound("a");
+  BOOST_TEST(outbound.size() == 1);
+  BOOST_TEST((outbound.at("b") == List{5, 3, 5}));
+}
+
+BOOST_AUTO_TEST_CASE(test_graph_cut_parallel_edges)
+{
+  using List = alymova::List< size_t >;
+
+  alymova::Graph graph;
+  graph.addEdge("a", "b", 5);
+  graph.addEdge("a", "b", 3);
+  graph.addEdge("a", "b", 5);
+  graph.addEdge("c", "b", 1);
+
+  graph.cutEdge("a", "b", 5);
+  BOOST_TEST((graph.getInbound("b").at("a") == List{3, 5}));
+  BOOST_TEST(graph.vertexes.at("a").outgoing.size() == 1);
+
+  BOOST_CHECK_THROW(graph.cutEdge("a", "b", 7), std::logic_error);
+  BOOST_CHECK_THROW(graph.cutEdge("b", "a", 3), std::logic_error);
+  BOOST_TEST((graph.getInbound("b").at("a") == List{3, 5}));
+
+  graph.cutEdge("a", "b", 3);
+  graph.cutEdge("a", "b", 5);
+  BOOST_TEST((graph.edges.find({"a", "b"}) == graph.edges.end()));
+  BOOST_TEST(graph.hasVertex("a"));
+  BOOST_TEST(graph.vertexes.at("a").outgoing.empty());
+  alymova::BoundMap inbound = graph.getInbound("b");
+  BOOST_TEST(inbound.size() == 1);
+  BOOST_TEST((inbound.at("c") == List{1}));
+  BOOST_TEST(graph.getOutbound("a").empty());
+  BOOST_CHECK_THROW(graph.cutEdge("a", "b", 5), std::logic_error);
+
+  graph.addEdge("a", "b", 2);
+  BOOST_TEST(graph.vertexes.at("a").outgoing.size() == 1);
+  BOOST_TEST(graph.vertexes.at("b").incoming.size() == 2);
+  BOOST_TEST((graph.getInbound("b").at("a") == List{2}));
+}
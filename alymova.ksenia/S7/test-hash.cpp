@@ -1,6 +1,7 @@
 #include <boost/test/unit_test.hpp>
 #include <exception>
 #include "hash-table.hpp"
+#include "hash-functions.hpp"
 
 BOOST_AUTO_TEST_CASE(test_constructors_operators)
 {
@@ -246,3 +247,47 @@ BOOST_AUTO_TEST_CASE(test_erase)
   BOOST_TEST(table1.empty());
   BOOST_TEST((it == table1.end()));
 }
+
+BOOST_AUTO_TEST_CASE(test_find_after_displacement)
+{
+  struct ClusterHash
+  {
+    size_t operator()(int key) const
+    {
+      return key / 4;
+    }
+  };
+  alymova::HashTable< int, int, ClusterHash > table;
+  for (int i = 0; i < 500; i++)
+  {
+    int key = (i * 37) % 500;
+    auto it = table.emplace(key, i);
+    BOOST_TEST(it->first == key);
+  }
+  for (int key = 0; key < 500; key++)
+  {
+    BOOST_TEST((table.find(key) != table.end()));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_hash_policies)
+{
+  using Pair = std::pair< std::string, std::string >;
+
+  alymova::FastHash64 whole;
+  whole.update("graph-vertex", 12);
+  alymova::FastHash64 parts;
+  parts.update("gra", 3);
+  parts.update("ph-vert", 7);
+  parts.update("ex", 2);
+  BOOST_TEST(whole.result() == parts.result());
+  BOOST_TEST(alymova::FastHash64(1).result() != alymova::FastHash64(2).result());
+
+  alymova::PairHasher< std::string > fast;
+  BOOST_TEST(fast(Pair("ab", "c")) != fast(Pair("a", "bc")));
+  BOOST_TEST(fast(Pair("a", "b")) != fast(Pair("b", "a")));
+  BOOST_TEST(fast(Pair("a", "b")) == fast(Pair("a", "b")));
+
+  alymova::PairHasher< std::string, alymova::SipHashPolicy > sip;
+  BOOST_TEST(sip(Pair("ab", "c")) != sip(Pair("a", "bc")));
+}
@@ -118,6 +118,7 @@ namespace alymova
     void move_fake() const noexcept;
     void split_insert(Node* node);
     Node* find_to_insert(const Key& key) const;
+    ConstIterator find_bound(const Key& key, bool strict) const;
     Node* find_to_insert(ConstIterator hint) const noexcept;
     bool check_hint(ConstIterator hint, const Key& key) const;
     Iterator find_to_erase(Iterator pos) const noexcept;
@@ -617,11 +618,28 @@ namespace alymova
   template< class Key, class Value, class Comparator >
   TTTConstIterator< Key, Value, Comparator > TwoThreeTree< Key, Value, Comparator >::find(const Key& key) const
   {
-    for (ConstIterator it = cbegin(); it != cend(); it++)
+    Node* tmp = size_ == 0 ? nullptr : root_;
+    while (tmp && tmp->type != NodeType::Fake)
     {
-      if (!cmp_(key, it->first) && !cmp_(it->first, key))
+      if (cmp_(key, tmp->data[0].first))
+      {
+        tmp = tmp->left;
+      }
+      else if (!cmp_(tmp->data[0].first, key))
       {
-        return it;
+        return ConstIterator(tmp, NodePoint::First);
+      }
+      else if (tmp->type == NodeType::Triple && cmp_(key, tmp->data[1].first))
+      {
+        tmp = tmp->mid;
+      }
+      else if (tmp->type == NodeType::Triple && !cmp_(tmp->data[1].first, key))
+      {
+        return ConstIterator(tmp, NodePoint::Second);
+      }
+      else
+      {
+        tmp = tmp->right;
       }
     }
     return cend();
@@ -653,14 +671,7 @@ namespace alymova
   TTTConstIterator< Key, Value, Comparator >
     TwoThreeTree< Key, Value, Comparator >::lower_bound(const Key& key) const
   {
-    for (auto it = cbegin(); it != cend(); it++)
-    {
-      if (!cmp_(it->first, key))
-      {
-        return it;
-      }
-    }
-    return cend();
+    return find_bound(key, false);
   }
 
   template< class Key, class Value, class Comparator >
@@ -675,14 +686,7 @@ namespace alymova
   TTTConstIterator< Key, Value, Comparator >
     TwoThreeTree< Key, Value, Comparator >::upper_bound(const Key& key) const
   {
-    for (auto it = cbegin(); it != cend(); it++)
-    {
-      if (cmp_(key, it->first))
-      {
-        return it;
-      }
-    }
-    return cend();
+    return find_bound(key, true);
   }
 
   template< class Key, class Value, class Comparator >
@@ -800,6 +804,33 @@ namespace alymova
     fake_left_->parent = tmp;
   }
 
+  template< class Key, class Value, class Comparator >
+  TTTConstIterator< Key, Value, Comparator >
+    TwoThreeTree< Key, Value, Comparator >::find_bound(const Key& key, bool strict) const
+  {
+    ConstIterator result = cend();
+    Node* tmp = size_ == 0 ? nullptr : root_;
+    while (tmp && tmp->type != NodeType::Fake)
+    {
+      if (strict ? cmp_(key, tmp->data[0].first) : !cmp_(tmp->data[0].first, key))
+      {
+        result = ConstIterator(tmp, NodePoint::First);
+        tmp = tmp->left;
+      }
+      else if (tmp->type == NodeType::Triple &&
+        (strict ? cmp_(key, tmp->data[1].first) : !cmp_(tmp->data[1].first, key)))
+      {
+        result = ConstIterator(tmp, NodePoint::Second);
+        tmp = tmp->mid;
+      }
+      else
+      {
+        tmp = tmp->right;
+      }
+    }
+    return result;
+  }
+
   template< class Key, class Value, class Comparator >
   detail::TTTNode< Key, Value, Comparator >*
     TwoThreeTree< Key, Value, Comparator >::find_to_insert(const Key& key) const
@@ -0,0 +1,269 @@
+#ifndef BENCH_HARNESS_HPP
+#define BENCH_HARNESS_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bench
+{
+  enum class Format
+  {
+    TEXT,
+    CSV,
+    JSON
+  };
+
+  struct Options
+  {
+    size_t warmup = 1;
+    size_t repetitions = 10;
+    Format format = Format::TEXT;
+    std::string filter;
+  };
+
+  struct Result
+  {
+    std::string name;
+    size_t repetitions = 0;
+    double minNs = 0;
+    double medianNs = 0;
+    double p99Ns = 0;
+    double itemsPerSecond = 0;
+    double bytesPerSecond = 0;
+  };
+
+  class State
+  {
+  public:
+    explicit State(const Options& options):
+      options_(options),
+      items_(0),
+      bytes_(0)
+    {}
+
+    template< class F >
+    void run(F&& f)
+    {
+      for (size_t i = 0; i < options_.warmup; ++i)
+      {
+        f();
+      }
+      for (size_t i = 0; i < options_.repetitions; ++i)
+      {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        auto stop = std::chrono::steady_clock::now();
+        samples_.push_back(std::chrono::duration< double, std::nano >(stop - start).count());
+      }
+    }
+
+    void setItems(size_t items) noexcept
+    {
+      items_ = items;
+    }
+
+    void setBytes(size_t bytes) noexcept
+    {
+      bytes_ = bytes;
+    }
+
+    Result result(const std::string& name) const
+    {
+      Result res;
+      res.name = name;
+      res.repetitions = samples_.size();
+      if (samples_.empty())
+      {
+        return res;
+      }
+      std::vector< double > sorted(samples_);
+      std::sort(sorted.begin(), sorted.end());
+      size_t n = sorted.size();
+      res.minNs = sorted.front();
+      res.medianNs = n % 2 ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+      res.p99Ns = sorted[(n * 99 + 99) / 100 - 1];
+      if (res.medianNs > 0)
+      {
+        res.itemsPerSecond = items_ * 1e9 / res.medianNs;
+        res.bytesPerSecond = bytes_ * 1e9 / res.medianNs;
+      }
+      return res;
+    }
+
+  private:
+    const Options& options_;
+    size_t items_;
+    size_t bytes_;
+    std::vector< double > samples_;
+  };
+
+  using Function = void (*)(State&);
+
+  inline std::vector< std::pair< const char*, Function > >& registry()
+  {
+    static std::vector< std::pair< const char*, Function > > cases;
+    return cases;
+  }
+
+  struct Registrar
+  {
+    Registrar(const char* name, Function function)
+    {
+      registry().emplace_back(name, function);
+    }
+  };
+
+  template< class T >
+  inline void doNotOptimize(const T& value)
+  {
+#if defined(__GNUC__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile const void* sink = nullptr;
+    sink = &value;
+#endif
+  }
+
+  inline bool parseOption(const char* arg, const char* name, const char** value)
+  {
+    size_t length = std::strlen(name);
+    if (std::strncmp(arg, name, length) != 0 || arg[length] != '=')
+    {
+      return false;
+    }
+    *value = arg + length + 1;
+    return true;
+  }
+
+  inline Options parseOptions(int argc, char** argv)
+  {
+    Options options;
+    for (int i = 1; i < argc; ++i)
+    {
+      const char* value = nullptr;
+      if (parseOption(argv[i], "--warmup", &value))
+      {
+        options.warmup = std::strtoull(value, nullptr, 10);
+      }
+      else if (parseOption(argv[i], "--reps", &value))
+      {
+        options.repetitions = std::max< size_t >(1, std::strtoull(value, nullptr, 10));
+      }
+      else if (parseOption(argv[i], "--filter", &value))
+      {
+        options.filter = value;
+      }
+      else if (std::strcmp(argv[i], "--csv") == 0)
+      {
+        options.format = Format::CSV;
+      }
+      else if (std::strcmp(argv[i], "--json") == 0)
+      {
+        options.format = Format::JSON;
+      }
+      else
+      {
+        throw std::invalid_argument(std::string("unknown bench option: ") + argv[i]);
+      }
+    }
+    return options;
+  }
+
+  inline void printHeader(std::ostream& out, Format format)
+  {
+    if (format == Format::CSV)
+    {
+      out << "name,repetitions,min_ns,median_ns,p99_ns,items_per_second,bytes_per_second\n";
+    }
+    else if (format == Format::JSON)
+    {
+      out << "{\"benchmarks\": [";
+    }
+    else
+    {
+      out << std::left << std::setw(32) << "benchmark" << std::right << std::setw(6) << "reps";
+      out << std::setw(14) << "min ns" << std::setw(14) << "median ns" << std::setw(14) << "p99 ns";
+      out << std::setw(14) << "items/s" << std::setw(14) << "bytes/s" << '\n';
+    }
+  }
+
+  inline void printResult(std::ostream& out, Format format, const Result& res, bool first)
+  {
+    if (format == Format::CSV)
+    {
+      out << res.name << ',' << res.repetitions << ',' << res.minNs << ',' << res.medianNs << ',' << res.p99Ns;
+      out << ',' << res.itemsPerSecond << ',' << res.bytesPerSecond << '\n';
+    }
+    else if (format == Format::JSON)
+    {
+      out << (first ? "\n" : ",\n") << "  {\"name\": \"" << res.name << "\", \"repetitions\": " << res.repetitions;
+      out << ", \"min_ns\": " << res.minNs << ", \"median_ns\": " << res.medianNs << ", \"p99_ns\": " << res.p99Ns;
+      out << ", \"items_per_second\": " << res.itemsPerSecond;
+      out << ", \"bytes_per_second\": " << res.bytesPerSecond << '}';
+    }
+    else
+    {
+      out << std::left << std::setw(32) << res.name << std::right << std::setw(6) << res.repetitions;
+      out << std::fixed << std::setprecision(0) << std::setw(14) << res.minNs << std::setw(14) << res.medianNs;
+      out << std::setw(14) << res.p99Ns << std::setprecision(3) << std::scientific;
+      out << std::setw(14) << res.itemsPerSecond << std::setw(14) << res.bytesPerSecond << '\n';
+      out << std::defaultfloat;
+    }
+  }
+
+  inline int runAll(int argc, char** argv)
+  {
+    Options options;
+    try
+    {
+      options = parseOptions(argc, argv);
+    }
+    catch (const std::exception& e)
+    {
+      std::cerr << e.what() << '\n';
+      std::cerr << "usage: [--warmup=N] [--reps=N] [--filter=SUBSTRING] [--csv|--json]\n";
+      return 1;
+    }
+    printHeader(std::cout, options.format);
+    bool first = true;
+    for (const auto& entry: registry())
+    {
+      if (std::string(entry.first).find(options.filter) == std::string::npos)
+      {
+        continue;
+      }
+      State state(options);
+      entry.second(state);
+      printResult(std::cout, options.format, state.result(entry.first), first);
+      first = false;
+    }
+    if (options.format == Format::JSON)
+    {
+      std::cout << "\n]}\n";
+    }
+    return 0;
+  }
+}
+
+#define BENCH_CASE(name) \
+  static void name(::bench::State&); \
+  static ::bench::Registrar name##Registrar(#name, name); \
+  static void name(::bench::State& state)
+
+#ifdef BENCH_MAIN
+int main(int argc, char** argv)
+{
+  return ::bench::runAll(argc, argv);
+}
+#endif
+
+#endif
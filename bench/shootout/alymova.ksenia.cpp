@@ -0,0 +1,11 @@
+#include <functional>
+#include <tree/tree-2-3.hpp>
+#include "shootout.hpp"
+
+namespace
+{
+  template< class Key, class T >
+  using TwoThreeTree = alymova::TwoThreeTree< Key, T, std::less< Key > >;
+}
+
+SHOOTOUT_CONTAINER(twoThreeTree, "alymova::TwoThreeTree", shootout::Kind::ORDERED, TwoThreeTree);
@@ -0,0 +1,11 @@
+#include <functional>
+#include <tree/tree.hpp>
+#include "shootout.hpp"
+
+namespace
+{
+  template< class Key, class T >
+  using Tree = demehin::Tree< Key, T, std::less< Key > >;
+}
+
+SHOOTOUT_CONTAINER(tree, "demehin::Tree", shootout::Kind::ORDERED, Tree);
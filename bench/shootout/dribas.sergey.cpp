@@ -0,0 +1,11 @@
+#include <functional>
+#include <avlTree.hpp>
+#include "shootout.hpp"
+
+namespace
+{
+  template< class Key, class T >
+  using AVLTree = dribas::AVLTree< Key, T, std::less< Key > >;
+}
+
+SHOOTOUT_CONTAINER(avlTree, "dribas::AVLTree", shootout::Kind::ORDERED, AVLTree);
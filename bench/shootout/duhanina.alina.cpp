@@ -0,0 +1,19 @@
+#include <functional>
+#include <ChainedHashTable.hpp>
+#include <HashTable.hpp>
+#include <tree.hpp>
+#include "shootout.hpp"
+
+namespace
+{
+  template< class Key, class T >
+  using HashTable = duhanina::HashTable< Key, T >;
+  template< class Key, class T >
+  using ChainedHashTable = duhanina::ChainedHashTable< Key, T >;
+  template< class Key, class T >
+  using Tree = duhanina::Tree< Key, T, std::less< Key > >;
+}
+
+SHOOTOUT_CONTAINER(hashTable, "duhanina::HashTable", shootout::Kind::HASH, HashTable);
+SHOOTOUT_CONTAINER(chainedHashTable, "duhanina::ChainedHashTable", shootout::Kind::HASH, ChainedHashTable);
+SHOOTOUT_CONTAINER(tree, "duhanina::Tree", shootout::Kind::ORDERED, Tree);
@@ -0,0 +1,13 @@
+#include <functional>
+#include <tree/ConstIterator.hpp>
+#include <tree/Iterator.hpp>
+#include <tree/TwoThreeTree.hpp>
+#include "shootout.hpp"
+
+namespace
+{
+  template< class Key, class T >
+  using TwoThreeTree = gavrilova::TwoThreeTree< Key, T, std::less< Key > >;
+}
+
+SHOOTOUT_CONTAINER(twoThreeTree, "gavrilova::TwoThreeTree", shootout::Kind::ORDERED, TwoThreeTree);
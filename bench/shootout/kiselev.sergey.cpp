@@ -0,0 +1,11 @@
+#include <functional>
+#include <tree.hpp>
+#include "shootout.hpp"
+
+namespace
+{
+  template< class Key, class T >
+  using RBTree = kiselev::RBTree< Key, T, std::less< Key > >;
+}
+
+SHOOTOUT_CONTAINER(rbTree, "kiselev::RBTree", shootout::Kind::ORDERED, RBTree);
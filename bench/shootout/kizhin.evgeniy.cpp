@@ -0,0 +1,18 @@
+#include <map.hpp>
+#include <unordered-map.hpp>
+#include "shootout.hpp"
+
+namespace
+{
+  template< class Key, class T >
+  using UnorderedMap = kizhin::UnorderedMap< Key, T >;
+  template< class Key, class T >
+  using Map = kizhin::Map< Key, T >;
+}
+
+template<>
+struct shootout::Unsupported< kizhin::Map< std::string, uint64_t > >: std::true_type
+{};
+
+SHOOTOUT_CONTAINER(unorderedMap, "kizhin::UnorderedMap", shootout::Kind::HASH, UnorderedMap);
+SHOOTOUT_CONTAINER(map, "kizhin::Map", shootout::Kind::ORDERED, Map);
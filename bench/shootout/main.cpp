@@ -0,0 +1,323 @@
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include "shootout.hpp"
+#if defined(__unix__) || defined(__APPLE__)
+#include <csignal>
+#include <cstdio>
+#include <sys/wait.h>
+#include <unistd.h>
+#define SHOOTOUT_ISOLATE
+#endif
+
+namespace
+{
+  constexpr size_t header = alignof(std::max_align_t);
+  size_t allocated = 0;
+
+  void* countedNew(size_t size)
+  {
+    void* raw = std::malloc(size + header);
+    if (raw == nullptr)
+    {
+      throw std::bad_alloc();
+    }
+    *static_cast< size_t* >(raw) = size;
+    allocated += size;
+    return static_cast< unsigned char* >(raw) + header;
+  }
+
+  void countedDelete(void* ptr) noexcept
+  {
+    if (ptr != nullptr)
+    {
+      void* raw = static_cast< unsigned char* >(ptr) - header;
+      allocated -= *static_cast< size_t* >(raw);
+      std::free(raw);
+    }
+  }
+
+  std::vector< size_t > parseSizes(const char* value)
+  {
+    std::vector< size_t > sizes;
+    while (*value != '\0')
+    {
+      char* end = nullptr;
+      double size = std::strtod(value, &end);
+      if ((end == value) || (size < 1) || ((*end != ',') && (*end != '\0')))
+      {
+        throw std::invalid_argument(std::string("bad size list: ") + value);
+      }
+      sizes.push_back(static_cast< size_t >(size));
+      value = (*end == ',') ? end + 1 : end;
+    }
+    return sizes;
+  }
+
+  shootout::Options parseOptions(int argc, char** argv)
+  {
+    shootout::Options options;
+    for (int i = 1; i < argc; ++i)
+    {
+      const char* value = nullptr;
+      if (bench::parseOption(argv[i], "--sizes", &value))
+      {
+        options.sizes = parseSizes(value);
+      }
+      else if (bench::parseOption(argv[i], "--keys", &value))
+      {
+        options.integerKeys = std::strcmp(value, "string") != 0;
+        options.stringKeys = std::strcmp(value, "int") != 0;
+        if (!options.integerKeys && !options.stringKeys)
+        {
+          throw std::invalid_argument(std::string("bad key type: ") + value);
+        }
+      }
+      else if (bench::parseOption(argv[i], "--timeout", &value))
+      {
+        options.timeout = std::strtoul(value, nullptr, 10);
+      }
+      else if (bench::parseOption(argv[i], "--filter", &value))
+      {
+        options.filter = value;
+      }
+      else if (std::strcmp(argv[i], "--csv") == 0)
+      {
+        options.csv = true;
+      }
+      else
+      {
+        throw std::invalid_argument(std::string("unknown shootout option: ") + argv[i]);
+      }
+    }
+    return options;
+  }
+
+  std::string field(std::string& line)
+  {
+    size_t end = line.find('\t');
+    std::string result = line.substr(0, end);
+    line.erase(0, end == std::string::npos ? end : end + 1);
+    return result;
+  }
+
+#ifdef SHOOTOUT_ISOLATE
+  // each run gets its own process, so a crashing or hanging implementation only loses its own rows
+  void runIsolated(const shootout::Entry& entry, const shootout::Options& options, std::vector< shootout::Row >& rows)
+  {
+    const char* keys = options.integerKeys ? shootout::keyName< uint64_t >() : shootout::keyName< std::string >();
+    shootout::Row failure{entry.name, entry.kind, keys, options.sizes.front(), "-", 0, 0, 0, ""};
+    int fds[2];
+    std::cout.flush();
+    if (pipe(fds) != 0)
+    {
+      throw std::runtime_error("cannot create pipe");
+    }
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+      close(fds[0]);
+      alarm(options.timeout);
+      std::FILE* out = fdopen(fds[1], "w");
+      try
+      {
+        entry.runner(entry, options, [out](const shootout::Row& row)
+        {
+          std::string error = row.error;
+          std::replace(error.begin(), error.end(), '\t', ' ');
+          std::replace(error.begin(), error.end(), '\n', ' ');
+          std::fprintf(out, "%s\t%.17g\t%.17g\t%.17g\t%s\n", row.workload.c_str(), row.opsPerSecond, row.p99Ns,
+              row.bytesPerElement, error.c_str());
+          std::fflush(out);
+        });
+      }
+      catch (const std::exception& e)
+      {
+        std::fprintf(out, "-\t0\t0\t0\t%s\n", e.what());
+      }
+      std::fclose(out);
+      _exit(0);
+    }
+    close(fds[1]);
+    if (pid < 0)
+    {
+      close(fds[0]);
+      throw std::runtime_error("cannot fork");
+    }
+    std::string data;
+    char buffer[4096];
+    ssize_t count = 0;
+    while ((count = read(fds[0], buffer, sizeof(buffer))) > 0)
+    {
+      data.append(buffer, count);
+    }
+    close(fds[0]);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    for (size_t start = 0, end = 0; (end = data.find('\n', start)) != std::string::npos; start = end + 1)
+    {
+      std::string line = data.substr(start, end - start);
+      shootout::Row row = failure;
+      row.workload = field(line);
+      row.opsPerSecond = std::strtod(field(line).c_str(), nullptr);
+      row.p99Ns = std::strtod(field(line).c_str(), nullptr);
+      row.bytesPerElement = std::strtod(field(line).c_str(), nullptr);
+      row.error = line;
+      rows.push_back(row);
+    }
+    if (WIFSIGNALED(status) && (WTERMSIG(status) == SIGALRM))
+    {
+      failure.error = "timed out after " + std::to_string(options.timeout) + " s";
+      rows.push_back(failure);
+    }
+    else if (WIFSIGNALED(status))
+    {
+      failure.error = "crashed with signal " + std::to_string(WTERMSIG(status));
+      rows.push_back(failure);
+    }
+  }
+#else
+  void runIsolated(const shootout::Entry& entry, const shootout::Options& options, std::vector< shootout::Row >& rows)
+  {
+    entry.runner(entry, options, [&rows](const shootout::Row& row)
+    {
+      rows.push_back(row);
+    });
+  }
+#endif
+
+  std::tuple< shootout::Kind, std::string, size_t, std::string, double > sortKey(const shootout::Row& row)
+  {
+    return std::make_tuple(row.kind, row.keys, row.size, row.workload, -row.opsPerSecond);
+  }
+
+  const char* kindName(shootout::Kind kind)
+  {
+    return kind == shootout::Kind::HASH ? "hash" : "ordered";
+  }
+
+  void printRows(std::ostream& out, const std::vector< shootout::Row >& rows, bool csv)
+  {
+    if (csv)
+    {
+      out << "kind,container,keys,size,workload,ops_per_second,p99_ns,bytes_per_element,error\n";
+      for (const shootout::Row& row: rows)
+      {
+        out << kindName(row.kind) << ',' << row.container << ',' << row.keys << ',' << row.size << ',';
+        out << row.workload << ',' << row.opsPerSecond << ',' << row.p99Ns << ',' << row.bytesPerElement;
+        out << ',' << row.error << '\n';
+      }
+      return;
+    }
+    out << std::left << std::setw(8) << "kind" << std::setw(28) << "container" << std::setw(8) << "keys";
+    out << std::right << std::setw(10) << "size" << "  " << std::left << std::setw(18) << "workload";
+    out << std::right << std::setw(10) << "Mops/s" << std::setw(10) << "p99 ns" << std::setw(12) << "bytes/elem";
+    out << '\n' << std::fixed;
+    for (const shootout::Row& row: rows)
+    {
+      out << std::left << std::setw(8) << kindName(row.kind) << std::setw(28) << row.container;
+      out << std::setw(8) << row.keys << std::right << std::setw(10) << row.size << "  ";
+      out << std::left << std::setw(18) << row.workload << std::right;
+      if (!row.error.empty())
+      {
+        out << "  FAILED: " << row.error << '\n';
+        continue;
+      }
+      out << std::setprecision(2) << std::setw(10) << row.opsPerSecond / 1e6;
+      out << std::setprecision(1) << std::setw(10);
+      if (row.p99Ns > 0)
+      {
+        out << row.p99Ns;
+      }
+      else
+      {
+        out << '-';
+      }
+      if (row.bytesPerElement > 0)
+      {
+        out << std::setw(12) << row.bytesPerElement;
+      }
+      out << '\n';
+    }
+  }
+}
+
+size_t shootout::liveBytes() noexcept
+{
+  return allocated;
+}
+
+void* operator new(size_t size)
+{
+  return countedNew(size);
+}
+void* operator new[](size_t size)
+{
+  return countedNew(size);
+}
+void operator delete(void* ptr) noexcept
+{
+  countedDelete(ptr);
+}
+void operator delete[](void* ptr) noexcept
+{
+  countedDelete(ptr);
+}
+void operator delete(void* ptr, size_t) noexcept
+{
+  countedDelete(ptr);
+}
+void operator delete[](void* ptr, size_t) noexcept
+{
+  countedDelete(ptr);
+}
+
+int main(int argc, char** argv)
+{
+  shootout::Options options;
+  try
+  {
+    options = parseOptions(argc, argv);
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << e.what() << '\n';
+    std::cerr << "usage: [--sizes=N,N,...] [--keys=int|string|all] [--timeout=SECONDS] [--filter=SUBSTRING] [--csv]\n";
+    return 1;
+  }
+  std::vector< shootout::Row > rows;
+  for (const shootout::Entry& entry: shootout::registry())
+  {
+    if (std::string(entry.name).find(options.filter) == std::string::npos)
+    {
+      continue;
+    }
+    std::cerr << "running " << entry.name << '\n';
+    for (int keys = 0; keys < 2; keys++)
+    {
+      if (!(keys == 0 ? options.integerKeys : options.stringKeys))
+      {
+        continue;
+      }
+      for (size_t size: options.sizes)
+      {
+        shootout::Options single = options;
+        single.integerKeys = keys == 0;
+        single.stringKeys = keys == 1;
+        single.sizes = {size};
+        runIsolated(entry, single, rows);
+      }
+    }
+  }
+  std::stable_sort(rows.begin(), rows.end(), [](const shootout::Row& lhs, const shootout::Row& rhs)
+  {
+    return sortKey(lhs) < sortKey(rhs);
+  });
+  printRows(std::cout, rows, options.csv);
+}
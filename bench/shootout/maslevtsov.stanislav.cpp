@@ -0,0 +1,14 @@
+#include <hash_table/definition.hpp>
+#include <tree/definition.hpp>
+#include "shootout.hpp"
+
+namespace
+{
+  template< class Key, class T >
+  using HashTable = maslevtsov::HashTable< Key, T >;
+  template< class Key, class T >
+  using Tree = maslevtsov::Tree< Key, T >;
+}
+
+SHOOTOUT_CONTAINER(hashTable, "maslevtsov::HashTable", shootout::Kind::HASH, HashTable);
+SHOOTOUT_CONTAINER(tree, "maslevtsov::Tree", shootout::Kind::ORDERED, Tree);
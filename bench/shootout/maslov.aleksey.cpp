@@ -0,0 +1,15 @@
+#include <functional>
+#include <hashTable/hashTable.hpp>
+#include <tree/tree.hpp>
+#include "shootout.hpp"
+
+namespace
+{
+  template< class Key, class T >
+  using HashTable = maslov::HashTable< Key, T >;
+  template< class Key, class T >
+  using BiTree = maslov::BiTree< Key, T, std::less< Key > >;
+}
+
+SHOOTOUT_CONTAINER(hashTable, "maslov::HashTable", shootout::Kind::HASH, HashTable);
+SHOOTOUT_CONTAINER(biTree, "maslov::BiTree", shootout::Kind::ORDERED, BiTree);
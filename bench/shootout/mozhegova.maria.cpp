@@ -0,0 +1,10 @@
+#include <hashTable.hpp>
+#include "shootout.hpp"
+
+namespace
+{
+  template< class Key, class T >
+  using HashTable = mozhegova::HashTable< Key, T >;
+}
+
+SHOOTOUT_CONTAINER(hashTable, "mozhegova::HashTable", shootout::Kind::HASH, HashTable);
@@ -0,0 +1,14 @@
+#include <map.hpp>
+#include <unordered_map.hpp>
+#include "shootout.hpp"
+
+namespace
+{
+  template< class Key, class T >
+  using UnorderedMap = rychkov::UnorderedMap< Key, T >;
+  template< class Key, class T >
+  using Map = rychkov::Map< Key, T >;
+}
+
+SHOOTOUT_CONTAINER(unorderedMap, "rychkov::UnorderedMap", shootout::Kind::HASH, UnorderedMap);
+SHOOTOUT_CONTAINER(map, "rychkov::Map", shootout::Kind::ORDERED, Map);
@@ -0,0 +1,14 @@
+#include <S7/cuckoo-hash-map.h>
+#include <two-three-tree.h>
+#include "shootout.hpp"
+
+namespace
+{
+  template< class Key, class T >
+  using HashMap = savintsev::HashMap< Key, T >;
+  template< class Key, class T >
+  using TwoThreeTree = savintsev::TwoThreeTree< Key, T >;
+}
+
+SHOOTOUT_CONTAINER(hashMap, "savintsev::HashMap", shootout::Kind::HASH, HashMap);
+SHOOTOUT_CONTAINER(twoThreeTree, "savintsev::TwoThreeTree", shootout::Kind::ORDERED, TwoThreeTree);
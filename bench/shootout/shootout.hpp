@@ -0,0 +1,372 @@
+#ifndef BENCH_SHOOTOUT_HPP
+#define BENCH_SHOOTOUT_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <harness.hpp>
+
+namespace shootout
+{
+  enum class Kind
+  {
+    HASH,
+    ORDERED
+  };
+
+  struct Options
+  {
+    std::vector< size_t > sizes = {1000, 10000, 100000, 1000000};
+    bool integerKeys = true;
+    bool stringKeys = true;
+    bool csv = false;
+    unsigned timeout = 60;
+    std::string filter;
+  };
+
+  struct Row
+  {
+    std::string container;
+    Kind kind;
+    const char* keys;
+    size_t size;
+    std::string workload;
+    double opsPerSecond;
+    double p99Ns;
+    double bytesPerElement;
+    std::string error;
+  };
+
+  // operations are timed in batches, so p99 is the per-operation time of the slowest batches
+  constexpr size_t batch = 16;
+
+  size_t liveBytes() noexcept;
+
+  struct Entry;
+  using Sink = std::function< void(const Row&) >;
+  using Runner = void (*)(const Entry&, const Options&, const Sink&);
+  struct Entry
+  {
+    const char* name;
+    Kind kind;
+    Runner runner;
+  };
+
+  inline std::vector< Entry >& registry()
+  {
+    static std::vector< Entry > entries;
+    return entries;
+  }
+
+  struct Registrar
+  {
+    Registrar(const char* name, Kind kind, Runner runner)
+    {
+      registry().push_back({name, kind, runner});
+    }
+  };
+
+  inline uint64_t mix(uint64_t value) noexcept
+  {
+    value += 0x9e3779b97f4a7c15ULL;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+  }
+
+  template< class Key >
+  Key makeKey(uint64_t value);
+
+  template<>
+  inline uint64_t makeKey< uint64_t >(uint64_t value)
+  {
+    return value;
+  }
+
+  template<>
+  inline std::string makeKey< std::string >(uint64_t value)
+  {
+    static const char digits[] = "0123456789abcdef";
+    std::string result(17, 'k');
+    for (size_t i = 16; i > 0; i--, value >>= 4)
+    {
+      result[i] = digits[value & 15];
+    }
+    return result;
+  }
+
+  template< class Key >
+  const char* keyName();
+
+  template<>
+  inline const char* keyName< uint64_t >()
+  {
+    return "int";
+  }
+
+  template<>
+  inline const char* keyName< std::string >()
+  {
+    return "string";
+  }
+
+  inline std::string expect(const char* what, uint64_t actual, uint64_t expected)
+  {
+    if (actual == expected)
+    {
+      return "";
+    }
+    return std::string(what) + ' ' + std::to_string(actual) + ", expected " + std::to_string(expected);
+  }
+
+  class Timer
+  {
+  public:
+    explicit Timer(size_t operations):
+      operations_(operations)
+    {
+      samples_.reserve(operations / batch + 1);
+      start_ = std::chrono::steady_clock::now();
+      last_ = start_;
+    }
+
+    void tick(size_t done)
+    {
+      if (done % batch == 0)
+      {
+        auto now = std::chrono::steady_clock::now();
+        samples_.push_back(std::chrono::duration< double, std::nano >(now - last_).count() / batch);
+        last_ = now;
+      }
+    }
+
+    void finish(Row& row)
+    {
+      double total = std::chrono::duration< double >(std::chrono::steady_clock::now() - start_).count();
+      row.opsPerSecond = total > 0 ? operations_ / total : 0;
+      if (!samples_.empty())
+      {
+        size_t p99 = (samples_.size() * 99 + 99) / 100 - 1;
+        std::nth_element(samples_.begin(), samples_.begin() + p99, samples_.end());
+        row.p99Ns = samples_[p99];
+      }
+    }
+
+  private:
+    size_t operations_;
+    std::chrono::steady_clock::time_point start_;
+    std::chrono::steady_clock::time_point last_;
+    std::vector< double > samples_;
+  };
+
+  // the adapter every implementation is driven through; specialise it when an interface differs
+  template< class Map >
+  struct Adapter
+  {
+    template< class Key >
+    static void insert(Map& map, const Key& key, uint64_t value)
+    {
+      map[key] = value;
+    }
+
+    template< class Key >
+    static bool contains(Map& map, const Key& key)
+    {
+      return map.find(key) != map.end();
+    }
+
+    template< class Key >
+    static size_t erase(Map& map, const Key& key)
+    {
+      return map.erase(key);
+    }
+
+    static uint64_t sum(Map& map)
+    {
+      uint64_t result = 0;
+      for (auto it = map.begin(); it != map.end(); ++it)
+      {
+        result += (*it).second;
+      }
+      return result;
+    }
+  };
+
+  template< class Map, class Key >
+  class Workloads
+  {
+  public:
+    Workloads(const Entry& entry, size_t size, const Sink& sink):
+      entry_(entry),
+      size_(size),
+      sink_(sink)
+    {
+      for (size_t i = 0; i < size; i++)
+      {
+        hits_.push_back(makeKey< Key >(mix(i)));
+        misses_.push_back(makeKey< Key >(mix(i + size)));
+      }
+      order_.resize(size);
+      for (size_t i = 0; i < size; i++)
+      {
+        order_[i] = i;
+      }
+      std::shuffle(order_.begin(), order_.end(), std::mt19937_64(size));
+    }
+
+    void run()
+    {
+      {
+        Map map;
+        insert("insert random", map);
+        record("lookup hit", [&](Timer& timer)
+        {
+          size_t found = 0;
+          for (size_t i = 0; i < size_; i++)
+          {
+            found += Adapter< Map >::contains(map, hits_[order_[i]]);
+            timer.tick(i + 1);
+          }
+          return expect("found", found, size_);
+        });
+        record("lookup miss", [&](Timer& timer)
+        {
+          size_t found = 0;
+          for (size_t i = 0; i < size_; i++)
+          {
+            found += Adapter< Map >::contains(map, misses_[i]);
+            timer.tick(i + 1);
+          }
+          return expect("found", found, 0);
+        });
+        record("iterate", [&](Timer&)
+        {
+          uint64_t sum = Adapter< Map >::sum(map);
+          bench::doNotOptimize(sum);
+          return expect("value sum", sum, static_cast< uint64_t >(size_) * (size_ - (size_ ? 1 : 0)) / 2);
+        });
+        record("erase churn", [&](Timer& timer)
+        {
+          size_t erased = 0;
+          for (size_t i = 0; i < size_; i++)
+          {
+            erased += Adapter< Map >::erase(map, hits_[order_[i]]);
+            Adapter< Map >::insert(map, misses_[i], i);
+            timer.tick(i + 1);
+          }
+          std::string error = expect("erased", erased, size_);
+          return error.empty() ? expect("size", map.size(), size_) : error;
+        });
+      }
+      for (size_t i = 0; i < size_; i++)
+      {
+        hits_[i] = makeKey< Key >(i);
+      }
+      Map sequential;
+      insert("insert sequential", sequential);
+    }
+
+  private:
+    const Entry& entry_;
+    size_t size_;
+    const Sink& sink_;
+    std::vector< Key > hits_;
+    std::vector< Key > misses_;
+    std::vector< size_t > order_;
+
+    void insert(const char* workload, Map& map)
+    {
+      size_t before = liveBytes();
+      Row row = measure(workload, [&](Timer& timer)
+      {
+        for (size_t i = 0; i < size_; i++)
+        {
+          Adapter< Map >::insert(map, hits_[i], i);
+          timer.tick(i + 1);
+        }
+        return expect("size", map.size(), size_);
+      });
+      row.bytesPerElement = size_ ? static_cast< double >(liveBytes() - before) / size_ : 0;
+      sink_(row);
+    }
+
+    template< class F >
+    void record(const char* workload, F&& body)
+    {
+      sink_(measure(workload, std::forward< F >(body)));
+    }
+
+    template< class F >
+    Row measure(const char* workload, F&& body)
+    {
+      Row row{entry_.name, entry_.kind, keyName< Key >(), size_, workload, 0, 0, 0, ""};
+      try
+      {
+        Timer timer(size_);
+        row.error = body(timer);
+        timer.finish(row);
+      }
+      catch (const std::exception& e)
+      {
+        row.error = e.what();
+      }
+      return row;
+    }
+  };
+
+  // specialise for instantiations an implementation cannot provide; they are reported instead of run
+  template< class Map >
+  struct Unsupported: std::false_type
+  {};
+
+  template< class Map, class Key >
+  void runSizes(const Entry& entry, const Options& options, const Sink& sink, std::false_type)
+  {
+    for (size_t size: options.sizes)
+    {
+      Workloads< Map, Key >(entry, size, sink).run();
+    }
+  }
+
+  template< class Map, class Key >
+  void runSizes(const Entry& entry, const Options& options, const Sink& sink, std::true_type)
+  {
+    for (size_t size: options.sizes)
+    {
+      sink({entry.name, entry.kind, keyName< Key >(), size, "all", 0, 0, 0, "unsupported key type"});
+    }
+  }
+
+  template< template< class, class > class Map >
+  void runAll(const Entry& entry, const Options& options, const Sink& sink)
+  {
+    if (options.integerKeys)
+    {
+      using IntegerMap = Map< uint64_t, uint64_t >;
+      runSizes< IntegerMap, uint64_t >(entry, options, sink, Unsupported< IntegerMap >{});
+    }
+    if (options.stringKeys)
+    {
+      using StringMap = Map< std::string, uint64_t >;
+      runSizes< StringMap, std::string >(entry, options, sink, Unsupported< StringMap >{});
+    }
+  }
+}
+
+#define SHOOTOUT_CONTAINER(id, name, kind, map) \
+  static void id##Shootout(const ::shootout::Entry& entry, const ::shootout::Options& options, \
+      const ::shootout::Sink& sink) \
+  { \
+    ::shootout::runAll< map >(entry, options, sink); \
+  } \
+  static ::shootout::Registrar id##ShootoutRegistrar(name, kind, id##Shootout)
+
+#endif
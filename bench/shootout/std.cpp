@@ -0,0 +1,14 @@
+#include <map>
+#include <unordered_map>
+#include "shootout.hpp"
+
+namespace
+{
+  template< class Key, class T >
+  using UnorderedMap = std::unordered_map< Key, T >;
+  template< class Key, class T >
+  using Map = std::map< Key, T >;
+}
+
+SHOOTOUT_CONTAINER(unorderedMap, "std::unordered_map", shootout::Kind::HASH, UnorderedMap);
+SHOOTOUT_CONTAINER(map, "std::map", shootout::Kind::ORDERED, Map);
@@ -0,0 +1,10 @@
+#include <S7/hash_table.hpp>
+#include "shootout.hpp"
+
+namespace
+{
+  template< class Key, class T >
+  using HashTable = tkach::HashTable< Key, T >;
+}
+
+SHOOTOUT_CONTAINER(hashTable, "tkach::HashTable", shootout::Kind::HASH, HashTable);
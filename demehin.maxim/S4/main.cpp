@@ -7,8 +7,8 @@
 
 namespace
 {
-  using TreeMap = demehin::Tree< size_t, std::string >;
-  using MapOfTrees = demehin::Tree< std::string, TreeMap >;
+  using demehin::TreeMap;
+  using demehin::MapOfTrees;
 
   void inputTrees(std::istream& in, MapOfTrees& mapOfTrees)
   {
@@ -1,6 +1,9 @@
 #include <boost/test/unit_test.hpp>
+#include <map>
 #include <sstream>
+#include <vector>
 #include <tree/tree.hpp>
+#include <tree/persistent_tree.hpp>
 
 namespace
 {
@@ -11,6 +14,14 @@ namespace
       out << (*it).second;
     }
   }
+
+  void printTreeValues(std::ostream& out, const demehin::PersistentTree< size_t, std::string >& tree)
+  {
+    for (auto it = tree.begin(); it != tree.end(); it++)
+    {
+      out << (*it).second;
+    }
+  }
 }
 
 BOOST_AUTO_TEST_CASE(extra_test)
@@ -236,3 +247,70 @@ BOOST_AUTO_TEST_CASE(operators_test)
   BOOST_TEST(mv_tree.size() == 2);
   BOOST_TEST(out2.str() == "13");
 }
+
+BOOST_AUTO_TEST_CASE(persistent_snapshot_test)
+{
+  demehin::PersistentTree< size_t, std::string > tree{ { 2, "2" }, { 1, "1" }, { 3, "3" } };
+  demehin::PersistentTree< size_t, std::string > snapshot(tree);
+
+  tree.insert(std::make_pair(4, "4"));
+  tree.erase(1);
+  BOOST_TEST(!tree.insert(std::make_pair(2, "5")).second);
+  snapshot.insert(std::make_pair(0, "0"));
+
+  std::ostringstream out1;
+  std::ostringstream out2;
+  printTreeValues(out1, tree);
+  printTreeValues(out2, snapshot);
+  BOOST_TEST(out1.str() == "234");
+  BOOST_TEST(out2.str() == "0123");
+  BOOST_TEST(tree.size() == 3);
+  BOOST_TEST(snapshot.size() == 4);
+  BOOST_TEST(tree.at(2) == "2");
+  BOOST_TEST(tree.count(1) == 0);
+  BOOST_TEST(snapshot.count(1) == 1);
+  BOOST_CHECK_THROW(tree.at(1), std::out_of_range);
+
+  demehin::PersistentTree< size_t, std::string > moved(std::move(snapshot));
+  snapshot = moved;
+  moved.clear();
+  BOOST_TEST(moved.empty());
+  BOOST_TEST(snapshot.size() == 4);
+}
+
+BOOST_AUTO_TEST_CASE(persistent_versions_test)
+{
+  std::vector< demehin::PersistentTree< size_t, size_t > > versions(1);
+  std::vector< std::map< size_t, size_t > > expected(1);
+  size_t seed = 7;
+  for (size_t i = 0; i < 2000; i++)
+  {
+    seed = seed * 1103515245 + 12345;
+    size_t key = (seed >> 8) % 300;
+    demehin::PersistentTree< size_t, size_t > next(versions.back());
+    std::map< size_t, size_t > nextExpected(expected.back());
+    if ((seed >> 4) % 3 == 0)
+    {
+      BOOST_TEST(next.erase(key) == nextExpected.erase(key));
+    }
+    else
+    {
+      next.insert(std::make_pair(key, i));
+      nextExpected.insert(std::make_pair(key, i));
+    }
+    versions.push_back(next);
+    expected.push_back(nextExpected);
+  }
+
+  for (size_t i = 0; i < versions.size(); i++)
+  {
+    BOOST_TEST(versions[i].size() == expected[i].size());
+    auto it = versions[i].begin();
+    for (auto expIt = expected[i].begin(); expIt != expected[i].end(); ++expIt, ++it)
+    {
+      BOOST_TEST(it->first == expIt->first);
+      BOOST_TEST(it->second == expIt->second);
+    }
+    BOOST_CHECK(it == versions[i].end());
+  }
+}
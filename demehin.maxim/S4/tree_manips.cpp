@@ -4,7 +4,7 @@ void demehin::print(std::ostream& out, std::istream& in, const MapOfTrees& mapOf
 {
   std::string datasetName;
   in >> datasetName;
-  TreeMap map = mapOfTrees.at(datasetName);
+  const TreeMap& map = mapOfTrees.at(datasetName);
   if (map.empty())
   {
     out << "<EMPTY>\n";
@@ -23,97 +23,48 @@ void demehin::makeComplement(std::istream& in, MapOfTrees& mapOfTrees)
 {
   std::string newName, name1, name2;
   in >> newName >> name1 >> name2;
-  TreeMap newMap, map1, map2;
-  if (mapOfTrees.at(name1).size() > mapOfTrees.at(name2).size())
-  {
-    map1 = mapOfTrees.at(name1);
-    map2 = mapOfTrees.at(name2);
-  }
-  else
-  {
-    map1 = mapOfTrees.at(name2);
-    map2 = mapOfTrees.at(name1);
-  }
-
-  for (auto&& key: map1)
-  {
-    if (map2.find(key.first) == map2.end())
-    {
-      newMap.insert(key);
-    }
-  }
+  const TreeMap& lhsMap = mapOfTrees.at(name1);
+  const TreeMap& rhsMap = mapOfTrees.at(name2);
+  const TreeMap& bigger = lhsMap.size() > rhsMap.size() ? lhsMap : rhsMap;
+  const TreeMap& smaller = lhsMap.size() > rhsMap.size() ? rhsMap : lhsMap;
 
-  if (newName == name1)
+  TreeMap newMap(bigger);
+  for (auto&& key: smaller)
   {
-    mapOfTrees[name1] = newMap;
-    return;
+    newMap.erase(key.first);
   }
-  else if (newName == name2)
-  {
-    mapOfTrees[name2] = newMap;
-    return;
-  }
-
-  mapOfTrees[newName] = newMap;
+  mapOfTrees[newName] = std::move(newMap);
 }
 
 void demehin::makeIntersect(std::istream& in, MapOfTrees& mapOfTrees)
 {
   std::string newName, lhsName, rhsName;
   in >> newName >> lhsName >> rhsName;
-  TreeMap newMap, lhsMap, rhsMap;
-  lhsMap = mapOfTrees.at(lhsName);
-  rhsMap = mapOfTrees.at(rhsName);
+  const TreeMap& lhsMap = mapOfTrees.at(lhsName);
+  const TreeMap& rhsMap = mapOfTrees.at(rhsName);
+
+  TreeMap newMap(lhsMap);
   for (auto&& key: lhsMap)
   {
-    if (rhsMap.find(key.first) != rhsMap.end())
+    if (rhsMap.count(key.first) == 0)
     {
-      newMap.insert(key);
+      newMap.erase(key.first);
     }
   }
-
-  if (newName == lhsName)
-  {
-    mapOfTrees[lhsName] = newMap;
-    return;
-  }
-  else if (newName == rhsName)
-  {
-    mapOfTrees[rhsName] = newMap;
-    return;
-  }
-  mapOfTrees[newName] = newMap;
+  mapOfTrees[newName] = std::move(newMap);
 }
 
 void demehin::makeUnion(std::istream& in, MapOfTrees& mapOfTrees)
 {
   std::string newName, lhsName, rhsName;
   in >> newName >> lhsName >> rhsName;
-  TreeMap newMap, lhsMap, rhsMap;
-  lhsMap = mapOfTrees.at(lhsName);
-  rhsMap = mapOfTrees.at(rhsName);
-  for (auto&& key: lhsMap)
-  {
-    newMap.insert(key);
-  }
-  for (auto&& key: rhsMap)
-  {
-    if (newMap.find(key.first) == newMap.end())
-    {
-      newMap.insert(key);
-    }
-  }
+  const TreeMap& lhsMap = mapOfTrees.at(lhsName);
+  const TreeMap& rhsMap = mapOfTrees.at(rhsName);
 
-  if (newName == lhsName)
-  {
-    mapOfTrees[lhsName] = newMap;
-    return;
-  }
-  else if (newName == rhsName)
+  TreeMap newMap(lhsMap);
+  for (auto&& key: rhsMap)
   {
-    mapOfTrees[rhsName] = newMap;
-    return;
+    newMap.insert(key);
   }
-
-  mapOfTrees[newName] = newMap;
+  mapOfTrees[newName] = std::move(newMap);
 }
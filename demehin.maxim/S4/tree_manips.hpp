@@ -3,10 +3,11 @@
 #include <string>
 #include <iostream>
 #include <tree/tree.hpp>
+#include <tree/persistent_tree.hpp>
 
 namespace demehin
 {
-  using TreeMap = demehin::Tree< size_t, std::string >;
+  using TreeMap = demehin::PersistentTree< size_t, std::string >;
   using MapOfTrees = demehin::Tree< std::string, TreeMap >;
 
   void print(std::ostream& out, std::istream& in, const MapOfTrees& mapOfTrees);
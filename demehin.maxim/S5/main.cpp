@@ -1,5 +1,6 @@
 #include <iostream>
 #include <fstream>
+#include <string>
 #include <tree/tree.hpp>
 #include "key_summ.hpp"
 
@@ -17,19 +18,19 @@ namespace
     }
   }
 
-  void traverseLnr(const Map& tree, demehin::KeySumm& res)
+  void traverseLnr(const Map& tree, int lo, int hi, demehin::KeySumm& res)
   {
-    res = tree.traverse_lnr(res);
+    res = tree.traverse_lnr(lo, hi, res);
   }
 
-  void traverseRnl(const Map& tree, demehin::KeySumm& res)
+  void traverseRnl(const Map& tree, int lo, int hi, demehin::KeySumm& res)
   {
-    res = tree.traverse_rnl(res);
+    res = tree.traverse_rnl(lo, hi, res);
   }
 
-  void traverseBreadth(const Map& tree, demehin::KeySumm& res)
+  void traverseBreadth(const Map& tree, int lo, int hi, demehin::KeySumm& res)
   {
-    res = tree.traverse_breadth(res);
+    res = tree.traverse_breadth(lo, hi, res);
   }
 }
 
@@ -38,7 +39,7 @@ int main(int argc, char* argv[])
   using namespace demehin;
   using namespace std::placeholders;
 
-  if (argc != 3)
+  if (argc != 3 && argc != 5)
   {
     return 1;
   }
@@ -46,11 +47,11 @@ int main(int argc, char* argv[])
   std::ifstream file(argv[2]);
   Map tree;
   KeySumm res;
-  Tree< std::string, std::function< void(Map&, KeySumm&) > > cmds;
+  Tree< std::string, std::function< void(const Map&, int, int, KeySumm&) > > cmds;
 
-  cmds["ascending"] = std::bind(traverseLnr, _1, _2);
-  cmds["descending"] = std::bind(traverseRnl, _1, _2);
-  cmds["breadth"] = std::bind(traverseBreadth, _1, _2);
+  cmds["ascending"] = std::bind(traverseLnr, _1, _2, _3, _4);
+  cmds["descending"] = std::bind(traverseRnl, _1, _2, _3, _4);
+  cmds["breadth"] = std::bind(traverseBreadth, _1, _2, _3, _4);
 
   try
   {
@@ -65,7 +66,20 @@ int main(int argc, char* argv[])
       std::cout << "<EMPTY>\n";
       return 0;
     }
-    cmds.at(argv[1])(tree, res);
+    int lo = tree.cbegin()->first;
+    int hi = (--tree.cend())->first;
+    if (argc == 5)
+    {
+      lo = std::stoi(argv[3]);
+      hi = std::stoi(argv[4]);
+    }
+    auto traverse = cmds.at(argv[1]);
+    if (tree.count(lo, hi) == 0)
+    {
+      std::cout << "<EMPTY>\n";
+      return 0;
+    }
+    traverse(tree, lo, hi, res);
   }
   catch (const std::exception& e)
   {
@@ -78,3 +78,57 @@ BOOST_AUTO_TEST_CASE(traversal_big_tree_test)
   BOOST_TEST(rnl_res.str_res == "rightright right rightleft root leftright left leftleft");
   BOOST_TEST(br_res.str_res == "root left right leftleft leftright rightleft rightright");
 }
+
+BOOST_AUTO_TEST_CASE(range_summ_test)
+{
+  demehin::Tree< int, std::string > tree;
+  for (int i = 1; i <= 100; i++)
+  {
+    tree.insert(std::make_pair(i * 2, std::to_string(i * 2)));
+  }
+  tree.erase(50);
+  tree.erase(2);
+
+  BOOST_TEST(tree.count(1, 200) == 98);
+  BOOST_TEST(tree.count(3, 9) == 3);
+  BOOST_TEST(tree.count(10, 9) == 0);
+  BOOST_TEST(tree.key_sum(3, 9) == 18);
+  BOOST_TEST(tree.key_sum(40, 60) == 500);
+  BOOST_TEST(tree.key_sum(201, 300) == 0);
+
+  long long expected = 0;
+  for (auto it = tree.cbegin(); it != tree.cend(); ++it)
+  {
+    expected += it->first;
+  }
+  BOOST_TEST(tree.key_sum(-1000, 1000) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(range_traversal_test)
+{
+  demehin::Tree< int , std::string > tree;
+  tree[50] = "root";
+  tree[30] = "left";
+  tree[70] = "right";
+  tree[20] = "leftleft";
+  tree[40] = "leftright";
+  tree[60] = "rightleft";
+  tree[80] = "rightright";
+
+  demehin::KeySumm lnr_res;
+  demehin::KeySumm rnl_res;
+  demehin::KeySumm br_res;
+
+  lnr_res = tree.traverse_lnr(25, 60, lnr_res);
+  rnl_res = tree.traverse_rnl(25, 60, rnl_res);
+  br_res = tree.traverse_breadth(25, 60, br_res);
+
+  BOOST_TEST(lnr_res.val_res == 180);
+  BOOST_TEST(rnl_res.val_res == 180);
+  BOOST_TEST(br_res.val_res == 180);
+  BOOST_TEST(tree.key_sum(25, 60) == 180);
+
+  BOOST_TEST(lnr_res.str_res == "left leftright root rightleft");
+  BOOST_TEST(rnl_res.str_res == "rightleft root leftright left");
+  BOOST_TEST(br_res.str_res == "root left leftright rightleft");
+}
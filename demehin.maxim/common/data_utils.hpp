@@ -6,9 +6,9 @@
 namespace demehin::details
 {
   template< typename T >
-  T* copyData(const T* data, size_t size)
+  T* copyData(const T* data, size_t size, size_t capacity)
   {
-    T* cpyData = new T[size];
+    T* cpyData = new T[capacity];
     try
     {
       for (size_t i = 0; i < size; i++)
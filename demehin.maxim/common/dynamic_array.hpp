@@ -82,7 +82,7 @@ namespace demehin
 
   template< typename T >
   DynamicArray< T >::DynamicArray(const DynamicArray& other):
-    data_(details::copyData(other.data_ + other.begin_, other.size_)),
+    data_(details::copyData(other.data_, other.capacity_, other.capacity_)),
     size_(other.size_),
     capacity_(other.capacity_),
     begin_(other.begin_)
@@ -287,8 +287,8 @@ namespace demehin
   template< typename T >
   void DynamicArray< T >::resize()
   {
+    T* newData = details::copyData(data_, capacity_, capacity_ * 2);
     capacity_ *= 2;
-    T* newData = details::copyData(data_, capacity_);
     delete[] data_;
     data_ = newData;
   }
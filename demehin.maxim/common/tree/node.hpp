@@ -1,17 +1,55 @@
 #ifndef NODE_HPP
 #define NODE_HPP
+#include <cstddef>
+#include <type_traits>
 #include <utility>
 
 namespace demehin
 {
+  struct NoKeySum
+  {
+    NoKeySum() = default;
+
+    template< typename Key >
+    explicit NoKeySum(const Key&) noexcept
+    {}
+
+    NoKeySum operator+(const NoKeySum&) const noexcept
+    {
+      return NoKeySum();
+    }
+  };
+
+  template< typename Key, bool = std::is_integral< Key >::value, bool = std::is_floating_point< Key >::value >
+  struct KeySumType
+  {
+    using type = NoKeySum;
+  };
+
+  template< typename Key >
+  struct KeySumType< Key, true, false >
+  {
+    using type = typename std::conditional< std::is_signed< Key >::value, long long, unsigned long long >::type;
+  };
+
+  template< typename Key >
+  struct KeySumType< Key, false, true >
+  {
+    using type = long double;
+  };
+
   template< typename Key, typename T >
   struct TreeNode
   {
+    using KeySum = typename KeySumType< Key >::type;
+
     std::pair< Key, T > data;
     TreeNode* parent;
     TreeNode* left;
     TreeNode* right;
     int height;
+    size_t count;
+    KeySum keys;
 
     template< typename... Args >
     explicit TreeNode(Args&&... args) noexcept;
@@ -25,7 +63,9 @@ namespace demehin
     parent(nullptr),
     left(nullptr),
     right(nullptr),
-    height(1)
+    height(1),
+    count(1),
+    keys(static_cast< KeySum >(data.first))
   {}
 }
 
@@ -0,0 +1,123 @@
+#ifndef PERSISTENT_ITERATOR_HPP
+#define PERSISTENT_ITERATOR_HPP
+#include <cassert>
+#include <memory>
+#include <tree/persistent_node.hpp>
+#include <stack.hpp>
+
+namespace demehin
+{
+  template< typename Key, typename T, typename Cmp >
+  class PersistentTree;
+
+  template< typename Key, typename T, typename Cmp >
+  class PersistentIterator
+  {
+    friend class PersistentTree< Key, T, Cmp >;
+  public:
+    using Node = demehin::PersistentTreeNode< Key, T >;
+    using this_t = PersistentIterator< Key, T, Cmp >;
+    using data_t = const std::pair< Key, T >;
+
+    PersistentIterator() noexcept;
+
+    this_t& operator++();
+    this_t operator++(int);
+
+    data_t& operator*() const noexcept;
+    data_t* operator->() const noexcept;
+
+    bool operator==(const this_t&) const noexcept;
+    bool operator!=(const this_t&) const noexcept;
+
+  private:
+    const Node* node_;
+    Stack< const Node* > stack_;
+
+    explicit PersistentIterator(const Node*) noexcept;
+    void descendLeft(const Node*);
+  };
+
+  template< typename Key, typename T, typename Cmp >
+  PersistentIterator< Key, T, Cmp >::PersistentIterator() noexcept:
+    node_(nullptr),
+    stack_()
+  {}
+
+  template< typename Key, typename T, typename Cmp >
+  PersistentIterator< Key, T, Cmp >::PersistentIterator(const Node* node) noexcept:
+    node_(node),
+    stack_()
+  {}
+
+  template< typename Key, typename T, typename Cmp >
+  void PersistentIterator< Key, T, Cmp >::descendLeft(const Node* node)
+  {
+    while (node->left != nullptr)
+    {
+      stack_.push(node);
+      node = node->left;
+    }
+    node_ = node;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentIterator< Key, T, Cmp >::this_t& PersistentIterator< Key, T, Cmp >::operator++()
+  {
+    if (node_ == nullptr)
+    {
+      return *this;
+    }
+
+    if (node_->right != nullptr)
+    {
+      descendLeft(node_->right);
+    }
+    else if (stack_.empty())
+    {
+      node_ = nullptr;
+    }
+    else
+    {
+      node_ = stack_.top();
+      stack_.pop();
+    }
+    return *this;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentIterator< Key, T, Cmp >::this_t PersistentIterator< Key, T, Cmp >::operator++(int)
+  {
+    this_t res(*this);
+    ++(*this);
+    return res;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentIterator< Key, T, Cmp >::data_t& PersistentIterator< Key, T, Cmp >::operator*() const noexcept
+  {
+    assert(node_ != nullptr);
+    return node_->data;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentIterator< Key, T, Cmp >::data_t* PersistentIterator< Key, T, Cmp >::operator->() const noexcept
+  {
+    assert(node_ != nullptr);
+    return std::addressof(node_->data);
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  bool PersistentIterator< Key, T, Cmp >::operator==(const this_t& rhs) const noexcept
+  {
+    return node_ == rhs.node_;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  bool PersistentIterator< Key, T, Cmp >::operator!=(const this_t& rhs) const noexcept
+  {
+    return !(*this == rhs);
+  }
+}
+
+#endif
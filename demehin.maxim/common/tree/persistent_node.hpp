@@ -0,0 +1,31 @@
+#ifndef PERSISTENT_NODE_HPP
+#define PERSISTENT_NODE_HPP
+#include <cstddef>
+#include <utility>
+
+namespace demehin
+{
+  template< typename Key, typename T >
+  struct PersistentTreeNode
+  {
+    std::pair< Key, T > data;
+    PersistentTreeNode* left;
+    PersistentTreeNode* right;
+    int height;
+    size_t refs;
+
+    PersistentTreeNode(const std::pair< Key, T >&, PersistentTreeNode*, PersistentTreeNode*);
+  };
+
+  template< typename Key, typename T >
+  PersistentTreeNode< Key, T >::PersistentTreeNode(const std::pair< Key, T >& value,
+    PersistentTreeNode* lt, PersistentTreeNode* rt):
+    data(value),
+    left(lt),
+    right(rt),
+    height(1),
+    refs(1)
+  {}
+}
+
+#endif
@@ -0,0 +1,553 @@
+#ifndef PERSISTENT_TREE_HPP
+#define PERSISTENT_TREE_HPP
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+#include "persistent_node.hpp"
+#include "persistent_iterator.hpp"
+
+namespace demehin
+{
+  template< typename Key, typename T, typename Cmp = std::less< Key > >
+  class PersistentTree
+  {
+  public:
+    using cIter = PersistentIterator< Key, T, Cmp >;
+    using DataPair = std::pair< Key, T >;
+
+    PersistentTree() noexcept;
+    PersistentTree(const PersistentTree< Key, T, Cmp >&) noexcept;
+    PersistentTree(PersistentTree< Key, T, Cmp >&&) noexcept;
+
+    template< typename InputIt >
+    PersistentTree(InputIt, InputIt);
+
+    explicit PersistentTree(std::initializer_list< DataPair >);
+
+    ~PersistentTree();
+
+    PersistentTree< Key, T, Cmp >& operator=(const PersistentTree< Key, T, Cmp >&) noexcept;
+    PersistentTree< Key, T, Cmp >& operator=(PersistentTree< Key, T, Cmp >&&) noexcept;
+
+    std::pair< cIter, bool > insert(const DataPair&);
+    template< typename InputIt >
+    void insert(InputIt, InputIt);
+    size_t erase(const Key&);
+
+    const T& at(const Key&) const;
+    cIter find(const Key&) const noexcept;
+    size_t count(const Key&) const noexcept;
+
+    cIter begin() const;
+    cIter cbegin() const;
+    cIter end() const noexcept;
+    cIter cend() const noexcept;
+
+    size_t size() const noexcept;
+    bool empty() const noexcept;
+    void clear() noexcept;
+    void swap(PersistentTree< Key, T, Cmp >&) noexcept;
+
+  private:
+    using Node = demehin::PersistentTreeNode< Key, T >;
+
+    Node* root_;
+    Cmp cmp_;
+    size_t size_;
+
+    static Node* acquire(Node*) noexcept;
+    static void release(Node*) noexcept;
+    static int height(const Node*) noexcept;
+    static void updateHeight(Node*) noexcept;
+    static int getBalanceFactor(const Node*) noexcept;
+    static Node* copyWith(const Node*, Node*, Node*);
+    static void own(Node*&);
+    static Node* rotateRight(Node*) noexcept;
+    static Node* rotateLeft(Node*) noexcept;
+    static Node* balance(Node*);
+
+    const Node* findNode(const Key&) const noexcept;
+    Node* insertNode(const Node*, const DataPair&);
+    Node* eraseNode(const Node*, const Key&);
+    Node* eraseMin(const Node*, const Node*&);
+  };
+
+  template< typename Key, typename T, typename Cmp >
+  PersistentTree< Key, T, Cmp >::PersistentTree() noexcept:
+    root_(nullptr),
+    cmp_(),
+    size_(0)
+  {}
+
+  template< typename Key, typename T, typename Cmp >
+  PersistentTree< Key, T, Cmp >::PersistentTree(const PersistentTree< Key, T, Cmp >& other) noexcept:
+    root_(acquire(other.root_)),
+    cmp_(other.cmp_),
+    size_(other.size_)
+  {}
+
+  template< typename Key, typename T, typename Cmp >
+  PersistentTree< Key, T, Cmp >::PersistentTree(PersistentTree< Key, T, Cmp >&& other) noexcept:
+    root_(std::exchange(other.root_, nullptr)),
+    cmp_(std::move(other.cmp_)),
+    size_(std::exchange(other.size_, 0))
+  {}
+
+  template< typename Key, typename T, typename Cmp >
+  template< typename InputIt >
+  PersistentTree< Key, T, Cmp >::PersistentTree(InputIt first, InputIt last):
+    PersistentTree()
+  {
+    insert(first, last);
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  PersistentTree< Key, T, Cmp >::PersistentTree(std::initializer_list< DataPair > iList):
+    PersistentTree(iList.begin(), iList.end())
+  {}
+
+  template< typename Key, typename T, typename Cmp >
+  PersistentTree< Key, T, Cmp >::~PersistentTree()
+  {
+    release(root_);
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  PersistentTree< Key, T, Cmp >& PersistentTree< Key, T, Cmp >::operator=(const PersistentTree< Key, T, Cmp >& rhs) noexcept
+  {
+    PersistentTree< Key, T, Cmp > temp(rhs);
+    swap(temp);
+    return *this;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  PersistentTree< Key, T, Cmp >& PersistentTree< Key, T, Cmp >::operator=(PersistentTree< Key, T, Cmp >&& rhs) noexcept
+  {
+    PersistentTree< Key, T, Cmp > temp(std::move(rhs));
+    swap(temp);
+    return *this;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  std::pair< typename PersistentTree< Key, T, Cmp >::cIter, bool > PersistentTree< Key, T, Cmp >::insert(const DataPair& value)
+  {
+    cIter found = find(value.first);
+    if (found != cend())
+    {
+      return { found, false };
+    }
+    Node* newRoot = insertNode(root_, value);
+    release(root_);
+    root_ = newRoot;
+    size_++;
+    return { find(value.first), true };
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  template< typename InputIt >
+  void PersistentTree< Key, T, Cmp >::insert(InputIt first, InputIt last)
+  {
+    PersistentTree< Key, T, Cmp > temp(*this);
+    for (; first != last; first++)
+    {
+      temp.insert(*first);
+    }
+    swap(temp);
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  size_t PersistentTree< Key, T, Cmp >::erase(const Key& key)
+  {
+    if (findNode(key) == nullptr)
+    {
+      return 0;
+    }
+    Node* newRoot = eraseNode(root_, key);
+    release(root_);
+    root_ = newRoot;
+    size_--;
+    return 1;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  const T& PersistentTree< Key, T, Cmp >::at(const Key& key) const
+  {
+    const Node* node = findNode(key);
+    if (node == nullptr)
+    {
+      throw std::out_of_range("key not found");
+    }
+    return node->data.second;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::cIter PersistentTree< Key, T, Cmp >::find(const Key& key) const noexcept
+  {
+    cIter it;
+    const Node* current = root_;
+    while (current != nullptr)
+    {
+      if (cmp_(key, current->data.first))
+      {
+        it.stack_.push(current);
+        current = current->left;
+      }
+      else if (cmp_(current->data.first, key))
+      {
+        current = current->right;
+      }
+      else
+      {
+        it.node_ = current;
+        return it;
+      }
+    }
+    return cend();
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  size_t PersistentTree< Key, T, Cmp >::count(const Key& key) const noexcept
+  {
+    return findNode(key) != nullptr;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::cIter PersistentTree< Key, T, Cmp >::begin() const
+  {
+    return cbegin();
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::cIter PersistentTree< Key, T, Cmp >::cbegin() const
+  {
+    cIter it;
+    if (root_ != nullptr)
+    {
+      it.descendLeft(root_);
+    }
+    return it;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::cIter PersistentTree< Key, T, Cmp >::end() const noexcept
+  {
+    return cend();
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::cIter PersistentTree< Key, T, Cmp >::cend() const noexcept
+  {
+    return cIter(nullptr);
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  size_t PersistentTree< Key, T, Cmp >::size() const noexcept
+  {
+    return size_;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  bool PersistentTree< Key, T, Cmp >::empty() const noexcept
+  {
+    return size_ == 0;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  void PersistentTree< Key, T, Cmp >::clear() noexcept
+  {
+    release(root_);
+    root_ = nullptr;
+    size_ = 0;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  void PersistentTree< Key, T, Cmp >::swap(PersistentTree< Key, T, Cmp >& rhs) noexcept
+  {
+    std::swap(root_, rhs.root_);
+    std::swap(cmp_, rhs.cmp_);
+    std::swap(size_, rhs.size_);
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::Node* PersistentTree< Key, T, Cmp >::acquire(Node* node) noexcept
+  {
+    if (node != nullptr)
+    {
+      node->refs++;
+    }
+    return node;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  void PersistentTree< Key, T, Cmp >::release(Node* node) noexcept
+  {
+    while (node != nullptr && --node->refs == 0)
+    {
+      release(node->left);
+      Node* next = node->right;
+      delete node;
+      node = next;
+    }
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  int PersistentTree< Key, T, Cmp >::height(const Node* node) noexcept
+  {
+    return node == nullptr ? 0 : node->height;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  void PersistentTree< Key, T, Cmp >::updateHeight(Node* node) noexcept
+  {
+    node->height = 1 + std::max(height(node->left), height(node->right));
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  int PersistentTree< Key, T, Cmp >::getBalanceFactor(const Node* node) noexcept
+  {
+    return node == nullptr ? 0 : height(node->left) - height(node->right);
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::Node* PersistentTree< Key, T, Cmp >::copyWith(const Node* node, Node* lt, Node* rt)
+  {
+    Node* copy = new Node(node->data, lt, rt);
+    updateHeight(copy);
+    return copy;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  void PersistentTree< Key, T, Cmp >::own(Node*& node)
+  {
+    if (node->refs > 1)
+    {
+      Node* copy = copyWith(node, node->left, node->right);
+      acquire(copy->left);
+      acquire(copy->right);
+      node->refs--;
+      node = copy;
+    }
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::Node* PersistentTree< Key, T, Cmp >::rotateRight(Node* node) noexcept
+  {
+    Node* lt = node->left;
+    node->left = lt->right;
+    lt->right = node;
+    updateHeight(node);
+    updateHeight(lt);
+    return lt;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::Node* PersistentTree< Key, T, Cmp >::rotateLeft(Node* node) noexcept
+  {
+    Node* rt = node->right;
+    node->right = rt->left;
+    rt->left = node;
+    updateHeight(node);
+    updateHeight(rt);
+    return rt;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::Node* PersistentTree< Key, T, Cmp >::balance(Node* node)
+  {
+    updateHeight(node);
+    int balanceFactor = getBalanceFactor(node);
+
+    if (balanceFactor > 1)
+    {
+      own(node->left);
+      if (getBalanceFactor(node->left) < 0)
+      {
+        own(node->left->right);
+        node->left = rotateLeft(node->left);
+      }
+      return rotateRight(node);
+    }
+
+    if (balanceFactor < -1)
+    {
+      own(node->right);
+      if (getBalanceFactor(node->right) > 0)
+      {
+        own(node->right->left);
+        node->right = rotateRight(node->right);
+      }
+      return rotateLeft(node);
+    }
+
+    return node;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  const typename PersistentTree< Key, T, Cmp >::Node* PersistentTree< Key, T, Cmp >::findNode(const Key& key) const noexcept
+  {
+    const Node* current = root_;
+    while (current != nullptr)
+    {
+      if (cmp_(key, current->data.first))
+      {
+        current = current->left;
+      }
+      else if (cmp_(current->data.first, key))
+      {
+        current = current->right;
+      }
+      else
+      {
+        return current;
+      }
+    }
+    return nullptr;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::Node* PersistentTree< Key, T, Cmp >::insertNode(const Node* node, const DataPair& value)
+  {
+    if (node == nullptr)
+    {
+      return new Node(value, nullptr, nullptr);
+    }
+    Node* result = nullptr;
+    if (cmp_(value.first, node->data.first))
+    {
+      Node* lt = insertNode(node->left, value);
+      try
+      {
+        result = copyWith(node, lt, acquire(node->right));
+      }
+      catch (...)
+      {
+        release(lt);
+        release(node->right);
+        throw;
+      }
+    }
+    else if (cmp_(node->data.first, value.first))
+    {
+      Node* rt = insertNode(node->right, value);
+      try
+      {
+        result = copyWith(node, acquire(node->left), rt);
+      }
+      catch (...)
+      {
+        release(node->left);
+        release(rt);
+        throw;
+      }
+    }
+    else
+    {
+      result = new Node(value, acquire(node->left), acquire(node->right));
+      updateHeight(result);
+      return result;
+    }
+    try
+    {
+      return balance(result);
+    }
+    catch (...)
+    {
+      release(result);
+      throw;
+    }
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::Node* PersistentTree< Key, T, Cmp >::eraseMin(const Node* node, const Node*& min)
+  {
+    if (node->left == nullptr)
+    {
+      min = node;
+      return acquire(node->right);
+    }
+    Node* lt = eraseMin(node->left, min);
+    Node* result = nullptr;
+    try
+    {
+      result = copyWith(node, lt, acquire(node->right));
+    }
+    catch (...)
+    {
+      release(lt);
+      release(node->right);
+      throw;
+    }
+    try
+    {
+      return balance(result);
+    }
+    catch (...)
+    {
+      release(result);
+      throw;
+    }
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::Node* PersistentTree< Key, T, Cmp >::eraseNode(const Node* node, const Key& key)
+  {
+    Node* lt = nullptr;
+    Node* rt = nullptr;
+    const Node* source = node;
+    if (cmp_(key, node->data.first))
+    {
+      lt = eraseNode(node->left, key);
+      rt = acquire(node->right);
+    }
+    else if (cmp_(node->data.first, key))
+    {
+      lt = acquire(node->left);
+      try
+      {
+        rt = eraseNode(node->right, key);
+      }
+      catch (...)
+      {
+        release(lt);
+        throw;
+      }
+    }
+    else if (node->left == nullptr)
+    {
+      return acquire(node->right);
+    }
+    else if (node->right == nullptr)
+    {
+      return acquire(node->left);
+    }
+    else
+    {
+      rt = eraseMin(node->right, source);
+      lt = acquire(node->left);
+    }
+    Node* result = nullptr;
+    try
+    {
+      result = copyWith(source, lt, rt);
+    }
+    catch (...)
+    {
+      release(lt);
+      release(rt);
+      throw;
+    }
+    try
+    {
+      return balance(result);
+    }
+    catch (...)
+    {
+      release(result);
+      throw;
+    }
+  }
+}
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef TREE_HPP
 #define TREE_HPP
 #include <functional>
+#include <queue>
 #include <utility>
 #include "node.hpp"
 #include "iterator.hpp"
@@ -20,6 +21,7 @@ namespace demehin
     using DataPair = std::pair< Key, T >;
     using IterPair = std::pair< Iter, Iter >;
     using cIterPair = std::pair< cIter, cIter >;
+    using KeySum = typename TreeNode< Key, T >::KeySum;
 
     using LnrIter = LnrIterator< Key, T, Cmp, false >;
     using cLnrIter = LnrIterator< Key, T, Cmp, true >;
@@ -68,6 +70,8 @@ namespace demehin
     void clear() noexcept;
 
     size_t count(const Key&) const noexcept;
+    size_t count(const Key&, const Key&) const noexcept;
+    KeySum key_sum(const Key&, const Key&) const noexcept;
 
     Iter lower_bound(const Key&) noexcept;
     cIter lower_bound(const Key&) const noexcept;
@@ -117,6 +121,15 @@ namespace demehin
     template< typename F >
     F const_traverse_breadth(F) const;
 
+    template< typename F >
+    F traverse_lnr(const Key&, const Key&, F) const;
+
+    template< typename F >
+    F traverse_rnl(const Key&, const Key&, F) const;
+
+    template< typename F >
+    F traverse_breadth(const Key&, const Key&, F) const;
+
   private:
     using Node = demehin::TreeNode< Key, T >;
 
@@ -132,6 +145,9 @@ namespace demehin
     void balanceUpper(Node*) noexcept;
     int getBalanceFactor(Node*) const noexcept;
     void updateHeight(Node*) noexcept;
+    size_t subtreeCount(Node*) const noexcept;
+    KeySum subtreeKeys(Node*) const noexcept;
+    std::pair< size_t, KeySum > summBelow(const Key&, bool) const noexcept;
 
     template< typename Iterator, typename F >
     F traverse(F, Iterator, Iterator) const;
@@ -356,9 +372,23 @@ namespace demehin
     if (node != fakeRoot_ && node != nullptr)
     {
       node->height = 1 + std::max(height(node->left), height(node->right));
+      node->count = 1 + subtreeCount(node->left) + subtreeCount(node->right);
+      node->keys = subtreeKeys(node->left) + subtreeKeys(node->right) + static_cast< KeySum >(node->data.first);
     }
   }
 
+  template< typename Key, typename T, typename Cmp >
+  size_t Tree< Key, T, Cmp >::subtreeCount(Node* node) const noexcept
+  {
+    return (node == fakeRoot_ || node == nullptr) ? 0 : node->count;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename Tree< Key, T, Cmp >::KeySum Tree< Key, T, Cmp >::subtreeKeys(Node* node) const noexcept
+  {
+    return (node == fakeRoot_ || node == nullptr) ? KeySum() : node->keys;
+  }
+
   template< typename Key, typename T, typename Cmp >
   int Tree< Key, T, Cmp >::getBalanceFactor(Node* node) const noexcept
   {
@@ -715,8 +745,57 @@ namespace demehin
     return (find(key) != end());
   }
 
+  template< typename Key, typename T, typename Cmp >
+  std::pair< size_t, typename Tree< Key, T, Cmp >::KeySum > Tree< Key, T, Cmp >::summBelow(const Key& key, bool inclusive) const noexcept
+  {
+    size_t count = 0;
+    KeySum keys = KeySum();
+    Node* current = root_;
+    while (current != fakeRoot_ && current != nullptr)
+    {
+      bool isBelow = inclusive ? !cmp_(key, current->data.first) : cmp_(current->data.first, key);
+      if (isBelow)
+      {
+        count += subtreeCount(current->left) + 1;
+        keys = keys + subtreeKeys(current->left) + static_cast< KeySum >(current->data.first);
+        current = current->right;
+      }
+      else
+      {
+        current = current->left;
+      }
+    }
+    return std::make_pair(count, keys);
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  size_t Tree< Key, T, Cmp >::count(const Key& lo, const Key& hi) const noexcept
+  {
+    if (cmp_(hi, lo))
+    {
+      return 0;
+    }
+    return summBelow(hi, true).first - summBelow(lo, false).first;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename Tree< Key, T, Cmp >::KeySum Tree< Key, T, Cmp >::key_sum(const Key& lo, const Key& hi) const noexcept
+  {
+    if (cmp_(hi, lo))
+    {
+      return KeySum();
+    }
+    return summBelow(hi, true).second - summBelow(lo, false).second;
+  }
+
   template< typename Key, typename T, typename Cmp >
   typename Tree< Key, T, Cmp >::Iter Tree< Key, T, Cmp >::lower_bound(const Key& key) noexcept
+  {
+    return static_cast< const Tree< Key, T, Cmp >& >(*this).lower_bound(key);
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename Tree< Key, T, Cmp >::cIter Tree< Key, T, Cmp >::lower_bound(const Key& key) const noexcept
   {
     Node* current = root_;
     Node* res = fakeRoot_;
@@ -732,17 +811,17 @@ namespace demehin
         current = current->right;
       }
     }
-    return Iter(res);
+    return cIter(res);
   }
 
   template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::cIter Tree< Key, T, Cmp >::lower_bound(const Key& key) const noexcept
+  typename Tree< Key, T, Cmp >::Iter Tree< Key, T, Cmp >::upper_bound(const Key& key) noexcept
   {
-    return cIter(lower_bound(key));
+    return static_cast< const Tree< Key, T, Cmp >& >(*this).upper_bound(key);
   }
 
   template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::Iter Tree< Key, T, Cmp >::upper_bound(const Key& key) noexcept
+  typename Tree< Key, T, Cmp >::cIter Tree< Key, T, Cmp >::upper_bound(const Key& key) const noexcept
   {
     Node* current = root_;
     Node* res = fakeRoot_;
@@ -758,13 +837,7 @@ namespace demehin
         current = current->right;
       }
     }
-    return Iter(res);
-  }
-
-  template< typename Key, typename T, typename Cmp >
-  typename Tree< Key, T, Cmp >::cIter Tree< Key, T, Cmp >::upper_bound(const Key& key) const noexcept
-  {
-    return cIter(upper_bound(key));
+    return cIter(res);
   }
 
   template< typename Key, typename T, typename Cmp >
@@ -911,6 +984,62 @@ namespace demehin
     return traverse(f, cbrBegin(), cbrEnd());
   }
 
+  template< typename Key, typename T, typename Cmp >
+  template< typename F >
+  F Tree< Key, T, Cmp >::traverse_lnr(const Key& lo, const Key& hi, F f) const
+  {
+    for (auto it = lower_bound(lo); it != cend() && !cmp_(hi, it->first); it++)
+    {
+      f(*it);
+    }
+    return f;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  template< typename F >
+  F Tree< Key, T, Cmp >::traverse_rnl(const Key& lo, const Key& hi, F f) const
+  {
+    auto first = lower_bound(lo);
+    for (auto it = upper_bound(hi); it != first;)
+    {
+      --it;
+      f(*it);
+    }
+    return f;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  template< typename F >
+  F Tree< Key, T, Cmp >::traverse_breadth(const Key& lo, const Key& hi, F f) const
+  {
+    if (empty())
+    {
+      return f;
+    }
+    std::queue< const Node* > queue;
+    queue.push(root_);
+    while (!queue.empty())
+    {
+      const Node* node = queue.front();
+      queue.pop();
+      bool isAboveLo = !cmp_(node->data.first, lo);
+      bool isBelowHi = !cmp_(hi, node->data.first);
+      if (isAboveLo && isBelowHi)
+      {
+        f(node->data);
+      }
+      if (isAboveLo && node->left != nullptr)
+      {
+        queue.push(node->left);
+      }
+      if (isBelowHi && node->right != nullptr)
+      {
+        queue.push(node->right);
+      }
+    }
+    return f;
+  }
+
   template< typename Key, typename T, typename Cmp >
   template< typename Iterator, typename F >
   F Tree< Key, T, Cmp >::traverse(F f, Iterator begin, Iterator end) const
@@ -1,8 +1,10 @@
 #include "expr.hpp"
 #include <string>
 #include <limits>
-#include <cmath>
-#include <map>
+#include <cctype>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
 #include "stack.hpp"
 
 namespace
@@ -22,15 +24,17 @@ namespace
     return b <= std::numeric_limits< long long int >::min() / a;
   }
 
+  constexpr long long int powersOfTen[] = {
+    1LL, 10LL, 100LL, 1000LL, 10000LL, 100000LL, 1000000LL, 10000000LL, 100000000LL, 1000000000LL,
+    10000000000LL, 100000000000LL, 1000000000000LL, 10000000000000LL, 100000000000000LL,
+    1000000000000000LL, 10000000000000000LL, 100000000000000000LL, 1000000000000000000LL
+  };
+  constexpr int maxPower = sizeof(powersOfTen) / sizeof(powersOfTen[0]) - 1;
+
   int countDigits(long long int num)
   {
-    if (num == 0) {
-      return 1;
-    }
-    int count = 0;
-    num = std::abs(num);
-    while (num != 0) {
-      num /= 10;
+    int count = 1;
+    while (count <= maxPower && (num >= powersOfTen[count] || num <= -powersOfTen[count])) {
       count++;
     }
     return count;
@@ -72,50 +76,139 @@ namespace
     return false;
   }
 
-  bool checkConcatinationOverflow(long long int a, long long int b)
+  long long int add(long long int a, long long int b)
   {
-    int dif = countDigits(b);
-    bool result = checkMultiplyOverFLow(a, std::pow(10, dif));
-    if (!result) {
-      long long int preresult = a * std::pow(10, dif);
-      result = checkSumOverflow(preresult, b);
+    if (checkSumOverflow(a, b)) {
+      throw std::overflow_error("Addition overflow");
     }
-    return result;
+    return a + b;
   }
 
-  long long int concatination(long long int a, long long b)
+  long long int subtract(long long int a, long long int b)
   {
-    long long int result = a * std::pow(10, countDigits(b));
-    result += b;
-    return result;
+    if (checkSubOverflow(a, b)) {
+      throw std::overflow_error("Subtraction overflow");
+    }
+    return a - b;
   }
 
-  bool isOperator(const std::string& in)
+  long long int multiply(long long int a, long long int b)
   {
-    const std::string operations[6] = { "+", "-", "*", "/", "%", "|" };
-    for (std::string s: operations) {
-      if (in == s) {
-        return true;
-      }
+    if (checkMultiplyOverFLow(a, b)) {
+      throw std::overflow_error("Multiplication overflow");
     }
-    return false;
+    return a * b;
   }
 
-  bool getPrecedence(const std::string& lhs, const std::string& rhs)
+  long long int divide(long long int a, long long int b)
   {
-    std::map< std::string, int > precedence;
-    precedence["+"] = 1;
-    precedence["-"] = 1;
-    precedence["*"] = 2;
-    precedence["/"] = 2;
-    precedence["%"] = 3;
-    precedence["|"] = 4;
-    if (precedence.find(lhs) == precedence.end() || precedence.find(rhs) == precedence.end()) {
-      return false;
+    if (b == 0) {
+      throw std::runtime_error("Division by zero");
     }
-    return precedence[lhs] >= precedence[rhs];
+    if (checkDivOverflow(a, b)) {
+      throw std::overflow_error("Division overflow");
+    }
+    return a / b;
   }
+
+  long long int modulo(long long int a, long long int b)
+  {
+    if (b == 0) {
+      throw std::runtime_error("Division by zero");
+    }
+    if (checkDivOverflow(a, b)) {
+      throw std::overflow_error("Division overflow");
+    }
+    if (a >= 0) {
+      return a % b;
+    }
+    return (b - std::abs(a % b)) % b;
+  }
+
+  long long int concatination(long long int a, long long int b)
+  {
+    int digits = countDigits(b);
+    if (a == 0) {
+      return b;
+    }
+    if (digits > maxPower) {
+      throw std::overflow_error("Concatenation overflow");
+    }
+    long long int power = powersOfTen[digits];
+    if (a > std::numeric_limits< long long int >::max() / power || a < std::numeric_limits< long long int >::min() / power) {
+      throw std::overflow_error("Concatenation overflow");
+    }
+    if (checkSumOverflow(a * power, b)) {
+      throw std::overflow_error("Concatenation overflow");
+    }
+    return a * power + b;
+  }
+
+  struct Operator
+  {
+    int precedence;
+    bool rightAssociative;
+    dribas::OperatorKernel kernel;
+  };
+
+  struct OperatorTable
+  {
+    Operator byChar[256];
+  };
+
+  constexpr OperatorTable makeOperatorTable()
+  {
+    OperatorTable table{};
+    table.byChar['+'] = { 1, false, add };
+    table.byChar['-'] = { 1, false, subtract };
+    table.byChar['*'] = { 2, false, multiply };
+    table.byChar['/'] = { 2, false, divide };
+    table.byChar['%'] = { 3, false, modulo };
+    table.byChar['|'] = { 4, false, concatination };
+    return table;
+  }
+
+  OperatorTable& operators()
+  {
+    static OperatorTable table = makeOperatorTable();
+    return table;
+  }
+
+  const Operator* findOperator(const std::string& in)
+  {
+    if (in.size() != 1) {
+      return nullptr;
+    }
+    const Operator& op = operators().byChar[static_cast< unsigned char >(in[0])];
+    return op.kernel ? std::addressof(op) : nullptr;
+  }
+
+  bool getPrecedence(const Operator& top, const Operator& current)
+  {
+    if (current.rightAssociative) {
+      return top.precedence > current.precedence;
+    }
+    return top.precedence >= current.precedence;
+  }
+}
+
+void dribas::registerOperator(char symbol, int precedence, bool rightAssociative, OperatorKernel kernel)
+{
+  if (!kernel || std::isdigit(static_cast< unsigned char >(symbol)) || std::isspace(static_cast< unsigned char >(symbol))) {
+    throw std::invalid_argument("Invalid operator");
+  }
+  if (symbol == '(' || symbol == ')') {
+    throw std::invalid_argument("Invalid operator");
+  }
+  operators().byChar[static_cast< unsigned char >(symbol)] = { precedence, rightAssociative, kernel };
+}
+
+void dribas::unregisterOperator(char symbol) noexcept
+{
+  unsigned char index = static_cast< unsigned char >(symbol);
+  operators().byChar[index] = makeOperatorTable().byChar[index];
 }
+
 long long dribas::evaluatePostfix(Queue< std::string >& postfixQueue)
 {
   Stack< long long > operandStack;
@@ -124,7 +217,8 @@ long long dribas::evaluatePostfix(Queue< std::string >& postfixQueue)
     std::string token = postfixQueue.back();
     postfixQueue.pop();
 
-    if (isOperator(token)) {
+    const Operator* op = findOperator(token);
+    if (op) {
       if (operandStack.size() < 2) {
         throw std::runtime_error("Invalid postfix expression");
       }
@@ -132,45 +226,7 @@ long long dribas::evaluatePostfix(Queue< std::string >& postfixQueue)
       operandStack.pop();
       long long a = operandStack.top();
       operandStack.pop();
-      long long result = 0;
-      if (token == "|") {
-        if (checkConcatinationOverflow(a, b)) {
-          throw std::overflow_error("Concatenation overflow");
-        }
-        result = concatination(a, b);
-      } else if (token == "%") {
-        if (checkDivOverflow(a, b)) {
-          throw std::overflow_error("Division overflow");
-        }
-        if (a >= 0) {
-          result = a % b;
-        } else {
-          result = (b - std::abs(a % b)) % b;
-        }
-      } else if (token == "*") {
-        if (checkMultiplyOverFLow(a, b)) {
-          throw std::overflow_error("Multiplication overflow");
-        }
-        result = a * b;
-      } else if (token == "/") {
-        if (b == 0) {
-          throw std::runtime_error("Division by zero");
-        }
-        if (checkDivOverflow(a, b)) {
-          throw std::overflow_error("Division overflow");
-        }
-        result = a / b;
-      } else if (token == "+") {
-        if (checkSumOverflow(a, b)) {
-          throw std::overflow_error("Addition overflow");
-        }
-        result = a + b;
-      } else if (token == "-") {
-        if (checkSubOverflow(a, b)) {
-          throw std::overflow_error("Subtraction overflow");
-        }
-        result = a - b;
-      }
+      long long result = op->kernel(a, b);
       operandStack.push(result);
     } else {
       long long num = std::stoll(token);
@@ -206,8 +262,8 @@ dribas::Queue< std::string > dribas::infixToPostfix(Queue< std::string >& infixQ
       } else {
         operatorStack.pop();
       }
-    } else if (isOperator(token)) {
-      while (!operatorStack.empty() && operatorStack.top() != "(" && getPrecedence(operatorStack.top(), token)) {
+    } else if (const Operator* op = findOperator(token)) {
+      while (!operatorStack.empty() && operatorStack.top() != "(" && getPrecedence(*findOperator(operatorStack.top()), *op)) {
         postfixQueue.push(operatorStack.top());
         operatorStack.pop();
       }
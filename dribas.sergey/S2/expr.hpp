@@ -7,9 +7,13 @@
 
 namespace dribas
 {
+  using OperatorKernel = long long (*)(long long, long long);
+
   Queue< std::string > inputInfix(const std::string&);
   long long evaluatePostfix(Queue< std::string >&);
   Queue< std::string > infixToPostfix(Queue< std::string >&);
+  void registerOperator(char, int, bool, OperatorKernel);
+  void unregisterOperator(char) noexcept;
 
 }
 
@@ -2,6 +2,21 @@
 
 #include "expr.hpp"
 
+namespace
+{
+  struct OperatorGuard
+  {
+    explicit OperatorGuard(char symbol):
+      symbol(symbol)
+    {}
+    ~OperatorGuard()
+    {
+      dribas::unregisterOperator(symbol);
+    }
+    char symbol;
+  };
+}
+
 BOOST_AUTO_TEST_CASE(infixtopostfixTest)
 {
   dribas::Queue< std::string > queue1;
@@ -58,3 +73,61 @@ BOOST_AUTO_TEST_CASE(calcPostfix3)
   long long res = dribas::evaluatePostfix(queue2);
   BOOST_TEST(res == 10010);
 }
+
+BOOST_AUTO_TEST_CASE(concatinationLimits)
+{
+  dribas::Queue< std::string > queue1 = dribas::inputInfix("922337203685477580 | 7");
+  dribas::Queue< std::string > queue2 = dribas::infixToPostfix(queue1);
+  BOOST_TEST(dribas::evaluatePostfix(queue2) == 9223372036854775807LL);
+
+  queue1 = dribas::inputInfix("922337203685477580 | 8");
+  queue2 = dribas::infixToPostfix(queue1);
+  BOOST_CHECK_THROW(dribas::evaluatePostfix(queue2), std::overflow_error);
+
+  queue1 = dribas::inputInfix("1 | 1000000000000000000");
+  queue2 = dribas::infixToPostfix(queue1);
+  BOOST_CHECK_THROW(dribas::evaluatePostfix(queue2), std::overflow_error);
+
+  queue1 = dribas::inputInfix("0 | 1000000000000000000");
+  queue2 = dribas::infixToPostfix(queue1);
+  BOOST_TEST(dribas::evaluatePostfix(queue2) == 1000000000000000000LL);
+}
+
+BOOST_AUTO_TEST_CASE(registeredOperator)
+{
+  {
+    OperatorGuard guard('^');
+    dribas::registerOperator('^', 5, true, [](long long a, long long b)
+    {
+      long long result = 1;
+      for (long long i = 0; i < b; ++i) {
+        result *= a;
+      }
+      return result;
+    });
+    dribas::Queue< std::string > queue1 = dribas::inputInfix("2 ^ 3 ^ 2 + 1");
+    dribas::Queue< std::string > queue2 = dribas::infixToPostfix(queue1);
+    BOOST_TEST(dribas::evaluatePostfix(queue2) == 513);
+    BOOST_CHECK_THROW(dribas::registerOperator('(', 1, false, nullptr), std::invalid_argument);
+  }
+  dribas::Queue< std::string > queue1 = dribas::inputInfix("2 ^ 3");
+  dribas::Queue< std::string > queue2 = dribas::infixToPostfix(queue1);
+  BOOST_CHECK_THROW(dribas::evaluatePostfix(queue2), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(unregisterRestoresBuiltin)
+{
+  {
+    OperatorGuard guard('+');
+    dribas::registerOperator('+', 1, false, [](long long a, long long b)
+    {
+      return a * b;
+    });
+    dribas::Queue< std::string > queue1 = dribas::inputInfix("3 + 4");
+    dribas::Queue< std::string > queue2 = dribas::infixToPostfix(queue1);
+    BOOST_TEST(dribas::evaluatePostfix(queue2) == 12);
+  }
+  dribas::Queue< std::string > queue1 = dribas::inputInfix("3 + 4");
+  dribas::Queue< std::string > queue2 = dribas::infixToPostfix(queue1);
+  BOOST_TEST(dribas::evaluatePostfix(queue2) == 7);
+}
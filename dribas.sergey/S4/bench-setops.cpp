@@ -0,0 +1,171 @@
+#define BENCH_MAIN
+#include <harness.hpp>
+#include <iostream>
+#include <thread>
+#include <avlTree.hpp>
+
+namespace
+{
+  using tree = dribas::AVLTree< size_t, size_t >;
+
+  tree makeTree(size_t count, size_t step, size_t offset)
+  {
+    tree result;
+    for (size_t i = 0; i < count; ++i) {
+      result.insert(std::make_pair(i * step + offset, i));
+    }
+    return result;
+  }
+
+  tree loopUnite(const tree& first, const tree& second)
+  {
+    tree result = first;
+    for (auto it = second.begin(); it != second.end(); ++it) {
+      result.insert(*it);
+    }
+    return result;
+  }
+
+  tree loopIntersect(const tree& first, const tree& second)
+  {
+    tree result;
+    for (auto it = first.begin(); it != first.end(); ++it) {
+      if (second.find(it->first) != second.end()) {
+        result.insert(*it);
+      }
+    }
+    return result;
+  }
+
+  tree loopComplement(const tree& first, const tree& second)
+  {
+    tree result;
+    for (auto it = first.begin(); it != first.end(); ++it) {
+      if (second.find(it->first) == second.end()) {
+        result.insert(*it);
+      }
+    }
+    return result;
+  }
+
+  constexpr size_t count = 1000000;
+
+  struct Inputs
+  {
+    tree first = makeTree(count, 2, 0);
+    tree second = makeTree(count, 3, 0);
+    size_t threads = std::thread::hardware_concurrency();
+  };
+
+  const Inputs& inputs()
+  {
+    static const Inputs result;
+    return result;
+  }
+}
+
+BENCH_CASE(union_loop)
+{
+  const Inputs& in = inputs();
+  std::clog << count << " keys per tree, " << in.threads << " threads\n";
+  state.setItems(count * 2);
+  state.run([&in]()
+  {
+    tree result = loopUnite(in.first, in.second);
+    bench::doNotOptimize(result);
+  });
+}
+
+BENCH_CASE(union_join)
+{
+  const Inputs& in = inputs();
+  state.setItems(count * 2);
+  state.run([&in]()
+  {
+    tree result = in.first;
+    result.unite(in.second, 1);
+    bench::doNotOptimize(result);
+  });
+}
+
+BENCH_CASE(union_parallel)
+{
+  const Inputs& in = inputs();
+  state.setItems(count * 2);
+  state.run([&in]()
+  {
+    tree result = in.first;
+    result.unite(in.second, in.threads);
+    bench::doNotOptimize(result);
+  });
+}
+
+BENCH_CASE(intersect_loop)
+{
+  const Inputs& in = inputs();
+  state.setItems(count * 2);
+  state.run([&in]()
+  {
+    tree result = loopIntersect(in.first, in.second);
+    bench::doNotOptimize(result);
+  });
+}
+
+BENCH_CASE(intersect_join)
+{
+  const Inputs& in = inputs();
+  state.setItems(count * 2);
+  state.run([&in]()
+  {
+    tree result = in.first;
+    result.intersect(in.second, 1);
+    bench::doNotOptimize(result);
+  });
+}
+
+BENCH_CASE(intersect_parallel)
+{
+  const Inputs& in = inputs();
+  state.setItems(count * 2);
+  state.run([&in]()
+  {
+    tree result = in.first;
+    result.intersect(in.second, in.threads);
+    bench::doNotOptimize(result);
+  });
+}
+
+BENCH_CASE(complement_loop)
+{
+  const Inputs& in = inputs();
+  state.setItems(count * 2);
+  state.run([&in]()
+  {
+    tree result = loopComplement(in.first, in.second);
+    bench::doNotOptimize(result);
+  });
+}
+
+BENCH_CASE(complement_join)
+{
+  const Inputs& in = inputs();
+  state.setItems(count * 2);
+  state.run([&in]()
+  {
+    tree result = in.first;
+    result.subtract(in.second, 1);
+    bench::doNotOptimize(result);
+  });
+}
+
+BENCH_CASE(complement_parallel)
+{
+  const Inputs& in = inputs();
+  state.setItems(count * 2);
+  state.run([&in]()
+  {
+    tree result = in.first;
+    result.subtract(in.second, in.threads);
+    bench::doNotOptimize(result);
+  });
+}
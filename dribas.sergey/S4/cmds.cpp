@@ -20,42 +20,25 @@ void dribas::complement(std::istream& input, dataset& setOfData)
 {
   std::string newName, firstName, secondName;
   input >> newName >> firstName >> secondName;
-  data newTree;
-  auto firstTree = setOfData.at(firstName);
-  auto secondTree = setOfData.at(secondName);
-  for (auto it = firstTree.begin(); it != firstTree.end(); ++it) {
-    if (secondTree.find(it->first) == secondTree.end()) {
-      newTree.insert(*it);
-    }
-  }
-  setOfData[newName] = newTree;
+  data newTree = setOfData.at(firstName);
+  newTree.subtract(setOfData.at(secondName));
+  setOfData[newName] = std::move(newTree);
 }
 
 void dribas::intersect(std::istream& input, dataset& setOfData)
 {
   std::string newName, firstName, secondName;
   input >> newName >> firstName >> secondName;
-  data newTree;
-  auto firstTree = setOfData.at(firstName);
-  auto secondTree = setOfData.at(secondName);
-  for (auto it = firstTree.begin(); it != firstTree.end(); ++it) {
-    if (secondTree.find(it->first) != secondTree.end()) {
-      newTree.insert(*it);
-    }
-  }
-  setOfData[newName] = newTree;
+  data newTree = setOfData.at(firstName);
+  newTree.intersect(setOfData.at(secondName));
+  setOfData[newName] = std::move(newTree);
 }
 
 void dribas::unite(std::istream& input, dataset& setOfData)
 {
   std::string newName, firstName, secondName;
   input >> newName >> firstName >> secondName;
-  auto firstTree = setOfData.at(firstName);
-  auto secondTree = setOfData.at(secondName);
-  data newTree = firstTree;
-  for (auto it = secondTree.begin(); it != secondTree.end(); ++it)
-  {
-    newTree.insert(*it);
-  }
-  setOfData[newName] = newTree;
+  data newTree = setOfData.at(firstName);
+  newTree.unite(setOfData.at(secondName));
+  setOfData[newName] = std::move(newTree);
 }
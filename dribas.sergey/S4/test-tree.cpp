@@ -1,4 +1,6 @@
 #include <boost/test/unit_test.hpp>
+#include <map>
+#include <thread>
 #include <avlTree.hpp>
 
 using namespace dribas;
@@ -417,3 +419,113 @@ BOOST_AUTO_TEST_CASE(DuplicateKeysTest)
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(SetOperationTests)
+
+bool isSame(const AVLTree< int, int >& tree, const std::map< int, int >& expected)
+{
+  if (tree.size() != expected.size()) {
+    return false;
+  }
+  auto it = expected.begin();
+  for (auto node = tree.begin(); node != tree.end(); ++node, ++it) {
+    if (node->first != it->first || node->second != it->second) {
+      return false;
+    }
+  }
+  return true;
+}
+
+BOOST_AUTO_TEST_CASE(UniteKeepsFirstValues)
+{
+  AVLTree< int, std::string > first({{1, "a"}, {3, "c"}});
+  AVLTree< int, std::string > second({{1, "x"}, {2, "b"}, {4, "d"}});
+  first.unite(second);
+  BOOST_CHECK_EQUAL(first.size(), 4);
+  BOOST_CHECK_EQUAL(first.at(1), "a");
+  BOOST_CHECK_EQUAL(first.at(2), "b");
+  BOOST_CHECK_EQUAL(first.at(4), "d");
+  BOOST_CHECK_EQUAL(second.size(), 3);
+  BOOST_CHECK_EQUAL(second.at(1), "x");
+}
+
+BOOST_AUTO_TEST_CASE(IntersectAndSubtract)
+{
+  AVLTree< int, std::string > first({{1, "a"}, {2, "b"}, {3, "c"}, {4, "d"}});
+  AVLTree< int, std::string > second({{2, "x"}, {4, "y"}, {5, "z"}});
+  AVLTree< int, std::string > common(first);
+  common.intersect(second);
+  BOOST_CHECK_EQUAL(common.size(), 2);
+  BOOST_CHECK_EQUAL(common.at(2), "b");
+  BOOST_CHECK_EQUAL(common.at(4), "d");
+  first.subtract(second);
+  BOOST_CHECK_EQUAL(first.size(), 2);
+  BOOST_CHECK_EQUAL(first.at(1), "a");
+  BOOST_CHECK_EQUAL(first.at(3), "c");
+  first.subtract(first);
+  BOOST_CHECK(first.empty());
+}
+
+BOOST_AUTO_TEST_CASE(ParallelSetOperations)
+{
+  AVLTree< int, int > first;
+  AVLTree< int, int > second;
+  std::map< int, int > united;
+  std::map< int, int > common;
+  std::map< int, int > rest;
+  for (int i = 0; i < 60000; ++i) {
+    int key = (i * 7919) % 60000;
+    if (key % 3 != 0) {
+      first.insert({key, key});
+      united.insert({key, key});
+      rest.insert({key, key});
+    }
+    if (key % 2 == 0) {
+      second.insert({key, -key});
+      united.insert({key, -key});
+      if (key % 3 != 0) {
+        common.insert({key, key});
+        rest.erase(key);
+      }
+    }
+  }
+  AVLTree< int, int > unionTree(first);
+  unionTree.unite(second, 4);
+  AVLTree< int, int > intersectTree(first);
+  intersectTree.intersect(second, 4);
+  AVLTree< int, int > subtractTree(first);
+  subtractTree.subtract(second, 4);
+  BOOST_CHECK(isSame(unionTree, united));
+  BOOST_CHECK(isSame(intersectTree, common));
+  BOOST_CHECK(isSame(subtractTree, rest));
+  auto last = unionTree.end();
+  --last;
+  BOOST_CHECK_EQUAL(last->first, united.rbegin()->first);
+}
+
+BOOST_AUTO_TEST_CASE(SharedPoolConcurrentSetOperations)
+{
+  BOOST_CHECK_EQUAL(std::addressof(ThreadPool::shared(4)), std::addressof(ThreadPool::shared(4)));
+  BOOST_CHECK_EQUAL(ThreadPool::shared(3).size(), 3);
+  AVLTree< int, int > first;
+  AVLTree< int, int > second;
+  std::map< int, int > united;
+  for (int i = 0; i < 40000; ++i) {
+    first.insert({2 * i, i});
+    second.insert({2 * i + 1, i});
+    united.insert({2 * i, i});
+    united.insert({2 * i + 1, i});
+  }
+  AVLTree< int, int > left(first);
+  AVLTree< int, int > right(first);
+  std::thread other([&right, &second]()
+  {
+    right.unite(second, 4);
+  });
+  left.unite(second, 4);
+  other.join();
+  BOOST_CHECK(isSame(left, united));
+  BOOST_CHECK(isSame(right, united));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
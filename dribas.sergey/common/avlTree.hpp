@@ -5,12 +5,15 @@
 #include <cstddef>
 #include <stdexcept>
 #include <algorithm>
+#include <memory>
+#include <thread>
 #include <utility>
 
 #include "iterator.hpp"
 #include "constIterator.hpp"
 #include "stack.hpp"
 #include "queue.hpp"
+#include "threadPool.hpp"
 
 namespace dribas
 {
@@ -27,6 +30,7 @@ namespace dribas
     int height;
     bool isFake;
     Node(const std::pair< Key, T >&, Node< Key, T >*);
+    Node(const std::pair< Key, T >&, Node< Key, T >*, Node< Key, T >*);
     Node();
     template< class... Args >
     Node(Node< Key, T >* fakeleaf, Args&&... args);
@@ -56,6 +60,16 @@ namespace dribas
     isFake(true)
   {}
 
+  template< class Key, class T >
+  Node< Key, T >::Node(const std::pair< Key, T >& val, Node< Key, T >* leftNode, Node< Key, T >* rightNode):
+    value(val),
+    left(leftNode),
+    right(rightNode),
+    parent(nullptr),
+    height(1),
+    isFake(false)
+  {}
+
   template< class Key, class T >
   Node< Key, T >::Node(const std::pair< Key, T >& val, Node< Key, T >* fakeleaf):
     value(val),
@@ -129,6 +143,10 @@ namespace dribas
     const_iterator find(const Key&) const;
     size_t count(const Key&) const;
 
+    void unite(const TreeType&, size_t = std::thread::hardware_concurrency());
+    void intersect(const TreeType&, size_t = std::thread::hardware_concurrency());
+    void subtract(const TreeType&, size_t = std::thread::hardware_concurrency());
+
     template< class F >
     F traverse_lnr(F) const;
     template< class F >
@@ -157,6 +175,26 @@ namespace dribas
     void clearSubtree(NodeType*) noexcept;
     NodeType* removeNode(NodeType*, const Key&);
     NodeType* findMin(NodeType*);
+
+    static constexpr int parallelHeight = 12;
+    static constexpr size_t parallelSize = 1 << 15;
+    ThreadPool* sharedPool(const TreeType&, size_t) const;
+    template< class F, class G >
+    void fork(ThreadPool*, const NodeType*, const NodeType*, F&&, G&&);
+    void finish(NodeType*, size_t) noexcept;
+    NodeType* link(NodeType*, NodeType*, NodeType*) noexcept;
+    NodeType* leftRotateSubtree(NodeType*) noexcept;
+    NodeType* rightRotateSubtree(NodeType*) noexcept;
+    NodeType* joinLeft(NodeType*, NodeType*, NodeType*) noexcept;
+    NodeType* joinRight(NodeType*, NodeType*, NodeType*) noexcept;
+    NodeType* joinNodes(NodeType*, NodeType*, NodeType*) noexcept;
+    NodeType* joinNodes(NodeType*, NodeType*) noexcept;
+    void splitNodes(NodeType*, const Key&, NodeType*&, NodeType*&, NodeType*&) noexcept;
+    NodeType* splitLast(NodeType*, NodeType*&) noexcept;
+    NodeType* cloneNodes(const NodeType*, const NodeType*, ThreadPool*);
+    NodeType* uniteNodes(NodeType*, NodeType*, ThreadPool*, size_t&);
+    NodeType* intersectNodes(NodeType*, const NodeType*, const NodeType*, ThreadPool*, size_t&);
+    NodeType* subtractNodes(NodeType*, const NodeType*, const NodeType*, ThreadPool*, size_t&);
   };
 
   template< class Key, class T, class Cmp >
@@ -541,8 +579,11 @@ namespace dribas
     cmp_(other.cmp_),
     size_(0)
   {
-    for (const auto& pair: other) {
-      this->insert(pair);
+    try {
+      finish(cloneNodes(other.root_, other.fakeleaf_, nullptr), other.size_);
+    } catch (const std::exception&) {
+      delete fakeleaf_;
+      throw;
     }
   }
 
@@ -923,5 +964,322 @@ namespace dribas
     }
   }
 
+  template< class Key, class T, class Cmp >
+  void AVLTree< Key, T, Cmp >::unite(const TreeType& other, size_t threads)
+  {
+    if (this == std::addressof(other)) {
+      return;
+    }
+    ThreadPool* pool = sharedPool(other, threads);
+    NodeType* copy = cloneNodes(other.root_, other.fakeleaf_, pool);
+    size_t common = 0;
+    NodeType* result = uniteNodes(root_, copy, pool, common);
+    finish(result, size_ + other.size_ - common);
+  }
+
+  template< class Key, class T, class Cmp >
+  void AVLTree< Key, T, Cmp >::intersect(const TreeType& other, size_t threads)
+  {
+    if (this == std::addressof(other)) {
+      return;
+    }
+    ThreadPool* pool = sharedPool(other, threads);
+    size_t common = 0;
+    NodeType* result = intersectNodes(root_, other.root_, other.fakeleaf_, pool, common);
+    finish(result, common);
+  }
+
+  template< class Key, class T, class Cmp >
+  void AVLTree< Key, T, Cmp >::subtract(const TreeType& other, size_t threads)
+  {
+    if (this == std::addressof(other)) {
+      clear();
+      return;
+    }
+    ThreadPool* pool = sharedPool(other, threads);
+    size_t common = 0;
+    NodeType* result = subtractNodes(root_, other.root_, other.fakeleaf_, pool, common);
+    finish(result, size_ - common);
+  }
+
+  template< class Key, class T, class Cmp >
+  ThreadPool* AVLTree< Key, T, Cmp >::sharedPool(const TreeType& other, size_t threads) const
+  {
+    if (threads < 2 || size_ + other.size_ < parallelSize) {
+      return nullptr;
+    }
+    return std::addressof(ThreadPool::shared(threads));
+  }
+
+  template< class Key, class T, class Cmp >
+  template< class F, class G >
+  void AVLTree< Key, T, Cmp >::fork(ThreadPool* pool, const NodeType* mine, const NodeType* theirs, F&& left, G&& right)
+  {
+    if (pool != nullptr && mine->height >= parallelHeight && theirs->height >= parallelHeight) {
+      pool->invoke(left, right);
+    } else {
+      left();
+      right();
+    }
+  }
+
+  template< class Key, class T, class Cmp >
+  void AVLTree< Key, T, Cmp >::finish(NodeType* root, size_t size) noexcept
+  {
+    root_ = root;
+    if (root_ != fakeleaf_) {
+      root_->parent = nullptr;
+    }
+    size_ = size;
+  }
+
+  template< class Key, class T, class Cmp >
+  Node< Key, T >* AVLTree< Key, T, Cmp >::link(NodeType* left, NodeType* node, NodeType* right) noexcept
+  {
+    node->left = left;
+    node->right = right;
+    if (left != fakeleaf_) {
+      left->parent = node;
+    }
+    if (right != fakeleaf_) {
+      right->parent = node;
+    }
+    node->height = std::max(left->height, right->height) + 1;
+    return node;
+  }
+
+  template< class Key, class T, class Cmp >
+  Node< Key, T >* AVLTree< Key, T, Cmp >::leftRotateSubtree(NodeType* node) noexcept
+  {
+    NodeType* rightNode = node->right;
+    return link(link(node->left, node, rightNode->left), rightNode, rightNode->right);
+  }
+
+  template< class Key, class T, class Cmp >
+  Node< Key, T >* AVLTree< Key, T, Cmp >::rightRotateSubtree(NodeType* node) noexcept
+  {
+    NodeType* leftNode = node->left;
+    return link(leftNode->left, leftNode, link(leftNode->right, node, node->right));
+  }
+
+  template< class Key, class T, class Cmp >
+  Node< Key, T >* AVLTree< Key, T, Cmp >::joinRight(NodeType* left, NodeType* middle, NodeType* right) noexcept
+  {
+    NodeType* outer = left->left;
+    NodeType* inner = left->right;
+    if (inner->height <= right->height + 1) {
+      NodeType* joined = link(inner, middle, right);
+      if (joined->height <= outer->height + 1) {
+        return link(outer, left, joined);
+      }
+      return leftRotateSubtree(link(outer, left, rightRotateSubtree(joined)));
+    }
+    NodeType* joined = joinRight(inner, middle, right);
+    link(outer, left, joined);
+    if (joined->height <= outer->height + 1) {
+      return left;
+    }
+    return leftRotateSubtree(left);
+  }
+
+  template< class Key, class T, class Cmp >
+  Node< Key, T >* AVLTree< Key, T, Cmp >::joinLeft(NodeType* left, NodeType* middle, NodeType* right) noexcept
+  {
+    NodeType* outer = right->right;
+    NodeType* inner = right->left;
+    if (inner->height <= left->height + 1) {
+      NodeType* joined = link(left, middle, inner);
+      if (joined->height <= outer->height + 1) {
+        return link(joined, right, outer);
+      }
+      return rightRotateSubtree(link(leftRotateSubtree(joined), right, outer));
+    }
+    NodeType* joined = joinLeft(left, middle, inner);
+    link(joined, right, outer);
+    if (joined->height <= outer->height + 1) {
+      return right;
+    }
+    return rightRotateSubtree(right);
+  }
+
+  template< class Key, class T, class Cmp >
+  Node< Key, T >* AVLTree< Key, T, Cmp >::joinNodes(NodeType* left, NodeType* middle, NodeType* right) noexcept
+  {
+    if (left->height > right->height + 1) {
+      return joinRight(left, middle, right);
+    }
+    if (right->height > left->height + 1) {
+      return joinLeft(left, middle, right);
+    }
+    return link(left, middle, right);
+  }
+
+  template< class Key, class T, class Cmp >
+  Node< Key, T >* AVLTree< Key, T, Cmp >::joinNodes(NodeType* left, NodeType* right) noexcept
+  {
+    if (left == fakeleaf_) {
+      return right;
+    }
+    NodeType* last = nullptr;
+    NodeType* rest = splitLast(left, last);
+    return joinNodes(rest, last, right);
+  }
+
+  template< class Key, class T, class Cmp >
+  void AVLTree< Key, T, Cmp >::splitNodes(NodeType* node, const Key& key,
+    NodeType*& less, NodeType*& found, NodeType*& greater) noexcept
+  {
+    if (node == fakeleaf_) {
+      less = fakeleaf_;
+      found = nullptr;
+      greater = fakeleaf_;
+    } else if (cmp_(key, node->value.first)) {
+      NodeType* rest = nullptr;
+      splitNodes(node->left, key, less, found, rest);
+      greater = joinNodes(rest, node, node->right);
+    } else if (cmp_(node->value.first, key)) {
+      NodeType* rest = nullptr;
+      splitNodes(node->right, key, rest, found, greater);
+      less = joinNodes(node->left, node, rest);
+    } else {
+      less = node->left;
+      found = node;
+      greater = node->right;
+    }
+  }
+
+  template< class Key, class T, class Cmp >
+  Node< Key, T >* AVLTree< Key, T, Cmp >::splitLast(NodeType* node, NodeType*& last) noexcept
+  {
+    if (node->right == fakeleaf_) {
+      last = node;
+      return node->left;
+    }
+    NodeType* rest = splitLast(node->right, last);
+    return joinNodes(node->left, node, rest);
+  }
+
+  template< class Key, class T, class Cmp >
+  Node< Key, T >* AVLTree< Key, T, Cmp >::cloneNodes(const NodeType* node, const NodeType* leaf, ThreadPool* pool)
+  {
+    if (node == leaf) {
+      return fakeleaf_;
+    }
+    NodeType* result = new NodeType(node->value, fakeleaf_, fakeleaf_);
+    NodeType* left = fakeleaf_;
+    NodeType* right = fakeleaf_;
+    try {
+      fork(pool, node, node, [&]()
+      {
+        left = cloneNodes(node->left, leaf, pool);
+      }, [&]()
+      {
+        right = cloneNodes(node->right, leaf, pool);
+      });
+    } catch (const std::exception&) {
+      clearSubtree(left);
+      clearSubtree(right);
+      delete result;
+      throw;
+    }
+    return link(left, result, right);
+  }
+
+  template< class Key, class T, class Cmp >
+  Node< Key, T >* AVLTree< Key, T, Cmp >::uniteNodes(NodeType* mine, NodeType* theirs, ThreadPool* pool, size_t& common)
+  {
+    if (mine == fakeleaf_) {
+      return theirs;
+    }
+    if (theirs == fakeleaf_) {
+      return mine;
+    }
+    NodeType* less = nullptr;
+    NodeType* found = nullptr;
+    NodeType* greater = nullptr;
+    splitNodes(mine, theirs->value.first, less, found, greater);
+    NodeType* left = fakeleaf_;
+    NodeType* right = fakeleaf_;
+    size_t leftCommon = 0;
+    size_t rightCommon = 0;
+    fork(pool, mine, theirs, [&]()
+    {
+      left = uniteNodes(less, theirs->left, pool, leftCommon);
+    }, [&]()
+    {
+      right = uniteNodes(greater, theirs->right, pool, rightCommon);
+    });
+    common += leftCommon + rightCommon;
+    if (found == nullptr) {
+      return joinNodes(left, theirs, right);
+    }
+    ++common;
+    delete theirs;
+    return joinNodes(left, found, right);
+  }
+
+  template< class Key, class T, class Cmp >
+  Node< Key, T >* AVLTree< Key, T, Cmp >::intersectNodes(NodeType* mine, const NodeType* theirs,
+    const NodeType* leaf, ThreadPool* pool, size_t& common)
+  {
+    if (mine == fakeleaf_) {
+      return fakeleaf_;
+    }
+    if (theirs == leaf) {
+      clearSubtree(mine);
+      return fakeleaf_;
+    }
+    NodeType* less = nullptr;
+    NodeType* found = nullptr;
+    NodeType* greater = nullptr;
+    splitNodes(mine, theirs->value.first, less, found, greater);
+    NodeType* left = fakeleaf_;
+    NodeType* right = fakeleaf_;
+    size_t leftCommon = 0;
+    size_t rightCommon = 0;
+    fork(pool, mine, theirs, [&]()
+    {
+      left = intersectNodes(less, theirs->left, leaf, pool, leftCommon);
+    }, [&]()
+    {
+      right = intersectNodes(greater, theirs->right, leaf, pool, rightCommon);
+    });
+    common += leftCommon + rightCommon;
+    if (found == nullptr) {
+      return joinNodes(left, right);
+    }
+    ++common;
+    return joinNodes(left, found, right);
+  }
+
+  template< class Key, class T, class Cmp >
+  Node< Key, T >* AVLTree< Key, T, Cmp >::subtractNodes(NodeType* mine, const NodeType* theirs,
+    const NodeType* leaf, ThreadPool* pool, size_t& common)
+  {
+    if (mine == fakeleaf_ || theirs == leaf) {
+      return mine;
+    }
+    NodeType* less = nullptr;
+    NodeType* found = nullptr;
+    NodeType* greater = nullptr;
+    splitNodes(mine, theirs->value.first, less, found, greater);
+    NodeType* left = fakeleaf_;
+    NodeType* right = fakeleaf_;
+    size_t leftCommon = 0;
+    size_t rightCommon = 0;
+    fork(pool, mine, theirs, [&]()
+    {
+      left = subtractNodes(less, theirs->left, leaf, pool, leftCommon);
+    }, [&]()
+    {
+      right = subtractNodes(greater, theirs->right, leaf, pool, rightCommon);
+    });
+    common += leftCommon + rightCommon;
+    if (found != nullptr) {
+      ++common;
+      delete found;
+    }
+    return joinNodes(left, right);
+  }
 }
 #endif
@@ -0,0 +1,276 @@
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace dribas
+{
+  class ThreadPool
+  {
+  public:
+    explicit ThreadPool(size_t);
+    ThreadPool(const ThreadPool&) = delete;
+    ~ThreadPool();
+
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    static ThreadPool& shared(size_t);
+
+    size_t size() const noexcept;
+
+    template< class F, class G >
+    void invoke(F&&, G&&);
+
+  private:
+    struct Task
+    {
+      void (*run)(void*);
+      void* data;
+      std::atomic< bool > done;
+      std::exception_ptr error;
+    };
+    struct Deque
+    {
+      std::mutex mutex;
+      std::vector< Task* > tasks;
+    };
+
+    static constexpr size_t capacity = 256;
+    std::vector< std::unique_ptr< Deque > > deques_;
+    std::vector< std::thread > threads_;
+    std::atomic< bool > stop_;
+    std::atomic< size_t > pending_;
+    std::mutex sleepMutex_;
+    std::condition_variable wake_;
+
+    void work(size_t) noexcept;
+    void stop() noexcept;
+    void notify() noexcept;
+    size_t self() const noexcept;
+    bool push(size_t, Task*);
+    bool reclaim(size_t, Task*);
+    bool runOne(size_t) noexcept;
+    void execute(Task*) noexcept;
+    static const ThreadPool*& owner() noexcept;
+    static size_t& index() noexcept;
+  };
+
+  inline ThreadPool::ThreadPool(size_t threads):
+    deques_(),
+    threads_(),
+    stop_(false),
+    pending_(0),
+    sleepMutex_(),
+    wake_()
+  {
+    threads = std::max< size_t >(threads, 1);
+    for (size_t i = 0; i < threads; ++i) {
+      deques_.push_back(std::unique_ptr< Deque >(new Deque()));
+      deques_.back()->tasks.reserve(capacity);
+    }
+    try {
+      for (size_t i = 1; i < threads; ++i) {
+        threads_.emplace_back(&ThreadPool::work, this, i);
+      }
+    } catch (const std::exception&) {
+      stop();
+      throw;
+    }
+  }
+
+  inline ThreadPool::~ThreadPool()
+  {
+    stop();
+  }
+
+  inline ThreadPool& ThreadPool::shared(size_t threads)
+  {
+    static std::mutex mutex;
+    static std::vector< std::unique_ptr< ThreadPool > > pools;
+    threads = std::max< size_t >(threads, 1);
+    std::lock_guard< std::mutex > lock(mutex);
+    for (size_t i = 0; i < pools.size(); ++i) {
+      if (pools[i]->size() == threads) {
+        return *pools[i];
+      }
+    }
+    pools.push_back(std::unique_ptr< ThreadPool >(new ThreadPool(threads)));
+    return *pools.back();
+  }
+
+  inline size_t ThreadPool::size() const noexcept
+  {
+    return deques_.size();
+  }
+
+  template< class F, class G >
+  void ThreadPool::invoke(F&& left, G&& right)
+  {
+    using LeftType = typename std::remove_reference< F >::type;
+    Task task;
+    task.run = [](void* data)
+    {
+      (*static_cast< LeftType* >(data))();
+    };
+    task.data = std::addressof(left);
+    task.done.store(false);
+    size_t current = self();
+    if (!push(current, std::addressof(task))) {
+      left();
+      right();
+      return;
+    }
+    std::exception_ptr error;
+    try {
+      right();
+    } catch (...) {
+      error = std::current_exception();
+    }
+    if (reclaim(current, std::addressof(task))) {
+      execute(std::addressof(task));
+    }
+    while (!task.done.load(std::memory_order_acquire)) {
+      if (!runOne(current)) {
+        std::unique_lock< std::mutex > lock(sleepMutex_);
+        wake_.wait(lock, [this, &task]()
+        {
+          return task.done.load(std::memory_order_acquire) || pending_.load(std::memory_order_acquire) != 0;
+        });
+      }
+    }
+    if (task.error) {
+      std::rethrow_exception(task.error);
+    }
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+  inline void ThreadPool::work(size_t current) noexcept
+  {
+    owner() = this;
+    index() = current;
+    while (!stop_.load(std::memory_order_acquire)) {
+      if (!runOne(current)) {
+        std::unique_lock< std::mutex > lock(sleepMutex_);
+        wake_.wait(lock, [this]()
+        {
+          return stop_.load(std::memory_order_acquire) || pending_.load(std::memory_order_acquire) != 0;
+        });
+      }
+    }
+  }
+
+  inline void ThreadPool::stop() noexcept
+  {
+    stop_.store(true, std::memory_order_release);
+    notify();
+    for (size_t i = 0; i < threads_.size(); ++i) {
+      threads_[i].join();
+    }
+  }
+
+  inline void ThreadPool::notify() noexcept
+  {
+    {
+      std::lock_guard< std::mutex > lock(sleepMutex_);
+    }
+    wake_.notify_all();
+  }
+
+  inline size_t ThreadPool::self() const noexcept
+  {
+    return owner() == this ? index() : 0;
+  }
+
+  inline bool ThreadPool::push(size_t current, Task* task)
+  {
+    {
+      Deque& deque = *deques_[current];
+      std::lock_guard< std::mutex > lock(deque.mutex);
+      if (deque.tasks.size() == deque.tasks.capacity()) {
+        return false;
+      }
+      deque.tasks.push_back(task);
+      pending_.fetch_add(1, std::memory_order_release);
+    }
+    notify();
+    return true;
+  }
+
+  inline bool ThreadPool::reclaim(size_t current, Task* task)
+  {
+    Deque& deque = *deques_[current];
+    std::lock_guard< std::mutex > lock(deque.mutex);
+    for (size_t i = deque.tasks.size(); i > 0; --i) {
+      if (deque.tasks[i - 1] == task) {
+        deque.tasks.erase(deque.tasks.begin() + (i - 1));
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  inline bool ThreadPool::runOne(size_t current) noexcept
+  {
+    Task* task = nullptr;
+    {
+      Deque& deque = *deques_[current];
+      std::lock_guard< std::mutex > lock(deque.mutex);
+      if (!deque.tasks.empty()) {
+        task = deque.tasks.back();
+        deque.tasks.pop_back();
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+      }
+    }
+    for (size_t i = 1; task == nullptr && i < deques_.size(); ++i) {
+      Deque& victim = *deques_[(current + i) % deques_.size()];
+      std::lock_guard< std::mutex > lock(victim.mutex);
+      if (!victim.tasks.empty()) {
+        task = victim.tasks.front();
+        victim.tasks.erase(victim.tasks.begin());
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+      }
+    }
+    if (task == nullptr) {
+      return false;
+    }
+    execute(task);
+    return true;
+  }
+
+  inline void ThreadPool::execute(Task* task) noexcept
+  {
+    try {
+      task->run(task->data);
+    } catch (...) {
+      task->error = std::current_exception();
+    }
+    task->done.store(true, std::memory_order_release);
+    notify();
+  }
+
+  inline const ThreadPool*& ThreadPool::owner() noexcept
+  {
+    thread_local const ThreadPool* pool = nullptr;
+    return pool;
+  }
+
+  inline size_t& ThreadPool::index() noexcept
+  {
+    thread_local size_t current = 0;
+    return current;
+  }
+}
+
+#endif
@@ -183,8 +183,8 @@ void duhanina::merge(std::istream& in, MapOfGraphs& graphs)
   {
     mergedGraph.addVertex(*vit);
   }
-  auto edges1 = g1.getAllEdges();
-  for (auto eit = edges1.begin(); eit != edges1.end(); ++eit)
+  const auto& edges1 = g1.getAllEdges();
+  for (auto eit = edges1.cbegin(); eit != edges1.cend(); ++eit)
   {
     const auto& edge = eit->first;
     const auto& weights = eit->second;
@@ -198,8 +198,8 @@ void duhanina::merge(std::istream& in, MapOfGraphs& graphs)
   {
     mergedGraph.addVertex(*vit);
   }
-  auto edges2 = g2.getAllEdges();
-  for (auto eit = edges2.begin(); eit != edges2.end(); ++eit)
+  const auto& edges2 = g2.getAllEdges();
+  for (auto eit = edges2.cbegin(); eit != edges2.cend(); ++eit)
   {
     const auto& edge = eit->first;
     const auto& weights = eit->second;
@@ -242,8 +242,8 @@ void duhanina::extract(std::istream& in, MapOfGraphs& graphs)
     vertices.push_back(vertex);
     extractedGraph.addVertex(vertex);
   }
-  auto allEdges = source.getAllEdges();
-  for (auto eit = allEdges.begin(); eit != allEdges.end(); ++eit)
+  const auto& allEdges = source.getAllEdges();
+  for (auto eit = allEdges.cbegin(); eit != allEdges.cend(); ++eit)
   {
     const auto& edge = eit->first;
     const auto& weights = eit->second;
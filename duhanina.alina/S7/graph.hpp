@@ -5,7 +5,7 @@
 #include <utility>
 #include <tree.hpp>
 #include <list.hpp>
-#include <HashTable.hpp>
+#include <ChainedHashTable.hpp>
 
 namespace duhanina
 {
@@ -34,10 +34,10 @@ namespace duhanina
     Tree< Vertex, WeightsList, std::less< Vertex > > getInbound(const Vertex& to) const;
     List< Vertex > getVertices() const;
     size_t vertexCount() const;
-    const HashTable< Edge, WeightsList, EdgeHash >& getAllEdges() const;
+    const ChainedHashTable< Edge, WeightsList, EdgeHash >& getAllEdges() const;
 
   private:
-    HashTable< Edge, WeightsList, EdgeHash > edges;
+    ChainedHashTable< Edge, WeightsList, EdgeHash > edges;
     Tree< Vertex, bool, std::less< Vertex > > vertices;
   };
 }
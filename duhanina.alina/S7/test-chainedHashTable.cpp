@@ -0,0 +1,114 @@
+#include <boost/test/unit_test.hpp>
+#include <string>
+#include <unordered_map>
+#include <ChainedHashTable.hpp>
+
+using ChainedTable = duhanina::ChainedHashTable< int, std::string >;
+
+BOOST_AUTO_TEST_CASE(ChainedInsertFindErase)
+{
+  ChainedTable table;
+  BOOST_TEST(table.empty());
+  BOOST_TEST(table.insert({ 1, "one" }).second);
+  BOOST_TEST(table.emplace(2, "two").second);
+  BOOST_TEST(!table.insert({ 1, "oneone" }).second);
+  BOOST_TEST(table.at(1) == "one");
+  table[3] = "three";
+  BOOST_TEST(table.size() == 3);
+  BOOST_TEST(table.count(2) == 1);
+  BOOST_TEST(table.erase(2) == 1);
+  BOOST_TEST(table.erase(2) == 0);
+  BOOST_CHECK(table.find(2) == table.end());
+  BOOST_TEST(table.size() == 2);
+  BOOST_CHECK_THROW(table.at(2), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(ChainedStableReferences)
+{
+  ChainedTable table;
+  std::string& first = table[0];
+  first = "zero";
+  const std::string* address = std::addressof(first);
+  for (int i = 1; i < 1000; ++i)
+  {
+    table[i] = std::to_string(i);
+  }
+  BOOST_TEST(std::addressof(table.at(0)) == address);
+  BOOST_TEST(table.at(0) == "zero");
+  BOOST_TEST(table.load_factor() <= table.max_load_factor());
+}
+
+BOOST_AUTO_TEST_CASE(ChainedIterationAndErase)
+{
+  ChainedTable table;
+  for (int i = 0; i < 100; ++i)
+  {
+    table.insert({ i, std::to_string(i) });
+  }
+  size_t visited = 0;
+  for (auto it = table.begin(); it != table.end();)
+  {
+    ++visited;
+    if (it->first % 2 == 0)
+    {
+      it = table.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+  BOOST_TEST(visited == 100);
+  BOOST_TEST(table.size() == 50);
+  for (int i = 0; i < 100; ++i)
+  {
+    BOOST_TEST(table.count(i) == static_cast< size_t >(i % 2));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ChainedCopyMoveSwap)
+{
+  ChainedTable table{ { 1, "one" }, { 2, "two" } };
+  ChainedTable copy(table);
+  copy[3] = "three";
+  BOOST_TEST(table.size() == 2);
+  BOOST_TEST(copy.size() == 3);
+  ChainedTable moved(std::move(copy));
+  BOOST_TEST(moved.at(3) == "three");
+  table.swap(moved);
+  BOOST_TEST(table.size() == 3);
+  BOOST_CHECK(moved.find(3) == moved.end());
+  table.erase(table.begin(), table.end());
+  BOOST_TEST(table.empty());
+  table[4] = "four";
+  BOOST_TEST(table.at(4) == "four");
+}
+
+BOOST_AUTO_TEST_CASE(ChainedMatchesStandard)
+{
+  duhanina::ChainedHashTable< int, int > table;
+  std::unordered_map< int, int > expected;
+  unsigned int seed = 7;
+  for (int i = 0; i < 20000; ++i)
+  {
+    seed = seed * 1103515245 + 12345;
+    int key = (seed >> 8) % 3000;
+    if (seed % 3 == 0)
+    {
+      BOOST_TEST(table.erase(key) == expected.erase(key));
+    }
+    else
+    {
+      table[key] = i;
+      expected[key] = i;
+    }
+  }
+  BOOST_TEST(table.size() == expected.size());
+  size_t counted = 0;
+  for (auto it = table.cbegin(); it != table.cend(); ++it)
+  {
+    ++counted;
+    BOOST_TEST(expected.at(it->first) == it->second);
+  }
+  BOOST_TEST(counted == expected.size());
+}
@@ -0,0 +1,538 @@
+#ifndef CHAINEDHASHTABLE_HPP
+#define CHAINEDHASHTABLE_HPP
+
+#include <functional>
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "chainNode.hpp"
+#include "nodePool.hpp"
+#include "iteratorChained.hpp"
+
+namespace duhanina
+{
+  template < class Key, class Value, class Hash = std::hash< Key >, class Equal = std::equal_to< Key > >
+  class ChainedHashTable
+  {
+  public:
+    using iterator = IteratorChained< Key, Value, Hash, Equal, false >;
+    using const_iterator = IteratorChained< Key, Value, Hash, Equal, true >;
+
+    ChainedHashTable();
+    ChainedHashTable(const ChainedHashTable& other);
+    ChainedHashTable(ChainedHashTable&& other) noexcept;
+    ~ChainedHashTable();
+
+    template< typename InputIt >
+    ChainedHashTable(InputIt, InputIt);
+
+    explicit ChainedHashTable(std::initializer_list< std::pair< Key, Value > >);
+
+    ChainedHashTable& operator=(const ChainedHashTable& other);
+    ChainedHashTable& operator=(ChainedHashTable&& other) noexcept;
+
+    iterator begin() noexcept;
+    iterator end() noexcept;
+    const_iterator cbegin() const noexcept;
+    const_iterator cend() const noexcept;
+
+    Value& at(const Key& key);
+    const Value& at(const Key& key) const;
+    Value& operator[](const Key& key);
+
+    bool empty() const noexcept;
+    size_t size() const noexcept;
+
+    void clear() noexcept;
+    std::pair< iterator, bool > insert(const std::pair< Key, Value >& value);
+
+    template < typename InputIt >
+    void insert(InputIt first, InputIt last);
+
+    iterator erase(iterator pos) noexcept;
+    size_t erase(const Key& key) noexcept;
+    iterator erase(iterator first, iterator last) noexcept;
+
+    template < typename K, typename V >
+    std::pair< iterator, bool > emplace(K&& key, V&& value);
+
+    void swap(ChainedHashTable& other) noexcept;
+
+    iterator find(const Key& key);
+    const_iterator find(const Key& key) const;
+    size_t count(const Key& key) const;
+
+    float load_factor() const noexcept;
+    float max_load_factor() const noexcept;
+    void max_load_factor(float ml);
+    void rehashFactor(size_t count);
+
+  private:
+    using Node = ChainNode< Key, Value >;
+
+    ChainLink before_;
+    ChainLink** buckets_;
+    size_t bucket_count_;
+    size_t shift_;
+    size_t size_;
+    float max_load_factor_;
+    NodePool< Node > pool_;
+    Hash hasher_;
+    Equal key_equal_;
+
+    size_t index(size_t hash) const noexcept;
+    Node* findNode(const Key& key, size_t hash) const noexcept;
+    void link(Node* node) noexcept;
+    void destroy(Node* node) noexcept;
+    void rehash(size_t new_count);
+    void fixBefore() noexcept;
+  };
+
+  template < class Key, class Value, class Hash, class Equal >
+  size_t ChainedHashTable< Key, Value, Hash, Equal >::index(size_t hash) const noexcept
+  {
+    return (static_cast< unsigned long long >(hash) * 11400714819323198485ULL) >> shift_;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  ChainNode< Key, Value >* ChainedHashTable< Key, Value, Hash, Equal >::findNode(const Key& key, size_t hash) const noexcept
+  {
+    if (size_ == 0)
+    {
+      return nullptr;
+    }
+    size_t bucket = index(hash);
+    ChainLink* prev = buckets_[bucket];
+    if (!prev)
+    {
+      return nullptr;
+    }
+    for (Node* node = static_cast< Node* >(prev->next); node; node = static_cast< Node* >(node->next))
+    {
+      if (node->hash == hash && key_equal_(node->data.first, key))
+      {
+        return node;
+      }
+      if (node->next && index(static_cast< Node* >(node->next)->hash) != bucket)
+      {
+        break;
+      }
+    }
+    return nullptr;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  void ChainedHashTable< Key, Value, Hash, Equal >::link(Node* node) noexcept
+  {
+    size_t bucket = index(node->hash);
+    if (buckets_[bucket])
+    {
+      node->next = buckets_[bucket]->next;
+      buckets_[bucket]->next = node;
+      return;
+    }
+    node->next = before_.next;
+    before_.next = node;
+    if (node->next)
+    {
+      buckets_[index(static_cast< Node* >(node->next)->hash)] = node;
+    }
+    buckets_[bucket] = std::addressof(before_);
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  void ChainedHashTable< Key, Value, Hash, Equal >::destroy(Node* node) noexcept
+  {
+    node->~Node();
+    pool_.release(node);
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  void ChainedHashTable< Key, Value, Hash, Equal >::rehash(size_t new_count)
+  {
+    size_t count = 8;
+    size_t shift = 61;
+    while (count < new_count)
+    {
+      count *= 2;
+      --shift;
+    }
+    ChainLink** new_buckets = new ChainLink*[count]();
+    delete[] buckets_;
+    buckets_ = new_buckets;
+    bucket_count_ = count;
+    shift_ = shift;
+    Node* node = static_cast< Node* >(before_.next);
+    before_.next = nullptr;
+    while (node)
+    {
+      Node* next = static_cast< Node* >(node->next);
+      link(node);
+      node = next;
+    }
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  void ChainedHashTable< Key, Value, Hash, Equal >::fixBefore() noexcept
+  {
+    if (before_.next)
+    {
+      buckets_[index(static_cast< Node* >(before_.next)->hash)] = std::addressof(before_);
+    }
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  ChainedHashTable< Key, Value, Hash, Equal >::ChainedHashTable():
+    before_(),
+    buckets_(new ChainLink*[8]()),
+    bucket_count_(8),
+    shift_(61),
+    size_(0),
+    max_load_factor_(1.0),
+    pool_(),
+    hasher_(),
+    key_equal_()
+  {}
+
+  template < class Key, class Value, class Hash, class Equal >
+  ChainedHashTable< Key, Value, Hash, Equal >::ChainedHashTable(const ChainedHashTable& other):
+    ChainedHashTable()
+  {
+    max_load_factor_ = other.max_load_factor_;
+    hasher_ = other.hasher_;
+    key_equal_ = other.key_equal_;
+    rehash(other.bucket_count_);
+    for (auto it = other.cbegin(); it != other.cend(); ++it)
+    {
+      emplace(it->first, it->second);
+    }
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  ChainedHashTable< Key, Value, Hash, Equal >::ChainedHashTable(ChainedHashTable&& other) noexcept:
+    before_(),
+    buckets_(nullptr),
+    bucket_count_(0),
+    shift_(0),
+    size_(0),
+    max_load_factor_(1.0),
+    pool_(),
+    hasher_(),
+    key_equal_()
+  {
+    swap(other);
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  ChainedHashTable< Key, Value, Hash, Equal >::~ChainedHashTable()
+  {
+    clear();
+    delete[] buckets_;
+  }
+
+  template< typename Key, typename Value, typename Hash, typename Equal >
+  template< typename InputIt >
+  ChainedHashTable< Key, Value, Hash, Equal >::ChainedHashTable(InputIt first, InputIt last):
+    ChainedHashTable()
+  {
+    insert(first, last);
+  }
+
+  template< typename Key, typename Value, typename Hash, typename Equal >
+  ChainedHashTable< Key, Value, Hash, Equal >::ChainedHashTable(std::initializer_list< std::pair< Key, Value > > ilist):
+    ChainedHashTable(ilist.begin(), ilist.end())
+  {}
+
+  template < class Key, class Value, class Hash, class Equal >
+  ChainedHashTable< Key, Value, Hash, Equal >& ChainedHashTable< Key, Value, Hash, Equal >::operator=(const ChainedHashTable& other)
+  {
+    ChainedHashTable temp(other);
+    swap(temp);
+    return *this;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  ChainedHashTable< Key, Value, Hash, Equal >& ChainedHashTable< Key, Value, Hash, Equal >::operator=(ChainedHashTable&& other) noexcept
+  {
+    ChainedHashTable temp(std::move(other));
+    swap(temp);
+    return *this;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  typename ChainedHashTable< Key, Value, Hash, Equal >::iterator ChainedHashTable< Key, Value, Hash, Equal >::begin() noexcept
+  {
+    return iterator(static_cast< Node* >(before_.next));
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  typename ChainedHashTable< Key, Value, Hash, Equal >::iterator ChainedHashTable< Key, Value, Hash, Equal >::end() noexcept
+  {
+    return iterator(nullptr);
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  typename ChainedHashTable< Key, Value, Hash, Equal >::const_iterator
+    ChainedHashTable< Key, Value, Hash, Equal >::cbegin() const noexcept
+  {
+    return const_iterator(static_cast< const Node* >(before_.next));
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  typename ChainedHashTable< Key, Value, Hash, Equal >::const_iterator
+    ChainedHashTable< Key, Value, Hash, Equal >::cend() const noexcept
+  {
+    return const_iterator(nullptr);
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  Value& ChainedHashTable< Key, Value, Hash, Equal >::at(const Key& key)
+  {
+    auto it = find(key);
+    if (it == end())
+    {
+      throw std::out_of_range("Key not found");
+    }
+    return it->second;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  const Value& ChainedHashTable< Key, Value, Hash, Equal >::at(const Key& key) const
+  {
+    auto it = find(key);
+    if (it == cend())
+    {
+      throw std::out_of_range("Key not found");
+    }
+    return it->second;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  Value& ChainedHashTable< Key, Value, Hash, Equal >::operator[](const Key& key)
+  {
+    auto it = find(key);
+    if (it == end())
+    {
+      it = emplace(key, Value()).first;
+    }
+    return it->second;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  bool ChainedHashTable< Key, Value, Hash, Equal >::empty() const noexcept
+  {
+    return size_ == 0;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  size_t ChainedHashTable< Key, Value, Hash, Equal >::size() const noexcept
+  {
+    return size_;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  void ChainedHashTable< Key, Value, Hash, Equal >::clear() noexcept
+  {
+    Node* node = static_cast< Node* >(before_.next);
+    while (node)
+    {
+      Node* next = static_cast< Node* >(node->next);
+      destroy(node);
+      node = next;
+    }
+    before_.next = nullptr;
+    for (size_t i = 0; i < bucket_count_; ++i)
+    {
+      buckets_[i] = nullptr;
+    }
+    size_ = 0;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  std::pair< typename ChainedHashTable< Key, Value, Hash, Equal >::iterator, bool >
+    ChainedHashTable< Key, Value, Hash, Equal >::insert(const std::pair< Key, Value >& value)
+  {
+    return emplace(value.first, value.second);
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  template < typename InputIt >
+  void ChainedHashTable< Key, Value, Hash, Equal >::insert(InputIt first, InputIt last)
+  {
+    for (; first != last; ++first)
+    {
+      insert(*first);
+    }
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  template < typename K, typename V >
+  std::pair< typename ChainedHashTable< Key, Value, Hash, Equal >::iterator, bool >
+    ChainedHashTable< Key, Value, Hash, Equal >::emplace(K&& key, V&& value)
+  {
+    size_t hash = hasher_(key);
+    Node* found = findNode(key, hash);
+    if (found)
+    {
+      return { iterator(found), false };
+    }
+    if (size_ + 1 > max_load_factor_ * bucket_count_)
+    {
+      rehash(bucket_count_ * 2);
+    }
+    void* place = pool_.allocate();
+    Node* node = nullptr;
+    try
+    {
+      node = new (place) Node(hash, std::forward< K >(key), std::forward< V >(value));
+    }
+    catch (...)
+    {
+      pool_.release(place);
+      throw;
+    }
+    link(node);
+    ++size_;
+    return { iterator(node), true };
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  typename ChainedHashTable< Key, Value, Hash, Equal >::iterator
+    ChainedHashTable< Key, Value, Hash, Equal >::erase(iterator pos) noexcept
+  {
+    if (pos == end())
+    {
+      return end();
+    }
+    Node* node = pos.current_;
+    size_t bucket = index(node->hash);
+    ChainLink* prev = buckets_[bucket];
+    while (prev->next != node)
+    {
+      prev = prev->next;
+    }
+    Node* next = static_cast< Node* >(node->next);
+    size_t next_bucket = next ? index(next->hash) : bucket;
+    if (prev == buckets_[bucket])
+    {
+      if (!next || next_bucket != bucket)
+      {
+        if (next)
+        {
+          buckets_[next_bucket] = prev;
+        }
+        buckets_[bucket] = nullptr;
+      }
+    }
+    else if (next && next_bucket != bucket)
+    {
+      buckets_[next_bucket] = prev;
+    }
+    prev->next = next;
+    destroy(node);
+    --size_;
+    return iterator(next);
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  size_t ChainedHashTable< Key, Value, Hash, Equal >::erase(const Key& key) noexcept
+  {
+    auto it = find(key);
+    if (it != end())
+    {
+      erase(it);
+      return 1;
+    }
+    return 0;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  typename ChainedHashTable< Key, Value, Hash, Equal >::iterator
+    ChainedHashTable< Key, Value, Hash, Equal >::erase(iterator first, iterator last) noexcept
+  {
+    while (first != last)
+    {
+      first = erase(first);
+    }
+    return last;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  void ChainedHashTable< Key, Value, Hash, Equal >::swap(ChainedHashTable& other) noexcept
+  {
+    std::swap(before_.next, other.before_.next);
+    std::swap(buckets_, other.buckets_);
+    std::swap(bucket_count_, other.bucket_count_);
+    std::swap(shift_, other.shift_);
+    std::swap(size_, other.size_);
+    std::swap(max_load_factor_, other.max_load_factor_);
+    pool_.swap(other.pool_);
+    std::swap(hasher_, other.hasher_);
+    std::swap(key_equal_, other.key_equal_);
+    fixBefore();
+    other.fixBefore();
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  typename ChainedHashTable< Key, Value, Hash, Equal >::iterator
+    ChainedHashTable< Key, Value, Hash, Equal >::find(const Key& key)
+  {
+    return iterator(findNode(key, hasher_(key)));
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  typename ChainedHashTable< Key, Value, Hash, Equal >::const_iterator
+    ChainedHashTable< Key, Value, Hash, Equal >::find(const Key& key) const
+  {
+    return const_iterator(findNode(key, hasher_(key)));
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  size_t ChainedHashTable< Key, Value, Hash, Equal >::count(const Key& key) const
+  {
+    return findNode(key, hasher_(key)) ? 1 : 0;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  float ChainedHashTable< Key, Value, Hash, Equal >::load_factor() const noexcept
+  {
+    if (bucket_count_ == 0)
+    {
+      return 0.0;
+    }
+    float current_size = size_;
+    float table_size = bucket_count_;
+    return current_size / table_size;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  float ChainedHashTable< Key, Value, Hash, Equal >::max_load_factor() const noexcept
+  {
+    return max_load_factor_;
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  void ChainedHashTable< Key, Value, Hash, Equal >::max_load_factor(float ml)
+  {
+    if (ml <= 0.0)
+    {
+      throw std::invalid_argument("Invalid max load factor");
+    }
+    max_load_factor_ = ml;
+    rehashFactor(bucket_count_);
+  }
+
+  template < class Key, class Value, class Hash, class Equal >
+  void ChainedHashTable< Key, Value, Hash, Equal >::rehashFactor(size_t count)
+  {
+    size_t min_count = size_ / max_load_factor_ + 1;
+    if (count < min_count)
+    {
+      count = min_count;
+    }
+    rehash(count);
+  }
+}
+
+#endif
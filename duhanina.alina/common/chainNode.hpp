@@ -0,0 +1,28 @@
+#ifndef CHAINNODE_HPP
+#define CHAINNODE_HPP
+
+#include <cstddef>
+#include <utility>
+
+namespace duhanina
+{
+  struct ChainLink
+  {
+    ChainLink* next = nullptr;
+  };
+
+  template< typename Key, typename Value >
+  struct ChainNode: ChainLink
+  {
+    size_t hash;
+    std::pair< Key, Value > data;
+
+    template < typename K, typename V >
+    ChainNode(size_t h, K&& key, V&& value):
+      hash(h),
+      data(std::forward< K >(key), std::forward< V >(value))
+    {}
+  };
+}
+
+#endif
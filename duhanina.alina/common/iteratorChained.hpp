@@ -0,0 +1,94 @@
+#ifndef ITERATORCHAINED_HPP
+#define ITERATORCHAINED_HPP
+
+#include <memory>
+#include <type_traits>
+#include "chainNode.hpp"
+
+namespace duhanina
+{
+  template< typename Key, typename Value, typename Hash, typename Equal >
+  class ChainedHashTable;
+
+  template < class Key, class Value, class Hash, class Equal, bool isConst >
+  class IteratorChained
+  {
+    friend class ChainedHashTable< Key, Value, Hash, Equal >;
+  public:
+    using value_type = std::conditional_t< isConst, const std::pair< Key, Value >, std::pair< Key, Value > >;
+    using pointer = value_type*;
+    using reference = value_type&;
+
+    IteratorChained() noexcept;
+
+    reference operator*() const noexcept;
+    pointer operator->() const noexcept;
+
+    IteratorChained& operator++() noexcept;
+    IteratorChained operator++(int) noexcept;
+
+    bool operator==(const IteratorChained& other) const noexcept;
+    bool operator!=(const IteratorChained& other) const noexcept;
+
+  private:
+    using NodePtr = std::conditional_t< isConst, const ChainNode< Key, Value >*, ChainNode< Key, Value >* >;
+    NodePtr current_;
+
+    explicit IteratorChained(NodePtr ptr) noexcept;
+  };
+
+  template < class Key, class Value, class Hash, class Equal, bool isConst >
+  IteratorChained< Key, Value, Hash, Equal, isConst >::IteratorChained() noexcept:
+    current_(nullptr)
+  {}
+
+  template < class Key, class Value, class Hash, class Equal, bool isConst >
+  IteratorChained< Key, Value, Hash, Equal, isConst >::IteratorChained(NodePtr ptr) noexcept:
+    current_(ptr)
+  {}
+
+  template < class Key, class Value, class Hash, class Equal, bool isConst >
+  typename IteratorChained< Key, Value, Hash, Equal, isConst >::reference
+    IteratorChained< Key, Value, Hash, Equal, isConst >::operator*() const noexcept
+  {
+    return current_->data;
+  }
+
+  template < class Key, class Value, class Hash, class Equal, bool isConst >
+  typename IteratorChained< Key, Value, Hash, Equal, isConst >::pointer
+    IteratorChained< Key, Value, Hash, Equal, isConst >::operator->() const noexcept
+  {
+    return std::addressof(current_->data);
+  }
+
+  template < class Key, class Value, class Hash, class Equal, bool isConst >
+  IteratorChained< Key, Value, Hash, Equal, isConst >&
+    IteratorChained< Key, Value, Hash, Equal, isConst >::operator++() noexcept
+  {
+    current_ = static_cast< NodePtr >(current_->next);
+    return *this;
+  }
+
+  template < class Key, class Value, class Hash, class Equal, bool isConst >
+  IteratorChained< Key, Value, Hash, Equal, isConst >
+    IteratorChained< Key, Value, Hash, Equal, isConst >::operator++(int) noexcept
+  {
+    IteratorChained tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  template < class Key, class Value, class Hash, class Equal, bool isConst >
+  bool IteratorChained< Key, Value, Hash, Equal, isConst >::operator==(const IteratorChained& other) const noexcept
+  {
+    return current_ == other.current_;
+  }
+
+  template < class Key, class Value, class Hash, class Equal, bool isConst >
+  bool IteratorChained< Key, Value, Hash, Equal, isConst >::operator!=(const IteratorChained& other) const noexcept
+  {
+    return !(*this == other);
+  }
+}
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef NODEPOOL_HPP
+#define NODEPOOL_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace duhanina
+{
+  template< typename T >
+  class NodePool
+  {
+  public:
+    NodePool() noexcept;
+    ~NodePool();
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    void* allocate();
+    void release(void* ptr) noexcept;
+    void swap(NodePool& other) noexcept;
+
+  private:
+    union Slot
+    {
+      Slot* next;
+      typename std::aligned_storage< sizeof(T), alignof(T) >::type storage;
+    };
+    struct Block
+    {
+      Block* next;
+      Slot* slots;
+    };
+
+    Block* blocks_;
+    Slot* free_;
+    size_t block_size_;
+    size_t used_;
+  };
+
+  template< typename T >
+  NodePool< T >::NodePool() noexcept:
+    blocks_(nullptr),
+    free_(nullptr),
+    block_size_(0),
+    used_(0)
+  {}
+
+  template< typename T >
+  NodePool< T >::~NodePool()
+  {
+    while (blocks_)
+    {
+      Block* next = blocks_->next;
+      delete[] blocks_->slots;
+      delete blocks_;
+      blocks_ = next;
+    }
+  }
+
+  template< typename T >
+  void* NodePool< T >::allocate()
+  {
+    if (free_)
+    {
+      Slot* slot = free_;
+      free_ = free_->next;
+      return slot;
+    }
+    if (!blocks_ || used_ == block_size_)
+    {
+      size_t new_size = block_size_ == 0 ? 16 : block_size_ * 2;
+      Slot* slots = new Slot[new_size];
+      try
+      {
+        blocks_ = new Block{ blocks_, slots };
+      }
+      catch (...)
+      {
+        delete[] slots;
+        throw;
+      }
+      block_size_ = new_size;
+      used_ = 0;
+    }
+    return blocks_->slots + used_++;
+  }
+
+  template< typename T >
+  void NodePool< T >::release(void* ptr) noexcept
+  {
+    Slot* slot = static_cast< Slot* >(ptr);
+    slot->next = free_;
+    free_ = slot;
+  }
+
+  template< typename T >
+  void NodePool< T >::swap(NodePool& other) noexcept
+  {
+    std::swap(blocks_, other.blocks_);
+    std::swap(free_, other.free_);
+    std::swap(block_size_, other.block_size_);
+    std::swap(used_, other.used_);
+  }
+}
+
+#endif
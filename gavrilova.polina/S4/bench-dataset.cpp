@@ -0,0 +1,112 @@
+#define BENCH_MAIN
+#include <harness.hpp>
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "commands.hpp"
+
+namespace {
+  constexpr size_t datasets_count = 2000;
+  constexpr size_t keys_count = 100;
+  constexpr size_t rounds = 20;
+  constexpr size_t union_keys = 1000000;
+
+  struct Workload {
+    std::vector< std::string > names;
+    std::vector< std::vector< size_t > > keys;
+  };
+
+  const Workload& workload()
+  {
+    static const Workload result = []()
+    {
+      std::mt19937 gen(7);
+      Workload w;
+      for (size_t i = 0; i < datasets_count; ++i) {
+        w.names.push_back("dataset_with_a_long_name_" + std::to_string(gen()));
+        std::vector< size_t > keys;
+        for (size_t j = 0; j < keys_count; ++j) {
+          keys.push_back(gen() % (keys_count * 4));
+        }
+        w.keys.push_back(std::move(keys));
+      }
+      return w;
+    }();
+    return result;
+  }
+
+  gavrilova::Dataset build(const Workload& w)
+  {
+    gavrilova::Dataset datasets;
+    for (size_t i = 0; i < w.names.size(); ++i) {
+      gavrilova::KeyMap dataset;
+      for (size_t j = 0; j < w.keys[i].size(); ++j) {
+        dataset.insert({w.keys[i][j], "value_" + std::to_string(j)});
+      }
+      datasets.insert({w.names[i], std::move(dataset)});
+    }
+    return datasets;
+  }
+}
+
+BENCH_CASE(dataset_build)
+{
+  std::clog << "node: " << sizeof(gavrilova::Dataset::Node) << " bytes, keymap node: ";
+  std::clog << sizeof(gavrilova::KeyMap::Node) << " bytes\n";
+  const Workload& w = workload();
+  state.setItems(datasets_count * keys_count);
+  state.run([&w]()
+  {
+    gavrilova::Dataset datasets = build(w);
+    bench::doNotOptimize(datasets);
+  });
+}
+
+BENCH_CASE(dataset_lookup)
+{
+  const gavrilova::Dataset datasets = build(workload());
+  std::vector< std::string > names = workload().names;
+  std::mt19937 gen(11);
+  std::shuffle(names.begin(), names.end(), gen);
+  state.setItems(rounds * datasets_count);
+  state.run([&datasets, &names]()
+  {
+    size_t hits = 0;
+    for (size_t r = 0; r < rounds; ++r) {
+      for (size_t i = 0; i < names.size(); ++i) {
+        hits += datasets.find(names[i])->second.count(r);
+      }
+    }
+    bench::doNotOptimize(hits);
+  });
+}
+
+BENCH_CASE(dataset_copy)
+{
+  const gavrilova::Dataset datasets = build(workload());
+  state.setItems(datasets_count * keys_count);
+  state.run([&datasets]()
+  {
+    gavrilova::Dataset copy(datasets);
+    bench::doNotOptimize(copy);
+  });
+}
+
+BENCH_CASE(dataset_union)
+{
+  gavrilova::Dataset sources;
+  gavrilova::KeyMap& evens = sources["evens"];
+  gavrilova::KeyMap& odds = sources["odds"];
+  for (size_t i = 0; i < union_keys; ++i) {
+    evens.insert(evens.cend(), {i * 2, "e"});
+    odds.insert(odds.cend(), {i * 2 + 1, "o"});
+  }
+  state.setItems(union_keys * 2);
+  state.run([&sources]()
+  {
+    gavrilova::unionDatasets("all", "evens", "odds", sources);
+    bench::doNotOptimize(sources);
+  });
+}
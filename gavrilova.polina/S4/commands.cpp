@@ -1,6 +1,112 @@
 #include "commands.hpp"
 #include <stdexcept>
 
+namespace {
+  enum class SetOperation {
+    UNION,
+    INTERSECTION,
+    DIFFERENCE
+  };
+
+  // walks two key maps in step and yields, in ascending order, the pairs a set operation keeps
+  class SetIterator {
+  public:
+    using Iterator = gavrilova::KeyMap::ConstIterator;
+
+    SetIterator(SetOperation operation, Iterator first, Iterator firstEnd, Iterator second, Iterator secondEnd):
+      operation_(operation),
+      first_(first),
+      firstEnd_(firstEnd),
+      second_(second),
+      secondEnd_(secondEnd),
+      fromFirst_(true)
+    {
+      skip();
+    }
+
+    const gavrilova::KeyMap::value_type& operator*() const
+    {
+      return fromFirst_ ? *first_ : *second_;
+    }
+
+    SetIterator& operator++()
+    {
+      if (!fromFirst_) {
+        ++second_;
+      } else {
+        if (second_ != secondEnd_ && !(first_->first < second_->first)) {
+          ++second_;
+        }
+        ++first_;
+      }
+      skip();
+      return *this;
+    }
+
+    bool operator!=(const SetIterator& rhs) const
+    {
+      return first_ != rhs.first_ || second_ != rhs.second_;
+    }
+
+  private:
+    SetOperation operation_;
+    Iterator first_;
+    Iterator firstEnd_;
+    Iterator second_;
+    Iterator secondEnd_;
+    bool fromFirst_;
+
+    void skip()
+    {
+      while (first_ != firstEnd_ && second_ != secondEnd_) {
+        if (first_->first < second_->first) {
+          if (operation_ != SetOperation::INTERSECTION) {
+            fromFirst_ = true;
+            return;
+          }
+          ++first_;
+        } else if (second_->first < first_->first) {
+          if (operation_ == SetOperation::UNION) {
+            fromFirst_ = false;
+            return;
+          }
+          ++second_;
+        } else if (operation_ != SetOperation::DIFFERENCE) {
+          fromFirst_ = true;
+          return;
+        } else {
+          ++first_;
+          ++second_;
+        }
+      }
+      fromFirst_ = first_ != firstEnd_;
+      if (first_ == firstEnd_ && operation_ != SetOperation::UNION) {
+        second_ = secondEnd_;
+      } else if (second_ == secondEnd_ && operation_ == SetOperation::INTERSECTION) {
+        first_ = firstEnd_;
+      }
+    }
+  };
+
+  void applySetOperation(SetOperation operation, const std::string& newDatasetName,
+      const std::string& firstDatasetName, const std::string& secondDatasetName, gavrilova::Dataset& datasets)
+  {
+    auto firstIt = datasets.find(firstDatasetName);
+    auto secondIt = datasets.find(secondDatasetName);
+
+    if (firstIt == datasets.end() || secondIt == datasets.end()) {
+      throw std::invalid_argument("One or both datasets not found");
+    }
+
+    const gavrilova::KeyMap& first = firstIt->second;
+    const gavrilova::KeyMap& second = secondIt->second;
+    gavrilova::KeyMap newDataset;
+    newDataset.append_sorted(SetIterator(operation, first.cbegin(), first.cend(), second.cbegin(), second.cend()),
+        SetIterator(operation, first.cend(), first.cend(), second.cend(), second.cend()));
+    datasets[newDatasetName] = std::move(newDataset);
+  }
+}
+
 void gavrilova::printDataset(std::ostream& out, const std::string& datasetName, Dataset& datasets)
 {
   auto it = datasets.find(datasetName);
@@ -27,66 +133,17 @@ void gavrilova::complementDataset(const std::string& newDatasetName,
     const std::string& secondDatasetName,
     Dataset& datasets)
 {
-  auto firstIt = datasets.find(firstDatasetName);
-  auto secondIt = datasets.find(secondDatasetName);
-
-  if (firstIt == datasets.end() || secondIt == datasets.end()) {
-    throw std::invalid_argument("One or both datasets not found");
-  }
-
-  KeyMap newDataset;
-  const auto& firstDataset = firstIt->second;
-  const auto& secondDataset = secondIt->second;
-
-  for (auto it = firstDataset.cbegin(); it != firstDataset.cend(); it++) {
-    if (secondDataset.find(it->first) == secondDataset.end()) {
-      newDataset.insert(*it);
-    }
-  }
-  datasets[newDatasetName] = std::move(newDataset);
+  applySetOperation(SetOperation::DIFFERENCE, newDatasetName, firstDatasetName, secondDatasetName, datasets);
 }
 
 void gavrilova::intersectDatasets(const std::string& newDatasetName, const std::string& firstDatasetName,
     const std::string& secondDatasetName, Dataset& datasets)
 {
-  auto firstIt = datasets.find(firstDatasetName);
-  auto secondIt = datasets.find(secondDatasetName);
-
-  if (firstIt == datasets.end() || secondIt == datasets.end()) {
-    throw std::invalid_argument("One or both datasets not found");
-  }
-
-  KeyMap newDataset;
-  const auto& firstDataset = firstIt->second;
-  const auto& secondDataset = secondIt->second;
-
-  for (auto it = firstDataset.cbegin(); it != firstDataset.cend(); ++it) {
-    if (secondDataset.find(it->first) != secondDataset.end()) {
-      newDataset.insert(*it);
-    }
-  }
-
-  datasets[newDatasetName] = std::move(newDataset);
+  applySetOperation(SetOperation::INTERSECTION, newDatasetName, firstDatasetName, secondDatasetName, datasets);
 }
 
 void gavrilova::unionDatasets(const std::string& newDatasetName, const std::string& firstDatasetName,
     const std::string& secondDatasetName, Dataset& datasets)
 {
-  auto firstIt = datasets.find(firstDatasetName);
-  auto secondIt = datasets.find(secondDatasetName);
-
-  if (firstIt == datasets.end() || secondIt == datasets.end()) {
-    throw std::invalid_argument("One or both datasets not found");
-  }
-
-  KeyMap newDataset;
-  const auto& firstDataset = firstIt->second;
-  const auto& secondDataset = secondIt->second;
-
-  for (const auto& dataset: {firstDataset, secondDataset}) {
-    for (auto it = dataset.cbegin(); it != dataset.cend(); it++) {
-      newDataset.insert(std::make_pair(it->first, it->second));
-    }
-  }
-  datasets[newDatasetName] = std::move(newDataset);
+  applySetOperation(SetOperation::UNION, newDatasetName, firstDatasetName, secondDatasetName, datasets);
 }
@@ -17,13 +17,14 @@ namespace {
     std::string datasetName;
     while (file >> datasetName) {
       gavrilova::KeyMap dataset;
+      gavrilova::KeyMap::ConstIterator hint = dataset.cend();
       size_t key;
       while (file >> key) {
         std::string value;
         if (!(file >> value)) {
           throw std::runtime_error("Invalid data format");
         }
-        dataset.insert({key, value});
+        hint = dataset.insert(hint, {key, value});
       }
       datasets.insert({datasetName, std::move(dataset)});
       file.clear();
@@ -301,7 +301,7 @@ BOOST_AUTO_TEST_CASE(TestTreeStructureAfterInsertions)
 
   auto root = tree.get_node();
   BOOST_CHECK(root != nullptr);
-  BOOST_CHECK(!root->is_3_node);
+  BOOST_CHECK(!root->is_3_node());
   BOOST_TEST(root->data[0].first == 50);
 
   for (int key: {20, 30, 40, 50, 60, 70, 80}) {
@@ -680,3 +680,83 @@ BOOST_AUTO_TEST_CASE(TestRangeEraseBoundaryCases)
   tree.erase(tree.begin(), tree.end());
   BOOST_TEST(tree.empty());
 }
+
+BOOST_AUTO_TEST_CASE(TestIteratorTraversalThroughMiddleChildren)
+{
+  gavrilova::TwoThreeTree< int, std::string > tree;
+  const int count = 200;
+  for (int i = 0; i < count; ++i) {
+    tree.insert({i * 2, std::to_string(i)});
+  }
+
+  int expected = 0;
+  for (auto it = tree.cbegin(); it != tree.cend(); ++it) {
+    BOOST_TEST(it->first == expected);
+    expected += 2;
+  }
+  BOOST_TEST(expected == count * 2);
+}
+
+BOOST_AUTO_TEST_CASE(TestHintedInsert)
+{
+  gavrilova::TwoThreeTree< int, std::string > tree;
+
+  auto hint = tree.insert(tree.cend(), {50, "fifty"});
+  BOOST_TEST(hint->first == 50);
+  for (int i = 51; i < 300; ++i) {
+    hint = tree.insert(hint, {i, std::to_string(i)});
+    BOOST_TEST(hint->first == i);
+  }
+  for (int i = 49; i >= 0; --i) {
+    hint = tree.insert(hint, {i, std::to_string(i)});
+    BOOST_TEST(hint->second == std::to_string(i));
+  }
+  BOOST_TEST(tree.size() == 300);
+
+  auto existing = tree.insert(tree.cbegin(), {150, "duplicate"});
+  BOOST_TEST(existing->second == "150");
+  BOOST_TEST(tree.size() == 300);
+
+  hint = tree.find(10);
+  for (int i = 300; i < 400; i += 3) {
+    hint = tree.insert(hint, {i, std::to_string(i)});
+    BOOST_TEST(hint->first == i);
+  }
+
+  int previous = -1;
+  size_t visited = 0;
+  for (auto it = tree.cbegin(); it != tree.cend(); ++it) {
+    BOOST_TEST(it->first > previous);
+    previous = it->first;
+    ++visited;
+  }
+  BOOST_TEST(visited == tree.size());
+}
+
+BOOST_AUTO_TEST_CASE(TestAppendSorted)
+{
+  gavrilova::TwoThreeTree< int, std::string > tree;
+  std::vector< std::pair< int, std::string > > elements;
+  for (int i = 0; i < 1000; ++i) {
+    elements.push_back({i, std::to_string(i)});
+  }
+  tree.append_sorted(elements.begin(), elements.end());
+  BOOST_TEST(tree.size() == 1000);
+
+  std::vector< std::pair< int, std::string > > more = {
+      {999, "duplicate"},
+      {1000, "1000"},
+      {-5, "out_of_order"},
+      {1001, "1001"}};
+  tree.append_sorted(more.begin(), more.end());
+  BOOST_TEST(tree.size() == 1003);
+  BOOST_TEST(tree.at(999) == "999");
+  BOOST_TEST(tree.at(-5) == "out_of_order");
+
+  int expected = -5;
+  for (auto it = tree.cbegin(); it != tree.cend(); ++it) {
+    BOOST_TEST(it->first == expected);
+    expected = (expected == -5) ? 0 : expected + 1;
+  }
+  BOOST_TEST(expected == 1002);
+}
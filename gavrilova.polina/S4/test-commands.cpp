@@ -0,0 +1,101 @@
+#include <boost/test/unit_test.hpp>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include "commands.hpp"
+
+namespace {
+  gavrilova::Dataset makeDatasets()
+  {
+    gavrilova::Dataset datasets;
+    datasets["first"] = {{1, "a1"}, {2, "a2"}, {4, "a4"}};
+    datasets["second"] = {{2, "b2"}, {3, "b3"}, {4, "b4"}, {5, "b5"}};
+    datasets["empty"] = {};
+    return datasets;
+  }
+
+  std::string print(const std::string& name, gavrilova::Dataset& datasets)
+  {
+    std::ostringstream out;
+    gavrilova::printDataset(out, name, datasets);
+    return out.str();
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestSetOperationsOverlappingKeys)
+{
+  gavrilova::Dataset datasets = makeDatasets();
+  gavrilova::unionDatasets("union", "first", "second", datasets);
+  BOOST_TEST(print("union", datasets) == "union 1 a1 2 a2 3 b3 4 a4 5 b5\n");
+  gavrilova::unionDatasets("union", "second", "first", datasets);
+  BOOST_TEST(print("union", datasets) == "union 1 a1 2 b2 3 b3 4 b4 5 b5\n");
+
+  gavrilova::intersectDatasets("common", "first", "second", datasets);
+  BOOST_TEST(print("common", datasets) == "common 2 a2 4 a4\n");
+  gavrilova::intersectDatasets("common", "second", "first", datasets);
+  BOOST_TEST(print("common", datasets) == "common 2 b2 4 b4\n");
+
+  gavrilova::complementDataset("rest", "first", "second", datasets);
+  BOOST_TEST(print("rest", datasets) == "rest 1 a1\n");
+  gavrilova::complementDataset("rest", "second", "first", datasets);
+  BOOST_TEST(print("rest", datasets) == "rest 3 b3 5 b5\n");
+
+  BOOST_TEST(print("first", datasets) == "first 1 a1 2 a2 4 a4\n");
+  BOOST_TEST(print("second", datasets) == "second 2 b2 3 b3 4 b4 5 b5\n");
+}
+
+BOOST_AUTO_TEST_CASE(TestSetOperationsEmptySide)
+{
+  gavrilova::Dataset datasets = makeDatasets();
+  gavrilova::unionDatasets("result", "first", "empty", datasets);
+  BOOST_TEST(print("result", datasets) == "result 1 a1 2 a2 4 a4\n");
+  gavrilova::unionDatasets("result", "empty", "second", datasets);
+  BOOST_TEST(print("result", datasets) == "result 2 b2 3 b3 4 b4 5 b5\n");
+
+  gavrilova::intersectDatasets("result", "first", "empty", datasets);
+  BOOST_TEST(print("result", datasets) == "<EMPTY>\n");
+  gavrilova::intersectDatasets("result", "empty", "second", datasets);
+  BOOST_TEST(print("result", datasets) == "<EMPTY>\n");
+
+  gavrilova::complementDataset("result", "first", "empty", datasets);
+  BOOST_TEST(print("result", datasets) == "result 1 a1 2 a2 4 a4\n");
+  gavrilova::complementDataset("result", "empty", "second", datasets);
+  BOOST_TEST(print("result", datasets) == "<EMPTY>\n");
+
+  gavrilova::unionDatasets("result", "empty", "empty", datasets);
+  BOOST_TEST(print("result", datasets) == "<EMPTY>\n");
+}
+
+BOOST_AUTO_TEST_CASE(TestSetOperationsOverwriteInput)
+{
+  gavrilova::Dataset datasets = makeDatasets();
+  gavrilova::unionDatasets("first", "first", "second", datasets);
+  BOOST_TEST(print("first", datasets) == "first 1 a1 2 a2 3 b3 4 a4 5 b5\n");
+  BOOST_TEST(print("second", datasets) == "second 2 b2 3 b3 4 b4 5 b5\n");
+
+  datasets = makeDatasets();
+  gavrilova::intersectDatasets("second", "first", "second", datasets);
+  BOOST_TEST(print("second", datasets) == "second 2 a2 4 a4\n");
+  BOOST_TEST(print("first", datasets) == "first 1 a1 2 a2 4 a4\n");
+
+  datasets = makeDatasets();
+  gavrilova::complementDataset("first", "first", "second", datasets);
+  BOOST_TEST(print("first", datasets) == "first 1 a1\n");
+
+  datasets = makeDatasets();
+  gavrilova::complementDataset("first", "first", "first", datasets);
+  BOOST_TEST(print("first", datasets) == "<EMPTY>\n");
+  gavrilova::unionDatasets("second", "second", "second", datasets);
+  BOOST_TEST(print("second", datasets) == "second 2 b2 3 b3 4 b4 5 b5\n");
+  BOOST_TEST(datasets.size() == 3);
+}
+
+BOOST_AUTO_TEST_CASE(TestSetOperationsMissingDataset)
+{
+  gavrilova::Dataset datasets = makeDatasets();
+  BOOST_CHECK_THROW(gavrilova::unionDatasets("result", "first", "missing", datasets), std::invalid_argument);
+  BOOST_CHECK_THROW(gavrilova::intersectDatasets("result", "missing", "first", datasets), std::invalid_argument);
+  BOOST_CHECK_THROW(gavrilova::complementDataset("first", "first", "missing", datasets), std::invalid_argument);
+  BOOST_CHECK(datasets.find("result") == datasets.end());
+  BOOST_TEST(print("first", datasets) == "first 1 a1 2 a2 4 a4\n");
+}
@@ -65,12 +65,12 @@ namespace gavrilova {
     }
 
     if (node_->is_leaf()) {
-      if (node_->is_3_node && key_pos_ == 0) {
+      if (node_->is_3_node() && key_pos_ == 0) {
         key_pos_ = 1;
       } else {
         Node* parent = node_->parent;
         Node* child = node_;
-        while (parent && !parent->is_fake && parent->children[0] != child) {
+        while (parent && !parent->is_fake && parent->children[parent->len] == child) {
           child = parent;
           parent = parent->parent;
         }
@@ -108,12 +108,12 @@ namespace gavrilova {
     if (node_->is_fake) {
       node_ = go_max(fake_->children[0]);
       assert(node_);
-      key_pos_ = node_->is_3_node ? 1 : 0;
+      key_pos_ = node_->is_3_node() ? 1 : 0;
       return *this;
     }
 
     if (node_->is_leaf()) {
-      if (node_->is_3_node && key_pos_ == 1) {
+      if (node_->is_3_node() && key_pos_ == 1) {
         key_pos_ = 0;
       } else {
         Node* parent = node_->parent;
@@ -136,7 +136,7 @@ namespace gavrilova {
       } else {
         node_ = go_max(node_->children[1]);
       }
-      key_pos_ = node_->is_3_node ? 1 : 0;
+      key_pos_ = node_->is_3_node() ? 1 : 0;
     }
     return *this;
   }
@@ -190,7 +190,7 @@ namespace gavrilova {
   {
     Node* cur = start;
     while (!cur->is_leaf()) {
-      cur = cur->children[cur->is_3_node ? 2 : 1];
+      cur = cur->children[cur->is_3_node() ? 2 : 1];
     }
     return cur;
   }
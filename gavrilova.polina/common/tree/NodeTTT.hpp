@@ -2,46 +2,110 @@
 #define NODE_TTT_HPP
 
 #include <cstddef>
+#include <memory>
+#include <new>
 #include <utility>
 
 namespace gavrilova {
+  template < class T, size_t N >
+  struct RawArray {
+    alignas(T) unsigned char raw[N * sizeof(T)];
+
+    T& operator[](size_t i) noexcept;
+    const T& operator[](size_t i) const noexcept;
+  };
+
   template < class Key, class Value >
   struct NodeTwoThreeTree {
     using this_t = NodeTwoThreeTree< Key, Value >;
     using value_type = std::pair< Key, Value >;
 
-    value_type data[2];
     this_t* children[3];
     this_t* parent;
-    bool is_3_node;
+    unsigned char len;
     bool is_fake;
+    RawArray< value_type, 2 > data;
 
-    NodeTwoThreeTree();
-    NodeTwoThreeTree(const value_type& d1, const value_type& d2, bool is_3,
-    this_t* p, this_t* c1, this_t* c2, this_t* c3);
+    NodeTwoThreeTree() noexcept;
+    NodeTwoThreeTree(const this_t&) = delete;
+    ~NodeTwoThreeTree();
+    this_t& operator=(const this_t&) = delete;
+
+    template < class... Args >
+    void emplace(size_t pos, Args&&... args);
+    void erase(size_t pos) noexcept;
+    bool is_3_node() const noexcept;
     bool is_leaf() const;
   };
 
+  template < class T, size_t N >
+  T& RawArray< T, N >::operator[](size_t i) noexcept
+  {
+    return reinterpret_cast< T* >(raw)[i];
+  }
+
+  template < class T, size_t N >
+  const T& RawArray< T, N >::operator[](size_t i) const noexcept
+  {
+    return reinterpret_cast< const T* >(raw)[i];
+  }
+
   template < class Key, class Value >
-  NodeTwoThreeTree< Key, Value >::NodeTwoThreeTree():
+  NodeTwoThreeTree< Key, Value >::NodeTwoThreeTree() noexcept:
+    children{nullptr, nullptr, nullptr},
     parent(nullptr),
-    is_3_node(false),
+    len(0),
     is_fake(false)
+  {}
+
+  template < class Key, class Value >
+  NodeTwoThreeTree< Key, Value >::~NodeTwoThreeTree()
+  {
+    for (size_t i = 0; i < len; ++i) {
+      data[i].~value_type();
+    }
+  }
+
+  template < class Key, class Value >
+  template < class... Args >
+  void NodeTwoThreeTree< Key, Value >::emplace(size_t pos, Args&&... args)
+  {
+    if (pos == len) {
+      new (std::addressof(data[pos])) value_type(std::forward< Args >(args)...);
+      ++len;
+      return;
+    }
+    new (std::addressof(data[len])) value_type(std::move(data[len - 1]));
+    for (size_t i = len - 1; i > pos; --i) {
+      data[i] = std::move(data[i - 1]);
+    }
+    data[pos].~value_type();
+    try {
+      new (std::addressof(data[pos])) value_type(std::forward< Args >(args)...);
+    } catch (...) {
+      new (std::addressof(data[pos])) value_type(std::move(data[pos + 1]));
+      for (size_t i = pos + 1; i < len; ++i) {
+        data[i] = std::move(data[i + 1]);
+      }
+      data[len].~value_type();
+      throw;
+    }
+    ++len;
+  }
+
+  template < class Key, class Value >
+  void NodeTwoThreeTree< Key, Value >::erase(size_t pos) noexcept
   {
-    children[0] = children[1] = children[2] = nullptr;
-    data[0] = data[1] = std::pair< Key, Value >();
+    for (size_t i = pos + 1; i < len; ++i) {
+      data[i - 1] = std::move(data[i]);
+    }
+    data[--len].~value_type();
   }
 
   template < class Key, class Value >
-  NodeTwoThreeTree< Key, Value >::NodeTwoThreeTree(const value_type& d1, const value_type& d2,
-  bool is_3, this_t* p, this_t* c0, this_t* c1, this_t* c2):
-    data(), children(), parent(p), is_3_node(is_3), is_fake(false)
+  bool NodeTwoThreeTree< Key, Value >::is_3_node() const noexcept
   {
-    data[0] = d1;
-    data[1] = d2;
-    children[0] = c0;
-    children[1] = c1;
-    children[2] = c2;
+    return len == 2;
   }
 
   template < class Key, class Value >
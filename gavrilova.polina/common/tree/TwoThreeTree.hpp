@@ -3,6 +3,7 @@
 
 #include <Queue.hpp>
 #include <Stack.hpp>
+#include <algorithm>
 #include <cassert>
 #include <functional>
 #include <iostream>
@@ -58,9 +59,12 @@ namespace gavrilova {
     void clear() noexcept;
 
     std::pair< Iterator, bool > insert(const value_type& value);
+    Iterator insert(ConstIterator hint, const value_type& value);
     template < class InputIterator >
     void insert(InputIterator first, InputIterator last);
     void insert(std::initializer_list< value_type > il);
+    template < class InputIterator >
+    void append_sorted(InputIterator first, InputIterator last);
 
     size_t erase(const Key& key);
     Iterator erase(Iterator pos);
@@ -103,9 +107,13 @@ namespace gavrilova {
     Node* copy_subtree(Node* node, Node* parent);
     bool is_leaf(Node* node) const;
     void clear_recursive(Node* node) noexcept;
-    Node* find_leaf(const Key& key, size_t& counter_for_allocate);
+    Node* find_leaf(Node* node, const Key& key, int& key_pos);
+    Node* finger_search(Node* finger, const Key& key);
+    Node* max_leaf(Node* node) const;
+    Iterator insert_into_leaf(Node* leaf, const value_type& value);
 
-    void push_to_2node(Node* node, const Key& key, const Value& value);
+    void push_to_2node(Node* node, const value_type& value);
+    void split_keys(Node* node, value_type& middle, int insert_idx, Node* right);
 
     void rebalance(Node* node);
     void rotation(Node* deficient_node, Node* sibling, Node* parent, int deficient_idx);
@@ -124,7 +132,7 @@ namespace gavrilova {
     fake_->children[1] = nullptr;
     fake_->children[2] = nullptr;
     fake_->parent = nullptr;
-    fake_->is_3_node = false;
+    fake_->len = 0;
     fake_->is_fake = true;
   }
 
@@ -313,16 +321,14 @@ namespace gavrilova {
   std::pair< typename TwoThreeTree< Key, Value, Cmp >::Iterator, bool >
   TwoThreeTree< Key, Value, Cmp >::insert(const value_type& value)
   {
-    const Key& key = value.first;
-
-    Iterator existing_it = find(key);
-    if (existing_it != end()) {
-      return {existing_it, false};
-    }
-
     if (empty()) {
       Node* new_root = new Node();
-      new_root->data[0] = value;
+      try {
+        new_root->emplace(0, value);
+      } catch (...) {
+        delete new_root;
+        throw;
+      }
       new_root->parent = fake_;
       new_root->children[0] = new_root->children[1] = new_root->children[2] = fake_;
       fake_->children[0] = new_root;
@@ -330,54 +336,80 @@ namespace gavrilova {
       return {Iterator(new_root, 0, fake_), true};
     }
 
-    size_t nodes_to_alloc_count = 0;
-    Node* leaf = find_leaf(key, nodes_to_alloc_count);
-    if (!leaf->is_3_node) {
-      push_to_2node(leaf, key, value.second);
-      ++size_;
-      int new_pos = (cmp_(key, leaf->data[1].first)) ? 0 : 1;
-      return {Iterator(leaf, new_pos, fake_), true};
+    int key_pos = -1;
+    Node* node = find_leaf(fake_->children[0], value.first, key_pos);
+    if (key_pos >= 0) {
+      return {Iterator(node, key_pos, fake_), false};
     }
+    return {insert_into_leaf(node, value), true};
+  }
 
-    Node** preallocated_nodes = nullptr;
-    if (nodes_to_alloc_count > 0) {
-      preallocated_nodes = new Node* [nodes_to_alloc_count] { nullptr };
-      try {
-        for (size_t i = 0; i < nodes_to_alloc_count; ++i) {
-          preallocated_nodes[i] = new Node();
-        }
-      } catch (const std::bad_alloc&) {
-        for (size_t i = 0; i < nodes_to_alloc_count; ++i) {
-          delete preallocated_nodes[i];
-        }
-        delete[] preallocated_nodes;
-        throw;
-      }
+  template < class Key, class Value, class Cmp >
+  typename TwoThreeTree< Key, Value, Cmp >::Iterator
+  TwoThreeTree< Key, Value, Cmp >::insert(ConstIterator hint, const value_type& value)
+  {
+    if (empty() || hint.fake_ != fake_) {
+      return insert(value).first;
     }
+    Node* finger = hint.node_ == fake_ ? max_leaf(fake_->children[0]) : const_cast< Node* >(hint.node_);
 
-    size_t nodes_used = 0;
-    value_type temp_data[3] = {leaf->data[0], leaf->data[1], value};
+    int key_pos = -1;
+    Node* node = find_leaf(finger_search(finger, value.first), value.first, key_pos);
+    if (key_pos >= 0) {
+      return Iterator(node, key_pos, fake_);
+    }
+    return insert_into_leaf(node, value);
+  }
 
-    if (cmp_(temp_data[1].first, temp_data[0].first)) {
-      std::swap(temp_data[0], temp_data[1]);
+  template < class Key, class Value, class Cmp >
+  typename TwoThreeTree< Key, Value, Cmp >::Iterator
+  TwoThreeTree< Key, Value, Cmp >::insert_into_leaf(Node* leaf, const value_type& value)
+  {
+    const Key& key = value.first;
+    if (!leaf->is_3_node()) {
+      push_to_2node(leaf, value);
+      ++size_;
+      int new_pos = (cmp_(key, leaf->data[1].first)) ? 0 : 1;
+      return Iterator(leaf, new_pos, fake_);
     }
-    if (cmp_(temp_data[2].first, temp_data[1].first)) {
-      std::swap(temp_data[1], temp_data[2]);
+
+    size_t nodes_to_alloc_count = 0;
+    Node* full = leaf;
+    while (full != fake_ && full->is_3_node()) {
+      ++nodes_to_alloc_count;
+      full = full->parent;
     }
-    if (cmp_(temp_data[1].first, temp_data[0].first)) {
-      std::swap(temp_data[0], temp_data[1]);
+    if (full == fake_) {
+      ++nodes_to_alloc_count;
     }
 
-    value_type promoted_value = temp_data[1];
+    value_type promoted_value(value);
+    Node** preallocated_nodes = new Node* [nodes_to_alloc_count] { nullptr };
+    try {
+      for (size_t i = 0; i < nodes_to_alloc_count; ++i) {
+        preallocated_nodes[i] = new Node();
+      }
+    } catch (const std::bad_alloc&) {
+      for (size_t i = 0; i < nodes_to_alloc_count; ++i) {
+        delete preallocated_nodes[i];
+      }
+      delete[] preallocated_nodes;
+      throw;
+    }
 
-    leaf->data[0] = temp_data[0];
-    leaf->data[1] = {};
-    leaf->is_3_node = false;
+    size_t nodes_used = 0;
+    int insert_idx = cmp_(key, leaf->data[0].first) ? 0 : (cmp_(key, leaf->data[1].first) ? 1 : 2);
 
     Node* new_right_node = preallocated_nodes[nodes_used++];
-    new_right_node->data[0] = temp_data[2];
+    split_keys(leaf, promoted_value, insert_idx, new_right_node);
     new_right_node->children[0] = new_right_node->children[1] = new_right_node->children[2] = fake_;
 
+    Node* inserted_node = nullptr;
+    int inserted_pos = 0;
+    if (insert_idx != 1) {
+      inserted_node = (insert_idx == 0) ? leaf : new_right_node;
+    }
+
     Node* left_child_of_promo = leaf;
     Node* right_child_of_promo = new_right_node;
     Node* current_child = leaf;
@@ -387,7 +419,7 @@ namespace gavrilova {
 
       if (parent == fake_) {
         Node* new_root = preallocated_nodes[nodes_used++];
-        new_root->data[0] = promoted_value;
+        new_root->emplace(0, std::move(promoted_value));
         new_root->children[0] = left_child_of_promo;
         new_root->children[1] = right_child_of_promo;
         new_root->children[2] = fake_;
@@ -395,68 +427,62 @@ namespace gavrilova {
         new_root->children[0]->parent = new_root;
         new_root->children[1]->parent = new_root;
         fake_->children[0] = new_root;
+        if (!inserted_node) {
+          inserted_node = new_root;
+        }
         break;
       }
 
       right_child_of_promo->parent = parent;
 
-      if (!parent->is_3_node) {
-        if (cmp_(promoted_value.first, parent->data[0].first)) {
-          parent->data[1] = parent->data[0];
-          parent->data[0] = promoted_value;
+      if (!parent->is_3_node()) {
+        int promoted_pos = cmp_(promoted_value.first, parent->data[0].first) ? 0 : 1;
+        parent->emplace(promoted_pos, std::move(promoted_value));
+        if (promoted_pos == 0) {
           parent->children[2] = parent->children[1];
           parent->children[1] = right_child_of_promo;
         } else {
-          parent->data[1] = promoted_value;
           parent->children[2] = right_child_of_promo;
         }
-        parent->is_3_node = true;
+        if (!inserted_node) {
+          inserted_node = parent;
+          inserted_pos = promoted_pos;
+        }
         break;
       }
 
-      value_type parent_temp_data[3];
       Node* parent_temp_children[4];
       int child_idx = get_child_index(current_child);
 
       if (child_idx == 0) {
-        parent_temp_data[0] = promoted_value;
-        parent_temp_data[1] = parent->data[0];
-        parent_temp_data[2] = parent->data[1];
         parent_temp_children[0] = left_child_of_promo;
         parent_temp_children[1] = right_child_of_promo;
         parent_temp_children[2] = parent->children[1];
         parent_temp_children[3] = parent->children[2];
       } else if (child_idx == 1) {
-        parent_temp_data[0] = parent->data[0];
-        parent_temp_data[1] = promoted_value;
-        parent_temp_data[2] = parent->data[1];
         parent_temp_children[0] = parent->children[0];
         parent_temp_children[1] = left_child_of_promo;
         parent_temp_children[2] = right_child_of_promo;
         parent_temp_children[3] = parent->children[2];
       } else {
-        parent_temp_data[0] = parent->data[0];
-        parent_temp_data[1] = parent->data[1];
-        parent_temp_data[2] = promoted_value;
         parent_temp_children[0] = parent->children[0];
         parent_temp_children[1] = parent->children[1];
         parent_temp_children[2] = left_child_of_promo;
         parent_temp_children[3] = right_child_of_promo;
       }
 
-      promoted_value = parent_temp_data[1];
+      Node* new_parent_right_sibling = preallocated_nodes[nodes_used++];
+      split_keys(parent, promoted_value, child_idx, new_parent_right_sibling);
+      if (!inserted_node && child_idx != 1) {
+        inserted_node = (child_idx == 0) ? parent : new_parent_right_sibling;
+      }
 
-      parent->data[0] = parent_temp_data[0];
-      parent->data[1] = {};
-      parent->is_3_node = false;
       parent->children[0] = parent_temp_children[0];
       parent->children[1] = parent_temp_children[1];
       parent->children[2] = fake_;
       parent->children[0]->parent = parent;
       parent->children[1]->parent = parent;
 
-      Node* new_parent_right_sibling = preallocated_nodes[nodes_used++];
-      new_parent_right_sibling->data[0] = parent_temp_data[2];
       new_parent_right_sibling->children[0] = parent_temp_children[2];
       new_parent_right_sibling->children[1] = parent_temp_children[3];
       new_parent_right_sibling->children[2] = fake_;
@@ -470,7 +496,7 @@ namespace gavrilova {
 
     delete[] preallocated_nodes;
     ++size_;
-    return {find(key), true};
+    return Iterator(inserted_node, inserted_pos, fake_);
   }
 
   template < class Key, class Value, class Cmp >
@@ -488,6 +514,24 @@ namespace gavrilova {
     insert(il.begin(), il.end());
   }
 
+  template < class Key, class Value, class Cmp >
+  template < class InputIterator >
+  void TwoThreeTree< Key, Value, Cmp >::append_sorted(InputIterator first, InputIterator last)
+  {
+    Node* leaf = empty() ? nullptr : max_leaf(fake_->children[0]);
+    for (; first != last; ++first) {
+      const value_type& value = *first;
+      if (!leaf) {
+        leaf = insert(value).first.node_;
+      } else if (cmp_(leaf->data[leaf->len - 1].first, value.first)) {
+        leaf = max_leaf(insert_into_leaf(leaf, value).node_);
+      } else if (cmp_(value.first, leaf->data[leaf->len - 1].first)) {
+        insert(value);
+        leaf = max_leaf(fake_->children[0]);
+      }
+    }
+  }
+
   template < class Key, class Value, class Cmp >
   typename TwoThreeTree< Key, Value, Cmp >::Iterator
   TwoThreeTree< Key, Value, Cmp >::erase(Iterator pos)
@@ -498,7 +542,8 @@ namespace gavrilova {
 
     Iterator next_it = pos;
     ++next_it;
-    Key next_key = next_it->first;
+    bool has_next = next_it != end();
+    Key next_key = has_next ? next_it->first : Key();
 
     Node* node_to_process = pos.node_;
     int key_idx_to_remove = pos.key_pos_;
@@ -510,20 +555,16 @@ namespace gavrilova {
       key_idx_to_remove = 0;
     }
 
-    if (node_to_process->is_3_node) {
-      if (key_idx_to_remove == 0) {
-        node_to_process->data[0] = node_to_process->data[1];
-      }
-      node_to_process->data[1] = {};
-      node_to_process->is_3_node = false;
+    if (node_to_process->is_3_node()) {
+      node_to_process->erase(key_idx_to_remove);
     } else {
-      node_to_process->data[0] = {};
+      node_to_process->erase(0);
       rebalance(node_to_process);
     }
 
     --size_;
 
-    if (next_it != end()) {
+    if (has_next) {
       return find(next_key);
     } else {
       return end();
@@ -585,14 +626,14 @@ namespace gavrilova {
         return Iterator(current, 0, fake_);
       }
 
-      if (current->is_3_node) {
+      if (current->is_3_node()) {
         if (!cmp_(key, current->data[1].first) && !cmp_(current->data[1].first, key)) {
           return Iterator(current, 1, fake_);
         }
       }
       if (cmp_(key, current->data[0].first)) {
         current = current->children[0];
-      } else if (!current->is_3_node || cmp_(key, current->data[1].first)) {
+      } else if (!current->is_3_node() || cmp_(key, current->data[1].first)) {
         current = current->children[1];
       } else {
         current = current->children[2];
@@ -614,14 +655,14 @@ namespace gavrilova {
         return ConstIterator(current, 0, fake_);
       }
 
-      if (current->is_3_node) {
+      if (current->is_3_node()) {
         if (!cmp_(key, current->data[1].first) && !cmp_(current->data[1].first, key)) {
           return ConstIterator(current, 1, fake_);
         }
       }
       if (cmp_(key, current->data[0].first)) {
         current = current->children[0];
-      } else if (!current->is_3_node || cmp_(key, current->data[1].first)) {
+      } else if (!current->is_3_node() || cmp_(key, current->data[1].first)) {
         current = current->children[1];
       } else {
         current = current->children[2];
@@ -783,14 +824,14 @@ namespace gavrilova {
 
         case LNRStage::VisitRight:
           stage = LNRStage::GoRight;
-          if (node->is_3_node) {
+          if (node->is_3_node()) {
             f(node->data[1]);
           }
           break;
 
         case LNRStage::GoRight:
           stack.pop();
-          if (node->is_3_node && node->children[2] != fake_) {
+          if (node->is_3_node() && node->children[2] != fake_) {
             stack.push({node->children[2], LNRStage::GoLeft});
           }
           break;
@@ -824,7 +865,7 @@ namespace gavrilova {
     };
 
     Stack< std::pair< Node*, RNLStage > > stack;
-    if (fake_->children[0]->is_3_node) {
+    if (fake_->children[0]->is_3_node()) {
       stack.push({fake_->children[0], RNLStage::GoRight});
     } else {
       stack.push({fake_->children[0], RNLStage::GoMiddle});
@@ -841,9 +882,9 @@ namespace gavrilova {
 
       switch (stage) {
         case RNLStage::GoRight:
-          if (node->is_3_node) {
+          if (node->is_3_node()) {
             stage = RNLStage::VisitRight;
-            if (node->children[2]->is_3_node) {
+            if (node->children[2]->is_3_node()) {
               stack.push({node->children[2], RNLStage::GoRight});
             } else {
               stack.push({node->children[2], RNLStage::GoMiddle});
@@ -853,14 +894,14 @@ namespace gavrilova {
 
         case RNLStage::VisitRight:
           stage = RNLStage::GoMiddle;
-          if (node->is_3_node) {
+          if (node->is_3_node()) {
             f(node->data[1]);
           }
           break;
 
         case RNLStage::GoMiddle:
           stage = RNLStage::VisitLeft;
-          if (node->children[1]->is_3_node) {
+          if (node->children[1]->is_3_node()) {
             stack.push({node->children[1], RNLStage::GoRight});
           } else {
             stack.push({node->children[1], RNLStage::GoMiddle});
@@ -874,7 +915,7 @@ namespace gavrilova {
 
         case RNLStage::GoLeft:
           stack.pop();
-          if (node->children[0]->is_3_node) {
+          if (node->children[0]->is_3_node()) {
             stack.push({node->children[0], RNLStage::GoRight});
           } else {
             stack.push({node->children[0], RNLStage::GoMiddle});
@@ -913,7 +954,7 @@ namespace gavrilova {
       }
 
       f(current->data[0]);
-      if (current->is_3_node) {
+      if (current->is_3_node()) {
         f(current->data[1]);
       }
 
@@ -923,7 +964,7 @@ namespace gavrilova {
       if (current->children[1] != fake_) {
         queue.push(current->children[1]);
       }
-      if (current->is_3_node && current->children[2] != fake_) {
+      if (current->is_3_node() && current->children[2] != fake_) {
         queue.push(current->children[2]);
       }
     }
@@ -938,8 +979,13 @@ namespace gavrilova {
       return fake_;
     }
 
-    Node* new_node = new Node(node->data[0], node->data[1], node->is_3_node, parent, fake_, fake_, fake_);
+    Node* new_node = new Node();
+    new_node->parent = parent;
+    new_node->children[0] = new_node->children[1] = new_node->children[2] = fake_;
     try {
+      for (size_t i = 0; i < node->len; ++i) {
+        new_node->emplace(i, node->data[i]);
+      }
       for (int i = 0; i < 3; ++i) {
         new_node->children[i] = copy_subtree(node->children[i], new_node);
       }
@@ -970,45 +1016,108 @@ namespace gavrilova {
   }
 
   template < class Key, class Value, class Cmp >
-  typename TwoThreeTree< Key, Value, Cmp >::Node* TwoThreeTree< Key, Value, Cmp >::find_leaf(const Key& key, size_t& counter_for_allocate)
+  typename TwoThreeTree< Key, Value, Cmp >::Node* TwoThreeTree< Key, Value, Cmp >::find_leaf(Node* node, const Key& key, int& key_pos)
   {
-    counter_for_allocate = 0;
-    Node* current = fake_->children[0];
-    if (current->is_3_node) {
-      ++counter_for_allocate;
-    }
-    while (current != fake_ && !is_leaf(current)) {
-      if (current->is_3_node) {
-        ++counter_for_allocate;
-      } else {
-        counter_for_allocate = 0;
+    key_pos = -1;
+    while (true) {
+      for (int i = 0; i < node->len; ++i) {
+        if (!cmp_(key, node->data[i].first) && !cmp_(node->data[i].first, key)) {
+          key_pos = i;
+          return node;
+        }
       }
-      if (cmp_(key, current->data[0].first)) {
-        current = current->children[0];
-      } else if (!current->is_3_node || cmp_(key, current->data[1].first)) {
-        current = current->children[1];
+      if (is_leaf(node)) {
+        return node;
+      }
+      if (cmp_(key, node->data[0].first)) {
+        node = node->children[0];
+      } else if (!node->is_3_node() || cmp_(key, node->data[1].first)) {
+        node = node->children[1];
       } else {
-        current = current->children[2];
+        node = node->children[2];
       }
     }
-    if (current != fake_ && current->is_3_node) {
-      ++counter_for_allocate;
-    } else if (current != fake_ && !current->is_3_node) {
-      counter_for_allocate = 0;
+  }
+
+  template < class Key, class Value, class Cmp >
+  typename TwoThreeTree< Key, Value, Cmp >::Node* TwoThreeTree< Key, Value, Cmp >::finger_search(Node* finger, const Key& key)
+  {
+    // climbs until the subtree is known to bound key from both sides; a side that is
+    // inherited unchanged up to the root is unbounded, so it holds where inheritance began
+    const size_t unknown = static_cast< size_t >(-1);
+    size_t low = unknown;
+    size_t high = unknown;
+    size_t low_open = 0;
+    size_t high_open = 0;
+    Node* node = finger;
+    for (size_t level = 0; low == unknown || high == unknown; ++level) {
+      if (low == unknown && cmp_(node->data[0].first, key)) {
+        low = level;
+      }
+      if (high == unknown && cmp_(key, node->data[node->len - 1].first)) {
+        high = level;
+      }
+      if (low != unknown && high != unknown) {
+        break;
+      }
+      Node* parent = node->parent;
+      if (parent == fake_) {
+        low = (low == unknown) ? low_open : low;
+        high = (high == unknown) ? high_open : high;
+        break;
+      }
+      int idx = get_child_index(node);
+      if (low == unknown && idx > 0) {
+        if (cmp_(parent->data[idx - 1].first, key)) {
+          low = low_open;
+        } else {
+          low_open = level + 1;
+        }
+      }
+      if (high == unknown && idx < parent->len) {
+        if (cmp_(key, parent->data[idx].first)) {
+          high = high_open;
+        } else {
+          high_open = level + 1;
+        }
+      }
+      node = parent;
     }
-    return current;
+    node = finger;
+    for (size_t level = std::max(low, high); level > 0; --level) {
+      node = node->parent;
+    }
+    return node;
   }
 
   template < class Key, class Value, class Cmp >
-  void TwoThreeTree< Key, Value, Cmp >::push_to_2node(Node* node, const Key& key, const Value& value)
+  typename TwoThreeTree< Key, Value, Cmp >::Node* TwoThreeTree< Key, Value, Cmp >::max_leaf(Node* node) const
   {
-    if (cmp_(key, node->data[0].first)) {
-      node->data[1] = node->data[0];
-      node->data[0] = {key, value};
+    while (!is_leaf(node)) {
+      node = node->children[node->len];
+    }
+    return node;
+  }
+
+  template < class Key, class Value, class Cmp >
+  void TwoThreeTree< Key, Value, Cmp >::push_to_2node(Node* node, const value_type& value)
+  {
+    node->emplace(cmp_(value.first, node->data[0].first) ? 0 : 1, value);
+  }
+
+  template < class Key, class Value, class Cmp >
+  void TwoThreeTree< Key, Value, Cmp >::split_keys(Node* node, value_type& middle, int insert_idx, Node* right)
+  {
+    if (insert_idx == 0) {
+      right->emplace(0, std::move(node->data[1]));
+      std::swap(middle, node->data[0]);
+    } else if (insert_idx == 1) {
+      right->emplace(0, std::move(node->data[1]));
     } else {
-      node->data[1] = {key, value};
+      right->emplace(0, std::move(middle));
+      middle = std::move(node->data[1]);
     }
-    node->is_3_node = true;
+    node->erase(1);
   }
 
   template < class Key, class Value, class Cmp >
@@ -1017,10 +1126,9 @@ namespace gavrilova {
     int sibling_idx = get_child_index(sibling);
 
     if (sibling_idx < deficient_idx) {
-      deficient_node->data[0] = parent->data[sibling_idx];
-      parent->data[sibling_idx] = sibling->data[1];
-      sibling->data[1] = {};
-      sibling->is_3_node = false;
+      deficient_node->emplace(0, std::move(parent->data[sibling_idx]));
+      parent->data[sibling_idx] = std::move(sibling->data[1]);
+      sibling->erase(1);
 
       if (!is_leaf(sibling)) {
         deficient_node->children[1] = deficient_node->children[0];
@@ -1031,11 +1139,9 @@ namespace gavrilova {
         sibling->children[2] = fake_;
       }
     } else {
-      deficient_node->data[0] = parent->data[deficient_idx];
-      parent->data[deficient_idx] = sibling->data[0];
-      sibling->data[0] = sibling->data[1];
-      sibling->data[1] = {};
-      sibling->is_3_node = false;
+      deficient_node->emplace(0, std::move(parent->data[deficient_idx]));
+      parent->data[deficient_idx] = std::move(sibling->data[0]);
+      sibling->erase(0);
 
       if (!is_leaf(sibling)) {
         deficient_node->children[1] = sibling->children[0];
@@ -1074,12 +1180,12 @@ namespace gavrilova {
     Node* left_sibling = (child_idx > 0) ? parent->children[child_idx - 1] : nullptr;
     Node* right_sibling = (child_idx < 2 && parent->children[child_idx + 1] != fake_) ? parent->children[child_idx + 1] : nullptr;
 
-    if (left_sibling && left_sibling->is_3_node) {
+    if (left_sibling && left_sibling->is_3_node()) {
       rotation(node, left_sibling, parent, child_idx);
       return;
     }
 
-    if (right_sibling && right_sibling->is_3_node) {
+    if (right_sibling && right_sibling->is_3_node()) {
       rotation(node, right_sibling, parent, child_idx);
       return;
     }
@@ -1098,8 +1204,7 @@ namespace gavrilova {
     Node* node_to_delete = nullptr;
 
     if (sibling_idx < deficient_idx) {
-      sibling->data[1] = parent->data[sibling_idx];
-      sibling->is_3_node = true;
+      sibling->emplace(1, std::move(parent->data[sibling_idx]));
 
       sibling->children[2] = deficient_node->children[0];
       if (sibling->children[2] != fake_) {
@@ -1110,9 +1215,8 @@ namespace gavrilova {
     }
 
     else {
-      deficient_node->data[0] = parent->data[deficient_idx];
-      deficient_node->data[1] = sibling->data[0];
-      deficient_node->is_3_node = true;
+      deficient_node->emplace(0, std::move(parent->data[deficient_idx]));
+      deficient_node->emplace(1, std::move(sibling->data[0]));
 
       deficient_node->children[1] = sibling->children[0];
       deficient_node->children[2] = sibling->children[1];
@@ -1129,12 +1233,8 @@ namespace gavrilova {
     int key_idx_to_remove = std::min(sibling_idx, deficient_idx);
     int child_idx_to_remove = get_child_index(node_to_delete);
 
-    if (parent->is_3_node) {
-      if (key_idx_to_remove == 0) {
-        parent->data[0] = parent->data[1];
-      }
-    }
-    parent->data[parent->is_3_node ? 1 : 0] = {};
+    bool parent_was_3_node = parent->is_3_node();
+    parent->erase(key_idx_to_remove);
 
     for (int i = child_idx_to_remove; i < 2; ++i) {
       parent->children[i] = parent->children[i + 1];
@@ -1143,9 +1243,7 @@ namespace gavrilova {
 
     delete node_to_delete;
 
-    if (parent->is_3_node) {
-      parent->is_3_node = false;
-    } else {
+    if (!parent_was_3_node) {
       rebalance(parent);
     }
   }
@@ -1163,7 +1261,7 @@ namespace gavrilova {
     if (parent->children[1] == child) {
       return 1;
     }
-    if (parent->is_3_node && parent->children[2] == child) {
+    if (parent->is_3_node() && parent->children[2] == child) {
       return 2;
     }
     return -1;
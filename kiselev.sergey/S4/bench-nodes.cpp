@@ -0,0 +1,80 @@
+#define BENCH_MAIN
+#include <harness.hpp>
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include <tree.hpp>
+
+namespace
+{
+  struct ColorFieldNode
+  {
+    kiselev::Color color;
+    ColorFieldNode* left;
+    ColorFieldNode* right;
+    ColorFieldNode* parent;
+    size_t size;
+    std::pair< int, std::string > data;
+  };
+
+  using Tree = kiselev::RBTree< int, std::string >;
+  using Node = kiselev::TreeNode< int, std::string >;
+
+  constexpr size_t keyCount = 1 << 18;
+
+  std::vector< int > shuffledKeys(unsigned seed)
+  {
+    std::vector< int > keys(keyCount);
+    for (size_t i = 0; i < keyCount; ++i)
+    {
+      keys[i] = static_cast< int >(i);
+    }
+    std::mt19937 gen(seed);
+    std::shuffle(keys.begin(), keys.end(), gen);
+    return keys;
+  }
+
+  void build(Tree& tree, const std::vector< int >& keys)
+  {
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+      tree.insert({ keys[i], "v" });
+    }
+  }
+}
+
+BENCH_CASE(node_build)
+{
+  std::clog << "color field node: " << sizeof(ColorFieldNode) << " bytes, ";
+  std::clog << "packed color node: " << sizeof(Node) << " bytes\n";
+  std::clog << "nodes of " << keyCount << " keys: " << sizeof(ColorFieldNode) * keyCount << " -> ";
+  std::clog << sizeof(Node) * keyCount << " bytes\n";
+  std::vector< int > keys = shuffledKeys(42);
+  state.setItems(keyCount);
+  state.setBytes(sizeof(Node) * keyCount);
+  state.run([&keys]()
+  {
+    Tree tree;
+    build(tree, keys);
+    bench::doNotOptimize(tree);
+  });
+}
+
+BENCH_CASE(node_lookup)
+{
+  Tree tree;
+  build(tree, shuffledKeys(42));
+  std::vector< int > keys = shuffledKeys(7);
+  state.setItems(keyCount);
+  state.run([&tree, &keys]()
+  {
+    size_t found = 0;
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+      found += tree.count(keys[i]);
+    }
+    bench::doNotOptimize(found);
+  });
+}
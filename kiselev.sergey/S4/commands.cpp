@@ -26,17 +26,10 @@ void kiselev::complement(std::istream& in, dataset& dict)
   std::string firstName;
   std::string secondName;
   in >> newName >> firstName >> secondName;
-  data newTree;
-  data firstTree = dict.at(firstName);
-  data secondTree = dict.at(secondName);
-  for (auto it = firstTree.cbegin(); it != firstTree.cend(); ++it)
-  {
-    if (secondTree.find(it->first) == secondTree.end())
-    {
-      newTree.insert(*it);
-    }
-  }
-  dict[newName] = newTree;
+  const data& secondTree = dict.at(secondName);
+  data newTree = dict.at(firstName);
+  newTree.subtract(secondTree);
+  dict[newName] = std::move(newTree);
 }
 
 void kiselev::intersect(std::istream& in, dataset& dict)
@@ -45,17 +38,10 @@ void kiselev::intersect(std::istream& in, dataset& dict)
   std::string firstName;
   std::string secondName;
   in >> newName >> firstName >> secondName;
-  data newTree;
-  data firstTree = dict.at(firstName);
-  data secondTree = dict.at(secondName);
-  for (auto it = firstTree.cbegin(); it != firstTree.cend(); ++it)
-  {
-    if (secondTree.find(it->first) != secondTree.end())
-    {
-      newTree.insert(*it);
-    }
-  }
-  dict[newName] = newTree;
+  const data& secondTree = dict.at(secondName);
+  data newTree = dict.at(firstName);
+  newTree.intersect(secondTree);
+  dict[newName] = std::move(newTree);
 }
 
 void kiselev::unite(std::istream& in, dataset& dict)
@@ -64,14 +50,8 @@ void kiselev::unite(std::istream& in, dataset& dict)
   std::string firstName;
   std::string secondName;
   in >> newName >> firstName >> secondName;
-  data firstTree = dict.at(firstName);
-  data secondTree = dict.at(secondName);
-  data newTree = firstTree;
-  for (auto it = secondTree.cbegin(); it != secondTree.cend(); ++it)
-  {
-    newTree.insert(*it);
-  }
-  dict[newName] = newTree;
+  const data& secondTree = dict.at(secondName);
+  data newTree = dict.at(firstName);
+  newTree.unite(secondTree);
+  dict[newName] = std::move(newTree);
 }
-
-
@@ -1,9 +1,69 @@
+#include <algorithm>
+#include <string>
 #include <boost/test/unit_test.hpp>
 #include <boost/test/unit_test_suite.hpp>
 #include "tree.hpp"
 
 using namespace kiselev;
 
+namespace
+{
+  using Tree = RBTree< size_t, std::string >;
+  using Node = TreeNode< size_t, std::string >;
+
+  size_t checkNode(const Node* node, size_t& count)
+  {
+    if (!node)
+    {
+      return 0;
+    }
+    size_t before = count++;
+    BOOST_TEST(!(node->left && node->left->parent() != node));
+    BOOST_TEST(!(node->right && node->right->parent() != node));
+    bool redChild = (node->left && node->left->color() == Color::RED) || (node->right && node->right->color() == Color::RED);
+    BOOST_TEST(!(node->color() == Color::RED && redChild));
+    size_t left = checkNode(node->left, count);
+    size_t right = checkNode(node->right, count);
+    BOOST_TEST(left == right);
+    BOOST_TEST(node->size == count - before);
+    return left + (node->color() == Color::BLACK);
+  }
+
+  void checkTree(const Tree& tree)
+  {
+    const Node* root = tree.getMax();
+    while (root && root->parent())
+    {
+      root = root->parent();
+    }
+    size_t count = 0;
+    if (root)
+    {
+      BOOST_CHECK(root->color() == Color::BLACK);
+    }
+    checkNode(root, count);
+    BOOST_TEST(count == tree.size());
+    size_t iterated = 0;
+    for (auto it = tree.cbegin(); it != tree.cend(); ++it, ++iterated)
+    {
+      auto next = it;
+      ++next;
+      BOOST_TEST(!(next != tree.cend() && next->first <= it->first));
+    }
+    BOOST_TEST(iterated == tree.size());
+  }
+
+  Tree makeTree(size_t first, size_t last, size_t step)
+  {
+    Tree tree;
+    for (size_t i = first; i < last; i += step)
+    {
+      tree.insert({ i, std::to_string(i) });
+    }
+    return tree;
+  }
+}
+
 BOOST_AUTO_TEST_SUITE(tree)
 
 BOOST_AUTO_TEST_CASE(constructors)
@@ -107,6 +167,23 @@ BOOST_AUTO_TEST_CASE(erase_position)
   tree.erase(tree.cbegin(), tree.cend());
   BOOST_TEST(tree.empty());
 }
+BOOST_AUTO_TEST_CASE(erase_keeps_balance)
+{
+  Tree tree = makeTree(0, 256, 1);
+  for (size_t i = 0; i < 256; ++i)
+  {
+    size_t key = i * 37 % 256;
+    BOOST_TEST(tree.erase(key) == 1);
+    tree.insert({ key + 256, std::to_string(key + 256) });
+    checkTree(tree);
+  }
+  for (size_t i = 0; i < 256; ++i)
+  {
+    BOOST_TEST(tree.erase(i * 101 % 256 + 256) == 1);
+    checkTree(tree);
+  }
+  BOOST_TEST(tree.empty());
+}
 BOOST_AUTO_TEST_CASE(emplace_element_and_hint)
 {
   RBTree< size_t, std::string > tree;
@@ -159,4 +236,136 @@ BOOST_AUTO_TEST_CASE(count_lowerBound_upperBound_equalRange)
   BOOST_CHECK(first == tree.equalRange(3).first);
   BOOST_CHECK(it == tree.equalRange(3).second);
 }
+
+BOOST_AUTO_TEST_CASE(split_and_join)
+{
+  Tree tree = makeTree(0, 100, 1);
+  Tree less;
+  Tree greater;
+  tree.split(40, less, greater);
+  BOOST_TEST(tree.empty());
+  BOOST_TEST(less.size() == 40);
+  BOOST_TEST(greater.size() == 60);
+  BOOST_TEST(greater.cbegin()->first == 40);
+  checkTree(less);
+  checkTree(greater);
+  greater.split(80, tree, greater);
+  BOOST_TEST(tree.size() == 40);
+  BOOST_TEST(greater.size() == 20);
+  checkTree(tree);
+  checkTree(greater);
+  Tree joined;
+  joined.join(less, { 1000, "pivot" }, joined);
+  BOOST_TEST(joined.size() == 41);
+  checkTree(joined);
+  Tree small = makeTree(2000, 2003, 1);
+  Tree result;
+  result.join(joined, { 1500, "pivot" }, small);
+  BOOST_TEST(result.size() == 45);
+  BOOST_TEST(joined.empty());
+  BOOST_TEST(small.empty());
+  checkTree(result);
+}
+
+BOOST_AUTO_TEST_CASE(split_then_update_before_size)
+{
+  Tree tree = makeTree(0, 200, 1);
+  Tree less;
+  Tree greater;
+  tree.split(120, less, greater);
+  less.insert({ 1000, "1000" });
+  less.subtract(makeTree(5, 8, 2));
+  greater.unite(makeTree(190, 260, 1));
+  greater.subtract(makeTree(150, 160, 1));
+  BOOST_TEST(less.size() == 119);
+  BOOST_TEST(greater.size() == 130);
+  checkTree(less);
+  checkTree(greater);
+  Tree joined;
+  tree = makeTree(0, 50, 1);
+  tree.subtract(makeTree(20, 21, 1));
+  tree.split(20, less, greater);
+  joined.join(less, { 20, "pivot" }, greater);
+  BOOST_TEST(joined.size() == 50);
+  checkTree(joined);
+  tree = makeTree(0, 10, 1);
+  tree.split(20, less, greater);
+  BOOST_TEST(less.size() == 10);
+  BOOST_TEST(greater.empty());
+}
+
+BOOST_AUTO_TEST_CASE(split_sizes)
+{
+  for (size_t key = 0; key <= 64; key += 3)
+  {
+    Tree tree = makeTree(0, 64, 1);
+    Tree less;
+    Tree greater;
+    tree.split(key, less, greater);
+    BOOST_TEST(tree.empty());
+    BOOST_TEST(less.size() == std::min< size_t >(key, 64));
+    BOOST_TEST(greater.size() == 64 - std::min< size_t >(key, 64));
+    checkTree(less);
+    checkTree(greater);
+    less.insert({ 500, "500" });
+    BOOST_TEST(less.size() == std::min< size_t >(key, 64) + 1);
+    checkTree(less);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(set_operations)
+{
+  Tree first = makeTree(0, 30, 2);
+  Tree second = makeTree(0, 30, 3);
+  second[0] = "zero";
+  Tree united(first);
+  united.unite(second);
+  BOOST_TEST(united.size() == 20);
+  BOOST_TEST(united.at(0) == "0");
+  BOOST_TEST(united.count(9) == 1);
+  checkTree(united);
+  Tree common(first);
+  common.intersect(second);
+  BOOST_TEST(common.size() == 5);
+  BOOST_TEST(common.at(6) == "6");
+  checkTree(common);
+  Tree difference(first);
+  difference.subtract(second);
+  BOOST_TEST(difference.size() == 10);
+  BOOST_TEST(difference.count(6) == 0);
+  checkTree(difference);
+  difference.subtract(difference);
+  BOOST_TEST(difference.empty());
+  BOOST_TEST(second.size() == 10);
+  checkTree(second);
+}
+
+BOOST_AUTO_TEST_CASE(set_operations_unbalanced)
+{
+  for (size_t step = 1; step < 400; step += 37)
+  {
+    Tree big = makeTree(0, 3000, 1);
+    Tree small = makeTree(step, 3500, step * 7);
+    size_t smallSize = small.size();
+    size_t inside = 0;
+    for (auto it = small.cbegin(); it != small.cend(); ++it)
+    {
+      inside += it->first < 3000;
+    }
+    Tree united(small);
+    united.unite(big);
+    BOOST_TEST(united.size() == 3000 + smallSize - inside);
+    checkTree(united);
+    Tree common(small);
+    common.intersect(big);
+    BOOST_TEST(common.size() == inside);
+    checkTree(common);
+    big.subtract(small);
+    BOOST_TEST(big.size() == 3000 - inside);
+    checkTree(big);
+    small.subtract(big);
+    BOOST_TEST(small.size() == smallSize);
+    checkTree(small);
+  }
+}
 BOOST_AUTO_TEST_SUITE_END();
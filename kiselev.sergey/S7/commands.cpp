@@ -1,12 +1,9 @@
 #include "commands.hpp"
 #include <cstddef>
-#include <list>
 #include <map>
+#include <set>
 #include <stdexcept>
 #include <string>
-#include <unordered_map>
-#include <unordered_set>
-#include <vector>
 #include "graph.hpp"
 
 namespace
@@ -21,12 +18,12 @@ namespace
     {
       throw std::logic_error("<INVALID COMMAND>");
     }
-    std::set< std::string > vertexes = graphIt->second.getVertexes();
+    const std::set< std::string >& vertexes = graphIt->second.getVertexes();
     if (vertexes.empty() && vertexes.find(vertex) == vertexes.end())
     {
       throw std::logic_error("INVALID COMMAND");
     }
-    kiselev::Graph::MapHash bound;
+    kiselev::Graph::Bound bound;
     if (b == "out")
     {
       bound = graphIt->second.getOutBound(vertex);
@@ -42,28 +39,14 @@ namespace
     }
     for (auto it = bound.begin(); it != bound.end(); ++it)
     {
-      out << it->first;
-      for (auto weightIt = it->second.begin(); weightIt != it->second.end(); ++weightIt)
+      out << *it->first;
+      for (auto weightIt = it->second->begin(); weightIt != it->second->end(); ++weightIt)
       {
-        for (size_t i = 0; i < weightIt->second; ++i)
-        {
-          out << " " << weightIt->first;
-        }
+        out << " " << *weightIt;
       }
       out << "\n";
     }
   }
-
-  void addEdges(kiselev::Graph& newGraph, const kiselev::Graph::Edge& edges)
-  {
-    for (auto it = edges.cbegin(); it != edges.cend(); ++it)
-    {
-      for (auto weightIt = it->second.begin(); weightIt != it->second.end(); ++weightIt)
-      {
-        newGraph.addEdge(it->first.first, it->first.second, *weightIt);
-      }
-    }
-  }
 }
 
 void kiselev::input(std::istream& in, Graphs& graphs)
@@ -112,7 +95,7 @@ void kiselev::vertexes(std::ostream& out, std::istream& in, const Graphs& graphs
   {
     throw std::logic_error("<INVALID COMMAND>");
   }
-  std::set< std::string > vertexes = it->second.getVertexes();
+  const std::set< std::string >& vertexes = it->second.getVertexes();
   if (vertexes.empty())
   {
     out << "\n";
@@ -206,8 +189,8 @@ void kiselev::merge(std::istream& in, Graphs& graphs)
     throw std::logic_error("<INVALID COMMAND>");
   }
   Graph result;
-  addEdges(result, graphs.at(gr1).getEdges());
-  addEdges(result, graphs.at(gr2).getEdges());
+  result.addGraph(graphs.at(gr1));
+  result.addGraph(graphs.at(gr2));
   graphs[newGraph] = result;
 }
 
@@ -232,28 +215,14 @@ void kiselev::extract(std::istream& in, Graphs& graphs)
     in >> vertex;
     vertexes1.insert(vertex);
   }
-  std::set< std::string > vertexes2 = graphs.at(graph).getVertexes();
+  const Graph& source = graphs.at(graph);
   for (auto vertexIt = vertexes1.begin(); vertexIt != vertexes1.end(); ++vertexIt)
   {
-    if (vertexes2.find(*vertexIt) == vertexes2.end())
+    if (!source.hasVertex(*vertexIt))
     {
       throw std::logic_error("INVALID COMMAND");
     }
   }
-  Graph result;
-  Graph::Edge edge = graphs.at(graph).getEdges();
-  for (auto edgeIt = edge.begin(); edgeIt != edge.end(); ++edgeIt)
-  {
-    auto it1 = vertexes1.find(edgeIt->first.first);
-    auto it2 = vertexes1.find(edgeIt->first.second);
-    if (it1 != vertexes1.end() && it2 != vertexes1.end())
-    {
-      const std::list< unsigned int >& weights = edgeIt->second;
-      for (auto weightIt = weights.begin(); weightIt != weights.end(); ++weightIt)
-      {
-        result.addEdge(edgeIt->first.first, edgeIt->first.second, *weightIt);
-      }
-    }
-  }
+  Graph result = source.subgraph(vertexes1);
   graphs[newGraph] = result;
 }
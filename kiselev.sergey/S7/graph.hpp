@@ -1,112 +1,254 @@
 #ifndef GRAPH_HPP
 #define GRAPH_HPP
-#include <boost/container_hash/hash.hpp>
-#include <boost/container_hash/hash_fwd.hpp>
+#include <algorithm>
 #include <cstddef>
-#include <unordered_map>
+#include <memory>
 #include <set>
-#include <list>
-#include <map>
 #include <string>
-#include <functional>
 #include <utility>
 #include <vector>
 #include "hashTable.hpp"
-namespace detail
-{
-  struct PairHash1
-  {
-    size_t operator()(const std::pair< std::string, std::string >& pair) const
-    {
-      size_t h = std::hash< std::string >()(pair.first);
-      boost::hash_combine(h, pair.second);
-      return h;
-    }
-  };
-
-  struct PairHash2
-  {
-    size_t operator()(const std::pair< std::string, std::string >& pair) const
-    {
-      size_t h = kiselev::BoostHash< std::string >()(pair.first);
-      boost::hash_combine(h, pair.second);
-      return h;
-    }
-  };
-}
 
 namespace kiselev
 {
   class Graph
   {
   public:
-    using Vertexes = std::pair< std::string, std::string >;
-    using Edge = HashTable< Vertexes, std::list< unsigned int >, detail::PairHash1, detail::PairHash2 >;
-    using MapHash = std::map< std::string, HashTable< unsigned int, unsigned int, std::hash< unsigned int >, BoostHash< unsigned int > > >;
+    using Weights = std::vector< unsigned int >;
+    using Bound = std::vector< std::pair< const std::string*, const Weights* > >;
+
+    struct Csr
+    {
+      std::vector< std::string > names;
+      std::vector< size_t > rows;
+      std::vector< unsigned int > targets;
+      std::vector< size_t > weightRows;
+      Weights weights;
+    };
 
     void addEdge(const std::string& v1, const std::string& v2, unsigned int weight)
     {
-      edges[{ v1, v2 }].push_back(weight);
+      unsigned int from = intern(v1);
+      addEdge(from, intern(v2), weight);
     }
 
     bool removeEdge(const std::string& v1, const std::string& v2, unsigned int weight)
     {
-      auto it = edges.find({ v1, v2 });
-      if (it == edges.end())
+      auto fromIt = ids_.find(v1);
+      auto toIt = ids_.find(v2);
+      if (fromIt == ids_.end() || toIt == ids_.end())
+      {
+        return false;
+      }
+      unsigned int from = fromIt->second;
+      unsigned int to = toIt->second;
+      auto it = edges_.find(key(from, to));
+      if (it == edges_.end())
       {
         return false;
       }
-      size_t size1 = it->second.size();
-      it->second.remove(weight);
-      size_t size2 = it->second.size();
-      if (it->second.empty())
+      Weights& weights = it->second;
+      auto range = std::equal_range(weights.begin(), weights.end(), weight);
+      if (range.first == range.second)
       {
-        edges.erase(it);
+        return false;
       }
-      return size2 < size1;
+      weights.erase(range.first, range.second);
+      snapshot_.reset();
+      if (weights.empty())
+      {
+        edges_.erase(it);
+        unlink(out_[from], to);
+        unlink(in_[to], from);
+        release(from);
+        release(to);
+      }
+      return true;
     }
 
-    std::set< std::string > getVertexes() const
+    bool hasVertex(const std::string& v) const
     {
-      std::set< std::string > vertexes;
-      for (auto it = edges.cbegin(); it != edges.cend(); ++it)
-      {
-        vertexes.insert(it->first.first);
-        vertexes.insert(it->first.second);
-      }
-      return vertexes;
+      return vertexes_.find(v) != vertexes_.end();
     }
 
-    MapHash getOutBound(const std::string& v) const
+    const std::set< std::string >& getVertexes() const noexcept
+    {
+      return vertexes_;
+    }
+
+    Bound getOutBound(const std::string& v) const
     {
       return getBound(v, true);
     }
-    MapHash getInBound(const std::string& v) const
+    Bound getInBound(const std::string& v) const
     {
       return getBound(v, false);
     }
 
-    const Edge& getEdges() const
+    void addGraph(const Graph& other)
     {
-      return edges;
+      std::shared_ptr< const Csr > csr = other.snapshot();
+      std::vector< unsigned int > ids;
+      ids.reserve(csr->names.size());
+      for (size_t i = 0; i < csr->names.size(); ++i)
+      {
+        ids.push_back(intern(csr->names[i]));
+      }
+      for (size_t v = 0; v < ids.size(); ++v)
+      {
+        for (size_t e = csr->rows[v]; e < csr->rows[v + 1]; ++e)
+        {
+          for (size_t w = csr->weightRows[e]; w < csr->weightRows[e + 1]; ++w)
+          {
+            addEdge(ids[v], ids[csr->targets[e]], csr->weights[w]);
+          }
+        }
+      }
     }
-  private:
-    Edge edges;
-    MapHash getBound(const std::string& v, bool isOut) const
+
+    Graph subgraph(const std::set< std::string >& vertexes) const
+    {
+      std::shared_ptr< const Csr > csr = snapshot();
+      const unsigned int none = names_.size();
+      std::vector< unsigned int > mapped(names_.size(), none);
+      std::vector< unsigned int > chosen;
+      Graph result;
+      for (auto it = vertexes.begin(); it != vertexes.end(); ++it)
+      {
+        auto idIt = ids_.find(*it);
+        if (idIt != ids_.cend())
+        {
+          chosen.push_back(idIt->second);
+          mapped[idIt->second] = result.intern(*it);
+        }
+      }
+      for (size_t i = 0; i < chosen.size(); ++i)
+      {
+        unsigned int v = chosen[i];
+        for (size_t e = csr->rows[v]; e < csr->rows[v + 1]; ++e)
+        {
+          unsigned int to = mapped[csr->targets[e]];
+          if (to == none)
+          {
+            continue;
+          }
+          for (size_t w = csr->weightRows[e]; w < csr->weightRows[e + 1]; ++w)
+          {
+            result.addEdge(mapped[v], to, csr->weights[w]);
+          }
+        }
+      }
+      return result;
+    }
+
+    std::shared_ptr< const Csr > snapshot() const
     {
-      MapHash result;
-      for (auto it = edges.cbegin(); it != edges.cend(); ++it)
+      if (!snapshot_)
       {
-        const std::string& current = isOut ? it->first.first : it->first.second;
-        if (current == v)
+        std::shared_ptr< Csr > csr = std::make_shared< Csr >();
+        csr->names = names_;
+        csr->rows.reserve(names_.size() + 1);
+        csr->rows.push_back(0);
+        csr->targets.reserve(edges_.size());
+        csr->weightRows.reserve(edges_.size() + 1);
+        csr->weightRows.push_back(0);
+        for (unsigned int v = 0; v < names_.size(); ++v)
         {
-          std::string other = isOut ? it->first.second : it->first.first;
-          for (auto weightIt = it->second.begin(); weightIt != it->second.end(); ++weightIt)
+          std::vector< unsigned int > targets(out_[v]);
+          std::sort(targets.begin(), targets.end());
+          for (size_t i = 0; i < targets.size(); ++i)
           {
-            result[other][*weightIt]++;
+            const Weights& weights = edges_.find(key(v, targets[i]))->second;
+            csr->targets.push_back(targets[i]);
+            csr->weights.insert(csr->weights.end(), weights.begin(), weights.end());
+            csr->weightRows.push_back(csr->weights.size());
           }
+          csr->rows.push_back(csr->targets.size());
         }
+        snapshot_ = csr;
+      }
+      return snapshot_;
+    }
+  private:
+    std::vector< std::string > names_;
+    HashTable< std::string, unsigned int > ids_;
+    std::set< std::string > vertexes_;
+    std::vector< std::vector< unsigned int > > out_;
+    std::vector< std::vector< unsigned int > > in_;
+    HashTable< unsigned long long, Weights > edges_;
+    mutable std::shared_ptr< const Csr > snapshot_;
+
+    static unsigned long long key(unsigned int from, unsigned int to) noexcept
+    {
+      return (static_cast< unsigned long long >(from) << 32) | to;
+    }
+
+    unsigned int intern(const std::string& v)
+    {
+      auto it = ids_.find(v);
+      if (it != ids_.end())
+      {
+        return it->second;
+      }
+      unsigned int id = names_.size();
+      names_.push_back(v);
+      out_.emplace_back();
+      in_.emplace_back();
+      ids_[v] = id;
+      snapshot_.reset();
+      return id;
+    }
+
+    void addEdge(unsigned int from, unsigned int to, unsigned int weight)
+    {
+      Weights& weights = edges_[key(from, to)];
+      if (weights.empty())
+      {
+        out_[from].push_back(to);
+        in_[to].push_back(from);
+        vertexes_.insert(names_[from]);
+        vertexes_.insert(names_[to]);
+      }
+      weights.insert(std::upper_bound(weights.begin(), weights.end(), weight), weight);
+      snapshot_.reset();
+    }
+
+    static void unlink(std::vector< unsigned int >& adjacent, unsigned int v)
+    {
+      auto it = std::find(adjacent.begin(), adjacent.end(), v);
+      *it = adjacent.back();
+      adjacent.pop_back();
+    }
+
+    void release(unsigned int v)
+    {
+      if (out_[v].empty() && in_[v].empty())
+      {
+        vertexes_.erase(names_[v]);
+      }
+    }
+
+    Bound getBound(const std::string& v, bool isOut) const
+    {
+      Bound result;
+      auto it = ids_.find(v);
+      if (it == ids_.cend())
+      {
+        return result;
       }
+      unsigned int id = it->second;
+      const std::vector< unsigned int >& adjacent = isOut ? out_[id] : in_[id];
+      result.reserve(adjacent.size());
+      for (size_t i = 0; i < adjacent.size(); ++i)
+      {
+        unsigned int other = adjacent[i];
+        const Weights& weights = edges_.find(isOut ? key(id, other) : key(other, id))->second;
+        result.emplace_back(&names_[other], &weights);
+      }
+      std::sort(result.begin(), result.end(), [](const Bound::value_type& lhs, const Bound::value_type& rhs)
+      {
+        return *lhs.first < *rhs.first;
+      });
       return result;
     }
   };
@@ -104,7 +104,7 @@ namespace kiselev
 
     Value& at(const Key& key)
     {
-      return const_cast< Value& >(static_cast< const HashTable< Key, Value, Hash1, Hash2, Equal > >(*this).at(key));
+      return const_cast< Value& >(static_cast< const HashTable< Key, Value, Hash1, Hash2, Equal >& >(*this).at(key));
     }
 
     const Value& at(const Key& key) const
@@ -381,7 +381,10 @@ namespace kiselev
         return;
       }
       HashTable< Key, Value, Hash1, Hash2, Equal > newTable(count);
-      newTable.insert(this->cbegin(), this->cend());
+      for (ConstIterator it = cbegin(); it != cend(); ++it)
+      {
+        newTable.insert(*it);
+      }
       swap(newTable);
     }
 
@@ -0,0 +1,71 @@
+#include <set>
+#include <string>
+#include <boost/test/tools/interface.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include "graph.hpp"
+BOOST_AUTO_TEST_CASE(graph)
+{
+  kiselev::Graph graph;
+  BOOST_TEST(graph.getVertexes().empty());
+  graph.addEdge("b", "a", 3);
+  graph.addEdge("b", "a", 1);
+  graph.addEdge("b", "c", 2);
+  graph.addEdge("c", "b", 5);
+  BOOST_TEST(graph.getVertexes().size() == 3);
+  BOOST_TEST(graph.hasVertex("a"));
+  kiselev::Graph::Bound out = graph.getOutBound("b");
+  BOOST_TEST(out.size() == 2);
+  BOOST_TEST(*out[0].first == "a");
+  BOOST_TEST(out[0].second->size() == 2);
+  BOOST_TEST(out[0].second->front() == 1);
+  BOOST_TEST(*out[1].first == "c");
+  BOOST_TEST(graph.getInBound("b").size() == 1);
+  BOOST_TEST(!graph.removeEdge("b", "a", 2));
+  BOOST_TEST(graph.removeEdge("b", "a", 1));
+  BOOST_TEST(graph.removeEdge("b", "a", 3));
+  BOOST_TEST(!graph.hasVertex("a"));
+  BOOST_TEST(graph.getOutBound("b").size() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(graph_snapshot)
+{
+  kiselev::Graph graph;
+  graph.addEdge("a", "b", 1);
+  graph.addEdge("a", "b", 1);
+  graph.addEdge("b", "c", 2);
+  graph.addEdge("c", "a", 3);
+  auto csr = graph.snapshot();
+  BOOST_TEST(csr->targets.size() == 3);
+  BOOST_TEST(csr->weights.size() == 4);
+  BOOST_TEST(csr == graph.snapshot());
+  graph.addEdge("a", "c", 4);
+  BOOST_TEST(csr != graph.snapshot());
+  BOOST_TEST(csr->targets.size() == 3);
+  kiselev::Graph sub = graph.subgraph({ "a", "b" });
+  BOOST_TEST(sub.getVertexes().size() == 2);
+  BOOST_TEST(sub.getOutBound("a").front().second->size() == 2);
+  BOOST_TEST(sub.getInBound("a").empty());
+  kiselev::Graph merged;
+  merged.addGraph(sub);
+  merged.addGraph(graph);
+  BOOST_TEST(merged.getOutBound("a").front().second->size() == 4);
+  BOOST_TEST(merged.getVertexes().size() == 3);
+}
+
+BOOST_AUTO_TEST_CASE(graph_remove_duplicate_weights)
+{
+  kiselev::Graph graph;
+  graph.addEdge("a", "b", 4);
+  graph.addEdge("a", "b", 4);
+  graph.addEdge("a", "b", 7);
+  BOOST_TEST(graph.getOutBound("a").front().second->size() == 3);
+  BOOST_TEST(graph.removeEdge("a", "b", 4));
+  kiselev::Graph::Bound out = graph.getOutBound("a");
+  BOOST_TEST(out.size() == 1);
+  BOOST_TEST(out.front().second->size() == 1);
+  BOOST_TEST(out.front().second->front() == 7);
+  BOOST_TEST(!graph.removeEdge("a", "b", 4));
+  BOOST_TEST(graph.removeEdge("a", "b", 7));
+  BOOST_TEST(graph.getVertexes().empty());
+}
@@ -89,11 +89,11 @@ namespace kiselev
       }
       else
       {
-        while (node_->parent && node_ == node_->parent->right)
+        while (node_->parent() && node_ == node_->parent()->right)
         {
-          node_ = node_->parent;
+          node_ = node_->parent();
         }
-        node_ = node_->parent;
+        node_ = node_->parent();
       }
       if (!node_)
       {
@@ -131,11 +131,11 @@ namespace kiselev
           }
           return iterator(node_);
         }
-        while (node_->parent && node_ == node_->parent->left)
+        while (node_->parent() && node_ == node_->parent()->left)
         {
-          node_ = node_->parent;
+          node_ = node_->parent();
         }
-        node_ = node_->parent;
+        node_ = node_->parent();
       }
       return *this;
     }
@@ -1,6 +1,8 @@
 #ifndef TREE_HPP
 #define TREE_HPP
+#include <algorithm>
 #include <initializer_list>
+#include <memory>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
@@ -97,6 +99,13 @@ namespace kiselev
     void swap(RBTree< Key, Value, Cmp >&) noexcept;
     void clear() noexcept;
 
+    void split(const Key&, RBTree< Key, Value, Cmp >& less, RBTree< Key, Value, Cmp >& greater) noexcept;
+    void join(RBTree< Key, Value, Cmp >& less, const value& pivot, RBTree< Key, Value, Cmp >& greater);
+    void unite(const RBTree< Key, Value, Cmp >&);
+    void unite(RBTree< Key, Value, Cmp >&&) noexcept;
+    void intersect(const RBTree< Key, Value, Cmp >&) noexcept;
+    void subtract(const RBTree< Key, Value, Cmp >&) noexcept;
+
     Iterator find(const Key&) noexcept;
     ConstIterator find(const Key&) const noexcept;
     size_t count(const Key&) const noexcept;
@@ -112,10 +121,33 @@ namespace kiselev
   private:
     using Node = TreeNode< Key, Value>;
 
-    void rotateLeft(Node* node) noexcept;
-    void rotateRight(Node* node) noexcept;
+    struct Part
+    {
+      Node* root;
+      size_t height;
+    };
+
+    static void rotateLeft(Node*& root, Node* node) noexcept;
+    static void rotateRight(Node*& root, Node* node) noexcept;
+    static void fixRed(Node*& root, Node* node) noexcept;
     void fixInsert(Node* node) noexcept;
-    void fixDelete(Node* node) noexcept;
+    void fixDelete(Node* node, Node* parent) noexcept;
+
+    static Node* clone(const Node*, Node*);
+    static void destroy(Node*) noexcept;
+    static size_t blackHeight(const Node*) noexcept;
+    static Part child(Node*, size_t) noexcept;
+    static void blacken(Part&) noexcept;
+    static size_t sizeOf(const Node*) noexcept;
+    static void resize(Node*) noexcept;
+    static void resizeUp(Node*) noexcept;
+    static Part joinNodes(Part, Node*, Part) noexcept;
+    static Part joinNodes(Part, Part) noexcept;
+    void splitNodes(Part, const Key&, Part&, Node*&, Part&) const noexcept;
+    static void splitLast(Part, Part&, Node*&) noexcept;
+    Part uniteNodes(Part, Part) const noexcept;
+    Part intersectNodes(Part, const Node*) const noexcept;
+    Part subtractNodes(Part, const Node*) const noexcept;
     Node* root_;
     Cmp cmp_;
     size_t size_;
@@ -129,13 +161,10 @@ namespace kiselev
 
   template< typename Key, typename Value, typename Cmp >
   RBTree< Key, Value, Cmp >::RBTree(const RBTree< Key, Value, Cmp >& tree):
-    RBTree()
-  {
-    for (ConstIterator it = tree.cbegin(); it != tree.cend(); ++it)
-    {
-      insert(*it);
-    }
-  }
+    root_(clone(tree.root_, nullptr)),
+    cmp_(tree.cmp_),
+    size_(tree.size_)
+  {}
 
   template< typename Key, typename Value, typename Cmp >
   RBTree< Key, Value, Cmp >::RBTree(RBTree< Key, Value, Cmp >&& tree) noexcept:
@@ -191,203 +220,221 @@ namespace kiselev
   template< typename Key, typename Value, typename Cmp >
   void RBTree< Key, Value, Cmp >::clear() noexcept
   {
-    erase(begin(), end());
+    destroy(root_);
+    root_ = nullptr;
+    size_ = 0;
   }
 
   template< typename Key, typename Value, typename Cmp >
-  void RBTree< Key, Value, Cmp >::rotateLeft(Node* node) noexcept
+  void RBTree< Key, Value, Cmp >::rotateLeft(Node*& root, Node* node) noexcept
   {
     Node* child = node->right;
     node->right = child->left;
     if (child->left)
     {
-      child->left->parent = node;
+      child->left->setParent(node);
     }
-    child->parent = node->parent;
-    if (!node->parent)
+    child->setParent(node->parent());
+    if (!node->parent())
     {
-      root_ = child;
+      root = child;
     }
-    else if (node == node->parent->left)
+    else if (node == node->parent()->left)
     {
-      node->parent->left = child;
+      node->parent()->left = child;
     }
     else
     {
-      node->parent->right = child;
+      node->parent()->right = child;
     }
     child->left = node;
-    node->parent = child;
+    node->setParent(child);
+    child->size = node->size;
+    resize(node);
   }
 
   template< typename Key, typename Value, typename Cmp >
-  void RBTree< Key, Value, Cmp >::rotateRight(Node* node) noexcept
+  void RBTree< Key, Value, Cmp >::rotateRight(Node*& root, Node* node) noexcept
   {
     Node* child = node->left;
     node->left = child->right;
     if (child->right)
     {
-      child->right->parent = node;
+      child->right->setParent(node);
     }
-    child->parent = node->parent;
-    if (!node->parent)
+    child->setParent(node->parent());
+    if (!node->parent())
     {
-      root_ = child;
+      root = child;
     }
-    else if (node == node->parent->right)
+    else if (node == node->parent()->right)
     {
-      node->parent->right = child;
+      node->parent()->right = child;
     }
     else
     {
-      node->parent->left = child;
+      node->parent()->left = child;
     }
     child->right = node;
-    node->parent = child;
+    node->setParent(child);
+    child->size = node->size;
+    resize(node);
   }
 
   template< typename Key, typename Value, typename Cmp >
   void RBTree< Key, Value, Cmp >::fixInsert(Node* node) noexcept
+  {
+    fixRed(root_, node);
+    root_->setColor(Color::BLACK);
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  void RBTree< Key, Value, Cmp >::fixRed(Node*& root, Node* node) noexcept
   {
     Node* parent = nullptr;
     Node* grandParent = nullptr;
-    while (node && node->color == Color::RED && node->parent && node->parent->color == Color::RED)
+    while (node && node->color() == Color::RED && node->parent() && node->parent()->color() == Color::RED)
     {
-      parent = node->parent;
-      grandParent = parent->parent;
+      parent = node->parent();
+      grandParent = parent->parent();
       if (parent == grandParent->left)
       {
         Node* uncle = grandParent->right;
-        if (uncle && uncle->color == Color::RED)
+        if (uncle && uncle->color() == Color::RED)
         {
-          grandParent->color = Color::RED;
-          parent->color = Color::BLACK;
-          uncle->color = Color::BLACK;
+          grandParent->setColor(Color::RED);
+          parent->setColor(Color::BLACK);
+          uncle->setColor(Color::BLACK);
           node = grandParent;
         }
         else
         {
           if (node == parent->right)
           {
-            rotateLeft(parent);
+            rotateLeft(root, parent);
             node = parent;
-            parent = node->parent;
+            parent = node->parent();
           }
-          rotateRight(grandParent);
-          std::swap(parent->color, grandParent->color);
+          rotateRight(root, grandParent);
+          Color color = parent->color();
+          parent->setColor(grandParent->color());
+          grandParent->setColor(color);
           node = parent;
         }
       }
       else
       {
         Node* uncle = grandParent->left;
-        if (uncle && uncle->color == Color::RED)
+        if (uncle && uncle->color() == Color::RED)
         {
-          grandParent->color = Color::RED;
-          parent->color = Color::BLACK;
-          uncle->color = Color::BLACK;
+          grandParent->setColor(Color::RED);
+          parent->setColor(Color::BLACK);
+          uncle->setColor(Color::BLACK);
           node = grandParent;
         }
         else
         {
           if (node == parent->left)
           {
-            rotateRight(parent);
+            rotateRight(root, parent);
             node = parent;
-            parent = node->parent;
+            parent = node->parent();
           }
-          rotateLeft(grandParent);
-          std::swap(parent->color, grandParent->color);
+          rotateLeft(root, grandParent);
+          Color color = parent->color();
+          parent->setColor(grandParent->color());
+          grandParent->setColor(color);
           node = parent;
         }
       }
     }
-    root_->color = Color::BLACK;
   }
 
   template< typename Key, typename Value, typename Cmp >
-  void RBTree< Key, Value, Cmp >::fixDelete(Node* node) noexcept
+  void RBTree< Key, Value, Cmp >::fixDelete(Node* node, Node* parent) noexcept
   {
-    while (node != root_ && node->color == Color::BLACK)
+    while (node != root_ && (!node || node->color() == Color::BLACK))
     {
-      if (node == node->parent->left)
+      if (node == parent->left)
       {
-        Node* brother = node->parent->right;
-        if (brother && brother->color == Color::RED)
+        Node* brother = parent->right;
+        if (brother && brother->color() == Color::RED)
         {
-          brother->color = Color::BLACK;
-          node->parent->color = Color::RED;
-          rotateLeft(node->parent);
-          brother = node->parent->right;
+          brother->setColor(Color::BLACK);
+          parent->setColor(Color::RED);
+          rotateLeft(root_, parent);
+          brother = parent->right;
         }
-        if ((!brother->left || brother->left->color == Color::BLACK) && (!brother->right || brother->right->color == Color::BLACK))
+        if ((!brother->left || brother->left->color() == Color::BLACK) && (!brother->right || brother->right->color() == Color::BLACK))
         {
-          brother->color = Color::RED;
-          node = node->parent;
+          brother->setColor(Color::RED);
+          node = parent;
+          parent = node->parent();
         }
         else
         {
-          if (!brother->right || brother->right->color == Color::BLACK)
+          if (!brother->right || brother->right->color() == Color::BLACK)
           {
             if (brother->left)
             {
-              brother->left->color = Color::BLACK;
+              brother->left->setColor(Color::BLACK);
             }
-            brother->color = Color::RED;
-            rotateRight(brother);
-            brother = node->parent->right;
+            brother->setColor(Color::RED);
+            rotateRight(root_, brother);
+            brother = parent->right;
           }
-          brother->color = node->parent->color;
-          node->parent->color = Color::BLACK;
+          brother->setColor(parent->color());
+          parent->setColor(Color::BLACK);
           if (brother->right)
           {
-            brother->right->color = Color::BLACK;
+            brother->right->setColor(Color::BLACK);
           }
-          rotateLeft(node->parent);
+          rotateLeft(root_, parent);
           node = root_;
         }
       }
       else
       {
-        Node* brother = node->parent->left;
-        if (brother && brother->color == Color::RED)
+        Node* brother = parent->left;
+        if (brother && brother->color() == Color::RED)
         {
-          brother->color = Color::BLACK;
-          node->parent->color = Color::RED;
-          rotateRight(node->parent);
-          brother = node->parent->left;
+          brother->setColor(Color::BLACK);
+          parent->setColor(Color::RED);
+          rotateRight(root_, parent);
+          brother = parent->left;
         }
-        if ((!brother->left || brother->left->color == Color::BLACK) && (!brother->right || brother->right->color == Color::BLACK))
+        if ((!brother->left || brother->left->color() == Color::BLACK) && (!brother->right || brother->right->color() == Color::BLACK))
         {
-          brother->color = Color::RED;
-          node = node->parent;
+          brother->setColor(Color::RED);
+          node = parent;
+          parent = node->parent();
         }
         else
         {
-          if (!brother->left || brother->left->color == Color::BLACK)
+          if (!brother->left || brother->left->color() == Color::BLACK)
           {
             if (brother->right)
             {
-              brother->right->color = Color::BLACK;
+              brother->right->setColor(Color::BLACK);
             }
-            brother->color = Color::RED;
-            rotateLeft(brother);
-            brother = node->parent->left;
+            brother->setColor(Color::RED);
+            rotateLeft(root_, brother);
+            brother = parent->left;
           }
-          brother->color = node->parent->color;
-          node->parent->color = Color::BLACK;
+          brother->setColor(parent->color());
+          parent->setColor(Color::BLACK);
           if (brother->left)
           {
-            brother->left->color = Color::BLACK;
+            brother->left->setColor(Color::BLACK);
           }
-          rotateRight(node->parent);
+          rotateRight(root_, parent);
           node = root_;
         }
       }
     }
     if (node)
     {
-      node->color = Color::BLACK;
+      node->setColor(Color::BLACK);
     }
   }
 
@@ -400,7 +447,7 @@ namespace kiselev
   template< typename Key, typename Value, typename Cmp >
   bool RBTree< Key, Value, Cmp >::empty() const noexcept
   {
-    return size_ == 0;
+    return !root_;
   }
 
   template< typename Key, typename Value, typename Cmp >
@@ -663,7 +710,7 @@ namespace kiselev
   template< typename... Args >
   std::pair< typename RBTree< Key, Value, Cmp >::Iterator, bool > RBTree< Key, Value, Cmp >::emplace(Args &&... args)
   {
-    Node* newNode = new Node{ Color::BLACK, nullptr, nullptr, nullptr, { std::forward< Args >(args)... } };
+    Node* newNode = new Node{ Color::BLACK, nullptr, nullptr, nullptr, std::forward< Args >(args)... };
     try
     {
       if (!root_)
@@ -692,8 +739,8 @@ namespace kiselev
         }
       }
 
-      newNode->parent = parent;
-      newNode->color = Color::RED;
+      newNode->setParent(parent);
+      newNode->setColor(Color::RED);
       if (cmp_(parent->data.first, newNode->data.first))
       {
         parent->right = newNode;
@@ -708,8 +755,9 @@ namespace kiselev
       delete newNode;
       throw;
     }
+    resizeUp(newNode->parent());
     fixInsert(newNode);
-    size_++;
+    ++size_;
     return { Iterator(newNode, false), true };
   }
 
@@ -722,7 +770,7 @@ namespace kiselev
       return emplace(std::forward< Args >(args)...).first;
     }
     Node* pos = hint.node_;
-    Node* newNode = new Node{ Color::RED, nullptr, nullptr, pos, { std::forward< Args >(args)... } };
+    Node* newNode = new Node{ Color::RED, nullptr, nullptr, pos, std::forward< Args >(args)... };
     value val = newNode->data;
     try
     {
@@ -731,6 +779,7 @@ namespace kiselev
         if (!pos->left)
         {
           pos->left = newNode;
+          resizeUp(pos);
           fixInsert(newNode);
           ++size_;
           return Iterator(newNode, false);
@@ -741,6 +790,7 @@ namespace kiselev
         if (!pos->right)
         {
           pos->right = newNode;
+          resizeUp(pos);
           fixInsert(newNode);
           ++size_;
           return Iterator(newNode, false);
@@ -820,9 +870,10 @@ namespace kiselev
     Node* toDelete = pos.node_;
     Node* replace = nullptr;
     Node* child = nullptr;
-    if (size_ == 1)
+    if (toDelete == root_ && !toDelete->left && !toDelete->right)
     {
       delete root_;
+      root_ = nullptr;
       size_ = 0;
       return end();
     }
@@ -841,27 +892,28 @@ namespace kiselev
     child = replace->left ? replace->left : replace->right;
     if (child)
     {
-      child->parent = replace->parent;
+      child->setParent(replace->parent());
     }
-    if (!replace->parent)
+    if (!replace->parent())
     {
       root_ = child;
     }
-    else if (replace == replace->parent->left)
+    else if (replace == replace->parent()->left)
     {
-      replace->parent->left = child;
+      replace->parent()->left = child;
     }
     else
     {
-      replace->parent->right = child;
+      replace->parent()->right = child;
     }
     if (replace != toDelete)
     {
       toDelete->data = std::move(replace->data);
     }
-    if (replace->color == Color::BLACK)
+    resizeUp(replace->parent());
+    if (replace->color() == Color::BLACK)
     {
-      fixDelete(child ? child : replace->parent);
+      fixDelete(child, replace->parent());
     }
     Iterator next(pos.node_, pos.isEnd_);
     ++next;
@@ -892,11 +944,11 @@ namespace kiselev
   template< typename Key, typename Value, typename Cmp >
   typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::erase(ConstIterator first, ConstIterator last) noexcept
   {
-    while (first != last)
+    while (first != last && !empty())
     {
       first = erase(first);
     }
-    return Iterator(last.node_, last.isEnd_);
+    return empty() ? end() : Iterator(last.node_, last.isEnd_);
   }
 
   template< typename Key, typename Value, typename Cmp >
@@ -978,6 +1030,17 @@ namespace kiselev
     return { ConstIterator(lowerBound(key)), ConstIterator(upperBound(key)) };
   }
 
+  template< typename Key, typename Value, typename Cmp >
+  TreeNode< Key, Value >* RBTree< Key, Value, Cmp >::getMax() const noexcept
+  {
+    Node* temp = root_;
+    while (temp && temp->right)
+    {
+      temp = temp->right;
+    }
+    return temp;
+  }
+
   template< typename Key, typename Value, typename Cmp >
   const Value& RBTree< Key, Value, Cmp >::operator[](const Key& key) const
   {
@@ -1008,5 +1071,400 @@ namespace kiselev
   {
     return const_cast< Value& >(static_cast< const RBTree< Key, Value, Cmp >& >(*this).at(key));
   }
+
+  template< typename Key, typename Value, typename Cmp >
+  void RBTree< Key, Value, Cmp >::split(const Key& key, RBTree< Key, Value, Cmp >& less,
+    RBTree< Key, Value, Cmp >& greater) noexcept
+  {
+    Part whole{ root_, blackHeight(root_) };
+    root_ = nullptr;
+    size_ = 0;
+    less.clear();
+    greater.clear();
+    Part left{ nullptr, 0 };
+    Part right{ nullptr, 0 };
+    Node* found = nullptr;
+    splitNodes(whole, key, left, found, right);
+    if (found)
+    {
+      right = joinNodes(Part{ nullptr, 0 }, found, right);
+    }
+    less.root_ = left.root;
+    greater.root_ = right.root;
+    less.size_ = sizeOf(left.root);
+    greater.size_ = sizeOf(right.root);
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  void RBTree< Key, Value, Cmp >::join(RBTree< Key, Value, Cmp >& less, const value& pivot,
+    RBTree< Key, Value, Cmp >& greater)
+  {
+    Node* node = new Node{ Color::RED, nullptr, nullptr, nullptr, pivot };
+    Part left{ std::exchange(less.root_, nullptr), 0 };
+    Part right{ std::exchange(greater.root_, nullptr), 0 };
+    less.size_ = 0;
+    greater.size_ = 0;
+    left.height = blackHeight(left.root);
+    right.height = blackHeight(right.root);
+    clear();
+    root_ = joinNodes(left, node, right).root;
+    size_ = sizeOf(root_);
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  void RBTree< Key, Value, Cmp >::unite(const RBTree< Key, Value, Cmp >& tree)
+  {
+    if (this != std::addressof(tree))
+    {
+      unite(RBTree< Key, Value, Cmp >(tree));
+    }
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  void RBTree< Key, Value, Cmp >::unite(RBTree< Key, Value, Cmp >&& tree) noexcept
+  {
+    if (this == std::addressof(tree))
+    {
+      return;
+    }
+    Part left{ root_, blackHeight(root_) };
+    Part right{ tree.root_, blackHeight(tree.root_) };
+    tree.root_ = nullptr;
+    tree.size_ = 0;
+    root_ = uniteNodes(left, right).root;
+    size_ = sizeOf(root_);
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  void RBTree< Key, Value, Cmp >::intersect(const RBTree< Key, Value, Cmp >& tree) noexcept
+  {
+    if (this == std::addressof(tree))
+    {
+      return;
+    }
+    root_ = intersectNodes(Part{ root_, blackHeight(root_) }, tree.root_).root;
+    size_ = sizeOf(root_);
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  void RBTree< Key, Value, Cmp >::subtract(const RBTree< Key, Value, Cmp >& tree) noexcept
+  {
+    if (this == std::addressof(tree))
+    {
+      clear();
+      return;
+    }
+    root_ = subtractNodes(Part{ root_, blackHeight(root_) }, tree.root_).root;
+    size_ = sizeOf(root_);
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  typename RBTree< Key, Value, Cmp >::Node* RBTree< Key, Value, Cmp >::clone(const Node* node, Node* parent)
+  {
+    if (!node)
+    {
+      return nullptr;
+    }
+    Node* copy = new Node{ node->color(), nullptr, nullptr, parent, node->data };
+    copy->size = node->size;
+    try
+    {
+      copy->left = clone(node->left, copy);
+      copy->right = clone(node->right, copy);
+    }
+    catch (...)
+    {
+      destroy(copy);
+      throw;
+    }
+    return copy;
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  void RBTree< Key, Value, Cmp >::destroy(Node* node) noexcept
+  {
+    while (node)
+    {
+      destroy(node->right);
+      Node* left = node->left;
+      delete node;
+      node = left;
+    }
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  size_t RBTree< Key, Value, Cmp >::blackHeight(const Node* node) noexcept
+  {
+    size_t height = 0;
+    for (; node; node = node->left)
+    {
+      height += node->color() == Color::BLACK;
+    }
+    return height;
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  typename RBTree< Key, Value, Cmp >::Part RBTree< Key, Value, Cmp >::child(Node* node, size_t height) noexcept
+  {
+    if (node)
+    {
+      node->setParent(nullptr);
+    }
+    return Part{ node, height };
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  void RBTree< Key, Value, Cmp >::blacken(Part& part) noexcept
+  {
+    if (part.root && part.root->color() == Color::RED)
+    {
+      part.root->setColor(Color::BLACK);
+      ++part.height;
+    }
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  size_t RBTree< Key, Value, Cmp >::sizeOf(const Node* node) noexcept
+  {
+    return node ? node->size : 0;
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  void RBTree< Key, Value, Cmp >::resize(Node* node) noexcept
+  {
+    node->size = 1 + sizeOf(node->left) + sizeOf(node->right);
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  void RBTree< Key, Value, Cmp >::resizeUp(Node* node) noexcept
+  {
+    for (; node; node = node->parent())
+    {
+      resize(node);
+    }
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  typename RBTree< Key, Value, Cmp >::Part RBTree< Key, Value, Cmp >::joinNodes(Part left, Node* pivot,
+    Part right) noexcept
+  {
+    blacken(left);
+    blacken(right);
+    pivot->setParent(nullptr);
+    if (left.height == right.height)
+    {
+      pivot->setColor(Color::BLACK);
+      pivot->left = left.root;
+      pivot->right = right.root;
+      if (left.root)
+      {
+        left.root->setParent(pivot);
+      }
+      if (right.root)
+      {
+        right.root->setParent(pivot);
+      }
+      resize(pivot);
+      return Part{ pivot, left.height + 1 };
+    }
+    Node* root = nullptr;
+    pivot->setColor(Color::RED);
+    if (left.height > right.height)
+    {
+      Node* parent = nullptr;
+      Node* node = left.root;
+      size_t height = left.height;
+      while (height > right.height || (node && node->color() == Color::RED))
+      {
+        height -= node->color() == Color::BLACK;
+        parent = node;
+        node = node->right;
+      }
+      pivot->left = node;
+      pivot->right = right.root;
+      parent->right = pivot;
+      pivot->setParent(parent);
+      root = left.root;
+    }
+    else
+    {
+      Node* parent = nullptr;
+      Node* node = right.root;
+      size_t height = right.height;
+      while (height > left.height || (node && node->color() == Color::RED))
+      {
+        height -= node->color() == Color::BLACK;
+        parent = node;
+        node = node->left;
+      }
+      pivot->left = left.root;
+      pivot->right = node;
+      parent->left = pivot;
+      pivot->setParent(parent);
+      root = right.root;
+    }
+    if (pivot->left)
+    {
+      pivot->left->setParent(pivot);
+    }
+    if (pivot->right)
+    {
+      pivot->right->setParent(pivot);
+    }
+    resizeUp(pivot);
+    fixRed(root, pivot);
+    Part result{ root, std::max(left.height, right.height) };
+    blacken(result);
+    return result;
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  typename RBTree< Key, Value, Cmp >::Part RBTree< Key, Value, Cmp >::joinNodes(Part left, Part right) noexcept
+  {
+    if (!left.root)
+    {
+      return right;
+    }
+    if (!right.root)
+    {
+      return left;
+    }
+    Part rest{ nullptr, 0 };
+    Node* last = nullptr;
+    splitLast(left, rest, last);
+    return joinNodes(rest, last, right);
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  void RBTree< Key, Value, Cmp >::splitNodes(Part part, const Key& key, Part& less, Node*& found,
+    Part& greater) const noexcept
+  {
+    if (!part.root)
+    {
+      less = part;
+      found = nullptr;
+      greater = part;
+      return;
+    }
+    Node* node = part.root;
+    size_t height = part.height - (node->color() == Color::BLACK);
+    Part left = child(node->left, height);
+    Part right = child(node->right, height);
+    if (cmp_(key, node->data.first))
+    {
+      Part middle{ nullptr, 0 };
+      splitNodes(left, key, less, found, middle);
+      greater = joinNodes(middle, node, right);
+    }
+    else if (cmp_(node->data.first, key))
+    {
+      Part middle{ nullptr, 0 };
+      splitNodes(right, key, middle, found, greater);
+      less = joinNodes(left, node, middle);
+    }
+    else
+    {
+      less = left;
+      greater = right;
+      node->left = nullptr;
+      node->right = nullptr;
+      found = node;
+    }
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  void RBTree< Key, Value, Cmp >::splitLast(Part part, Part& rest, Node*& last) noexcept
+  {
+    Node* node = part.root;
+    size_t height = part.height - (node->color() == Color::BLACK);
+    Part left = child(node->left, height);
+    Part right = child(node->right, height);
+    if (!right.root)
+    {
+      node->left = nullptr;
+      rest = left;
+      last = node;
+      return;
+    }
+    Part middle{ nullptr, 0 };
+    splitLast(right, middle, last);
+    rest = joinNodes(left, node, middle);
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  typename RBTree< Key, Value, Cmp >::Part RBTree< Key, Value, Cmp >::uniteNodes(Part part, Part other) const noexcept
+  {
+    if (!part.root)
+    {
+      return other;
+    }
+    if (!other.root)
+    {
+      return part;
+    }
+    Node* pivot = other.root;
+    size_t height = other.height - (pivot->color() == Color::BLACK);
+    Part otherLeft = child(pivot->left, height);
+    Part otherRight = child(pivot->right, height);
+    Part less{ nullptr, 0 };
+    Part greater{ nullptr, 0 };
+    Node* found = nullptr;
+    splitNodes(part, pivot->data.first, less, found, greater);
+    Part left = uniteNodes(less, otherLeft);
+    Part right = uniteNodes(greater, otherRight);
+    if (found)
+    {
+      delete pivot;
+      pivot = found;
+    }
+    return joinNodes(left, pivot, right);
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  typename RBTree< Key, Value, Cmp >::Part RBTree< Key, Value, Cmp >::intersectNodes(Part part,
+    const Node* other) const noexcept
+  {
+    if (!part.root)
+    {
+      return part;
+    }
+    if (!other)
+    {
+      destroy(part.root);
+      return Part{ nullptr, 0 };
+    }
+    Part less{ nullptr, 0 };
+    Part greater{ nullptr, 0 };
+    Node* found = nullptr;
+    splitNodes(part, other->data.first, less, found, greater);
+    Part left = intersectNodes(less, other->left);
+    Part right = intersectNodes(greater, other->right);
+    if (found)
+    {
+      return joinNodes(left, found, right);
+    }
+    return joinNodes(left, right);
+  }
+
+  template< typename Key, typename Value, typename Cmp >
+  typename RBTree< Key, Value, Cmp >::Part RBTree< Key, Value, Cmp >::subtractNodes(Part part,
+    const Node* other) const noexcept
+  {
+    if (!part.root || !other)
+    {
+      return part;
+    }
+    Part less{ nullptr, 0 };
+    Part greater{ nullptr, 0 };
+    Node* found = nullptr;
+    splitNodes(part, other->data.first, less, found, greater);
+    Part left = subtractNodes(less, other->left);
+    Part right = subtractNodes(greater, other->right);
+    if (found)
+    {
+      delete found;
+    }
+    return joinNodes(left, right);
+  }
 }
 #endif
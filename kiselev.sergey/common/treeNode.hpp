@@ -1,5 +1,7 @@
 #ifndef TREENODE_HPP
 #define TREENODE_HPP
+#include <cstddef>
+#include <cstdint>
 #include <utility>
 
 namespace kiselev
@@ -12,11 +14,58 @@ namespace kiselev
   template< class Key, class Value >
   struct TreeNode
   {
-    Color color;
     TreeNode* left;
     TreeNode* right;
-    TreeNode* parent;
+    size_t size;
     std::pair< Key, Value > data;
+
+    template< class... Args >
+    TreeNode(Color, TreeNode* left, TreeNode* right, TreeNode* parent, Args&&...);
+
+    TreeNode* parent() const noexcept;
+    void setParent(TreeNode*) noexcept;
+    Color color() const noexcept;
+    void setColor(Color) noexcept;
+
+  private:
+    static constexpr std::uintptr_t colorBit = 1;
+    std::uintptr_t parentColor_;
   };
+
+  template< class Key, class Value >
+  template< class... Args >
+  TreeNode< Key, Value >::TreeNode(Color color, TreeNode* left, TreeNode* right, TreeNode* parent, Args&&... args):
+    left(left),
+    right(right),
+    size(1 + (left ? left->size : 0) + (right ? right->size : 0)),
+    data(std::forward< Args >(args)...),
+    parentColor_(reinterpret_cast< std::uintptr_t >(parent) | (color == Color::BLACK ? colorBit : 0))
+  {
+    static_assert(alignof(TreeNode) > colorBit, "Low pointer bit must be free to hold the color");
+  }
+
+  template< class Key, class Value >
+  TreeNode< Key, Value >* TreeNode< Key, Value >::parent() const noexcept
+  {
+    return reinterpret_cast< TreeNode* >(parentColor_ & ~colorBit);
+  }
+
+  template< class Key, class Value >
+  void TreeNode< Key, Value >::setParent(TreeNode* parent) noexcept
+  {
+    parentColor_ = reinterpret_cast< std::uintptr_t >(parent) | (parentColor_ & colorBit);
+  }
+
+  template< class Key, class Value >
+  Color TreeNode< Key, Value >::color() const noexcept
+  {
+    return (parentColor_ & colorBit) ? Color::BLACK : Color::RED;
+  }
+
+  template< class Key, class Value >
+  void TreeNode< Key, Value >::setColor(Color color) noexcept
+  {
+    parentColor_ = (parentColor_ & ~colorBit) | (color == Color::BLACK ? colorBit : 0);
+  }
 }
 #endif
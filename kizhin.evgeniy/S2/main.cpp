@@ -1,43 +1,42 @@
+#include <cstring>
 #include <fstream>
 #include <iostream>
-#include <sstream>
 #include <stdexcept>
-#include <forward-list.hpp>
-#include "io-utils.hpp"
-#include "postfix-expression.hpp"
+#include <thread>
+#include "parallel-evaluation.hpp"
 
 int main(int argc, char** argv)
 {
   using namespace kizhin;
   try {
-    if (argc > 2) {
-      std::cerr << "Usage: " << argv[0] << " [filename]\n";
+    const bool parallel = argc > 1 && std::strcmp(argv[1], "--parallel") == 0;
+    const int firstFile = parallel ? 2 : 1;
+    if (argc > firstFile + 1) {
+      std::cerr << "Usage: " << argv[0] << " [--parallel] [filename]\n";
       return 1;
     }
     std::ifstream fin;
-    if (argc == 2) {
-      std::string filePath = argv[1];
+    if (argc == firstFile + 1) {
+      std::string filePath = argv[firstFile];
       fin.open(filePath);
       if (!fin) {
         throw std::logic_error("Failed to open file: " + filePath);
       }
     }
     std::istream& in = fin.is_open() ? fin : std::cin;
-    std::string current;
-    ForwardList< PostfixExpression::number_type > results;
-    while (std::getline(in, current)) {
-      if (!current.empty()) {
-        std::stringstream stream(current);
-        results.pushFront(inputPostfixExpression(stream).evaluate());
-      }
+    EvaluationResults results;
+    if (parallel) {
+      evaluateParallel(in, results, std::thread::hardware_concurrency());
+    } else {
+      evaluateSequential(in, results);
     }
-    if (!results.empty()) {
-      std::cout << results.front();
-      results.popFront();
+    const EvaluationResults::const_iterator first = results.begin();
+    EvaluationResults::const_iterator current = results.end();
+    if (current != first) {
+      std::cout << *(--current);
     }
-    while (!results.empty()) {
-      std::cout << ' ' << results.front();
-      results.popFront();
+    while (current != first) {
+      std::cout << ' ' << *(--current);
     }
     std::cout << '\n';
   } catch (const std::exception& e) {
@@ -0,0 +1,251 @@
+#include "parallel-evaluation.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <queue.hpp>
+#include "io-utils.hpp"
+
+namespace kizhin {
+  struct Chunk
+  {
+    const char* begin = nullptr;
+    const char* end = nullptr;
+    EvaluationResults values;
+    std::exception_ptr error;
+    bool done = false;
+  };
+
+  struct Block
+  {
+    std::string data;
+    std::unique_ptr< Chunk[] > chunks;
+    std::size_t capacity = 0;
+    std::size_t size = 0;
+  };
+
+  class ChunkWorkers
+  {
+  public:
+    explicit ChunkWorkers(std::size_t);
+    ChunkWorkers(const ChunkWorkers&) = delete;
+    ~ChunkWorkers();
+    ChunkWorkers& operator=(const ChunkWorkers&) = delete;
+
+    void submit(Block&);
+    void wait(const Chunk&);
+
+  private:
+    std::mutex mutex_;
+    std::condition_variable queued_;
+    std::condition_variable finished_;
+    Queue< Chunk* > pending_;
+    bool stopped_ = false;
+    std::size_t started_ = 0;
+    std::unique_ptr< std::thread[] > threads_;
+
+    void run();
+    void stop() noexcept;
+  };
+
+  const char* readBlock(std::istream&, Block&, const char*, const char*, std::size_t);
+  void splitBlock(Block&, const char*, const char*) noexcept;
+  void collectBlock(ChunkWorkers&, Block&, EvaluationResults&);
+  void evaluateChunk(Chunk&) noexcept;
+  const char* nextLine(const char*, const char*) noexcept;
+  const char* lastLine(const char*, const char*) noexcept;
+}
+
+kizhin::PostfixExpression::number_type kizhin::evaluateLine(const char* begin,
+    const char* end)
+{
+  std::stringstream stream(std::string(begin, end));
+  return inputPostfixExpression(stream).evaluate();
+}
+
+void kizhin::evaluateSequential(std::istream& in, EvaluationResults& results)
+{
+  std::string current;
+  while (std::getline(in, current)) {
+    if (!current.empty()) {
+      const char* data = current.data();
+      results.pushBack(evaluateLine(data, data + current.size()));
+    }
+  }
+}
+
+void kizhin::evaluateParallel(std::istream& in, EvaluationResults& results,
+    const std::size_t jobs, const std::size_t blockSize)
+{
+  Block blocks[2];
+  for (Block& block: blocks) {
+    block.capacity = jobs != 0 ? jobs : 1;
+    block.chunks.reset(new Chunk[block.capacity]);
+  }
+  ChunkWorkers workers(blocks[0].capacity);
+  const char* tail = nullptr;
+  const char* tailEnd = nullptr;
+  std::size_t current = 0;
+  while (in) {
+    Block& block = blocks[current];
+    const char* lines = readBlock(in, block, tail, tailEnd, blockSize);
+    splitBlock(block, block.data.data(), lines);
+    workers.submit(block);
+    tail = lines;
+    tailEnd = block.data.data() + block.data.size();
+    current ^= 1;
+    collectBlock(workers, blocks[current], results);
+  }
+  collectBlock(workers, blocks[current ^ 1], results);
+}
+
+kizhin::ChunkWorkers::ChunkWorkers(const std::size_t count):
+  threads_(new std::thread[count])
+{
+  try {
+    for (; started_ != count; ++started_) {
+      threads_[started_] = std::thread(&ChunkWorkers::run, this);
+    }
+  } catch (...) {
+    stop();
+    throw;
+  }
+}
+
+kizhin::ChunkWorkers::~ChunkWorkers()
+{
+  stop();
+}
+
+void kizhin::ChunkWorkers::submit(Block& block)
+{
+  {
+    std::lock_guard< std::mutex > lock(mutex_);
+    for (std::size_t i = 0; i != block.size; ++i) {
+      pending_.push(std::addressof(block.chunks[i]));
+    }
+  }
+  queued_.notify_all();
+}
+
+void kizhin::ChunkWorkers::wait(const Chunk& chunk)
+{
+  std::unique_lock< std::mutex > lock(mutex_);
+  finished_.wait(lock, [&chunk]() -> bool
+  {
+    return chunk.done;
+  });
+}
+
+void kizhin::ChunkWorkers::run()
+{
+  std::unique_lock< std::mutex > lock(mutex_);
+  while (true) {
+    queued_.wait(lock, [this]() -> bool
+    {
+      return stopped_ || !pending_.empty();
+    });
+    if (stopped_) {
+      return;
+    }
+    Chunk* chunk = pending_.front();
+    pending_.pop();
+    lock.unlock();
+    evaluateChunk(*chunk);
+    lock.lock();
+    chunk->done = true;
+    finished_.notify_all();
+  }
+}
+
+void kizhin::ChunkWorkers::stop() noexcept
+{
+  {
+    std::lock_guard< std::mutex > lock(mutex_);
+    stopped_ = true;
+  }
+  queued_.notify_all();
+  for (std::size_t i = 0; i != started_; ++i) {
+    threads_[i].join();
+  }
+}
+
+const char* kizhin::readBlock(std::istream& in, Block& block, const char* tail,
+    const char* tailEnd, const std::size_t blockSize)
+{
+  const std::size_t carried = tailEnd - tail;
+  block.data.resize(carried + blockSize);
+  std::copy(tail, tailEnd, std::addressof(block.data[0]));
+  in.read(std::addressof(block.data[carried]), blockSize);
+  block.data.resize(carried + static_cast< std::size_t >(in.gcount()));
+  const char* begin = block.data.data();
+  const char* end = begin + block.data.size();
+  return in ? lastLine(begin, end) : end;
+}
+
+void kizhin::splitBlock(Block& block, const char* begin, const char* end) noexcept
+{
+  block.size = 0;
+  const std::size_t step = (end - begin) / block.capacity + 1;
+  while (begin != end && block.size != block.capacity) {
+    const std::size_t left = end - begin;
+    Chunk& chunk = block.chunks[block.size++];
+    chunk.begin = begin;
+    chunk.end = nextLine(begin + std::min(step, left) - 1, end);
+    chunk.values.clear();
+    chunk.error = nullptr;
+    chunk.done = false;
+    begin = chunk.end;
+  }
+}
+
+void kizhin::collectBlock(ChunkWorkers& workers, Block& block, EvaluationResults& results)
+{
+  for (std::size_t i = 0; i != block.size; ++i) {
+    Chunk& chunk = block.chunks[i];
+    workers.wait(chunk);
+    for (const PostfixExpression::number_type value: chunk.values) {
+      results.pushBack(value);
+    }
+    if (chunk.error) {
+      std::rethrow_exception(chunk.error);
+    }
+  }
+  block.size = 0;
+}
+
+void kizhin::evaluateChunk(Chunk& chunk) noexcept
+{
+  try {
+    for (const char* begin = chunk.begin; begin != chunk.end;) {
+      const char* lineEnd = nextLine(begin, chunk.end);
+      const char* contentEnd = *(lineEnd - 1) == '\n' ? lineEnd - 1 : lineEnd;
+      if (begin != contentEnd) {
+        chunk.values.pushBack(evaluateLine(begin, contentEnd));
+      }
+      begin = lineEnd;
+    }
+  } catch (...) {
+    chunk.error = std::current_exception();
+  }
+}
+
+const char* kizhin::nextLine(const char* begin, const char* end) noexcept
+{
+  const void* found = std::memchr(begin, '\n', end - begin);
+  return found ? static_cast< const char* >(found) + 1 : end;
+}
+
+const char* kizhin::lastLine(const char* begin, const char* end) noexcept
+{
+  while (end != begin && *(end - 1) != '\n') {
+    --end;
+  }
+  return end;
+}
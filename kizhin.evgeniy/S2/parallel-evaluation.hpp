@@ -0,0 +1,17 @@
+#ifndef SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_S2_PARALLEL_EVALUATION_HPP
+#define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_S2_PARALLEL_EVALUATION_HPP
+
+#include <iosfwd>
+#include <buffer.hpp>
+#include "postfix-expression.hpp"
+
+namespace kizhin {
+  using EvaluationResults = Buffer< PostfixExpression::number_type >;
+
+  PostfixExpression::number_type evaluateLine(const char*, const char*);
+  void evaluateSequential(std::istream&, EvaluationResults&);
+  void evaluateParallel(std::istream&, EvaluationResults&, std::size_t jobs,
+      std::size_t blockSize = 1 << 22);
+}
+
+#endif
@@ -0,0 +1,80 @@
+#include <sstream>
+#include <stdexcept>
+#include <boost/test/unit_test.hpp>
+#include "parallel-evaluation.hpp"
+
+using kizhin::EvaluationResults;
+
+namespace {
+  std::string generateExpressions(const std::size_t count)
+  {
+    std::string expressions;
+    for (std::size_t i = 0; i != count; ++i) {
+      const std::string n = std::to_string(i);
+      expressions += "( " + n + " + 3 ) * 2 - " + n + " % 7\n";
+      if (i % 5 == 0) {
+        expressions += '\n';
+      }
+    }
+    return expressions;
+  }
+
+  EvaluationResults evaluateSequential(const std::string& input)
+  {
+    std::istringstream in(input);
+    EvaluationResults results;
+    kizhin::evaluateSequential(in, results);
+    return results;
+  }
+
+  EvaluationResults evaluateParallel(const std::string& input, std::size_t jobs,
+      std::size_t blockSize)
+  {
+    std::istringstream in(input);
+    EvaluationResults results;
+    kizhin::evaluateParallel(in, results, jobs, blockSize);
+    return results;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(parallel_evaluation);
+
+BOOST_AUTO_TEST_CASE(empty_input)
+{
+  BOOST_TEST(evaluateParallel("", 4, 16).empty());
+  BOOST_TEST(evaluateParallel("\n\n\n", 4, 16).empty());
+}
+
+BOOST_AUTO_TEST_CASE(matches_sequential_order)
+{
+  const std::string input = generateExpressions(1000);
+  const EvaluationResults expected = evaluateSequential(input);
+  BOOST_TEST(expected.size() == 1000);
+  BOOST_TEST(evaluateParallel(input, 1, 1 << 16) == expected);
+  BOOST_TEST(evaluateParallel(input, 4, 1 << 16) == expected);
+  BOOST_TEST(evaluateParallel(input, 3, 7) == expected);
+  BOOST_TEST(evaluateParallel(input, 8, 100) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(last_line_without_newline)
+{
+  const EvaluationResults expected{ 3, 6 };
+  BOOST_TEST(evaluateParallel("1 + 2\n2 * 3", 2, 4) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(first_error_wins)
+{
+  std::string input = generateExpressions(200);
+  input += "1 / 0\n";
+  input += generateExpressions(200);
+  input += "9223372036854775807 + 1\n";
+  for (std::size_t jobs = 1; jobs != 6; ++jobs) {
+    BOOST_CHECK_EXCEPTION(evaluateParallel(input, jobs, 64), std::logic_error,
+        [](const std::logic_error& e)
+        {
+          return std::string(e.what()) == "Division by zero";
+        });
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -1,5 +1,6 @@
 #include "io-utils.hpp"
 #include <iostream>
+#include <iterator>
 
 namespace kizhin {
   std::istream& operator>>(std::istream&, Dataset&);
@@ -14,17 +15,18 @@ std::istream& kizhin::operator>>(std::istream& in, DSContainer& dest)
     return in;
   }
   DSContainer input;
+  DSContainer::const_iterator hint = input.end();
   while (in) {
     DSContainer::key_type key;
     DSContainer::mapped_type val;
     in >> key >> val;
     if (!key.empty()) {
-      input.emplace(std::move(key), std::move(val));
+      hint = std::next(input.emplaceHint(hint, std::move(key), std::move(val)).first);
     }
   }
   if (!input.empty()) {
     in.clear();
-    dest = input;
+    dest = std::move(input);
   }
   return in;
 }
@@ -52,11 +54,12 @@ std::istream& kizhin::operator>>(std::istream& in, Dataset& dest)
   Dataset::key_type key{};
   Dataset::mapped_type val{};
   Dataset input;
+  Dataset::const_iterator hint = input.end();
   while (in >> key >> val) {
-    input.emplace(std::move(key), std::move(val));
+    hint = std::next(input.emplaceHint(hint, std::move(key), std::move(val)).first);
   }
   in.clear();
-  dest = input;
+  dest = std::move(input);
   return in;
 }
 
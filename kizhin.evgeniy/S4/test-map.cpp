@@ -241,6 +241,65 @@ BOOST_AUTO_TEST_CASE(insert_shuffled_hints)
   BOOST_TEST(std::equal(keys.begin(), keys.end(), map.begin(), map.end(), cmp));
 }
 
+BOOST_AUTO_TEST_CASE(insert_sorted_end_hints)
+{
+  MapT map;
+  for (MapT::key_type key = 0; key < 1'500; ++key) {
+    const auto res = map.insert(map.end(), std::make_pair(key, ""));
+    BOOST_TEST(res.second);
+    BOOST_TEST(res.first->first == key);
+    BOOST_TEST((std::next(res.first) == map.end()));
+  }
+  testMapInvariants(map);
+  BOOST_TEST(map.size() == 1'500);
+  BOOST_TEST(!map.insert(map.end(), std::make_pair(1'499, "")).second);
+  BOOST_TEST(!map.insert(map.end(), std::make_pair(0, "")).second);
+  BOOST_TEST(map.size() == 1'500);
+}
+
+BOOST_AUTO_TEST_CASE(insert_adjacent_hints)
+{
+  MapT map;
+  MapT::const_iterator hint = map.end();
+  for (MapT::key_type key = 1'500; key > 0; --key) {
+    const auto res = map.insert(hint, std::make_pair(key * 2, ""));
+    BOOST_TEST(res.second);
+    BOOST_TEST(res.first->first == key * 2);
+    hint = res.first;
+    testMapInvariants(map);
+  }
+  for (MapT::key_type key = 0; key < 1'500; ++key) {
+    const auto hint = std::next(map.find(key * 2 + 2));
+    const auto res = map.insert(hint, std::make_pair(key * 2 + 1, ""));
+    BOOST_TEST(res.second);
+    BOOST_TEST(res.first->first == key * 2 + 1);
+  }
+  testMapInvariants(map);
+  BOOST_TEST(map.size() == 3'000);
+  BOOST_TEST(map.begin()->first == 1);
+}
+
+BOOST_AUTO_TEST_CASE(insert_ascending_runs)
+{
+  std::vector< MapT::value_type > values;
+  for (MapT::key_type run = 0; run < 10; ++run) {
+    for (MapT::key_type key = 0; key < 300; ++key) {
+      values.emplace_back(key * 10 + run, "");
+    }
+  }
+  MapT map;
+  map.insert(values.begin(), values.end());
+  testMapInvariants(map);
+  BOOST_TEST(map.size() == 3'000);
+  map.insert(values.begin(), values.end());
+  BOOST_TEST(map.size() == 3'000);
+  for (MapT::key_type key = 0; key < 3'000; key += 2) {
+    BOOST_TEST(map.erase(key) == 1);
+  }
+  testMapInvariants(map);
+  BOOST_TEST(map.size() == 1'500);
+}
+
 BOOST_AUTO_TEST_CASE(insert_empty_range)
 {
   MapT map;
@@ -1,6 +1,5 @@
 #include <cstring>
 #include <fstream>
-#include <functional>
 #include <iostream>
 #include <string>
 #include "map-utils.hpp"
@@ -25,14 +24,12 @@ int main(int argc, char** argv)
       std::cout << "<EMPTY>\n";
       return 0;
     }
-    ValueCollector result;
-    MapT* mapPtr = std::addressof(map);
-    const Map< std::string, std::function< ValueCollector() > > commands{
-      { "ascending", std::bind(&MapT::traverseLmr< ValueCollector >, mapPtr, result) },
-      { "descending", std::bind(&MapT::traverseRml< ValueCollector >, mapPtr, result) },
-      { "breadth", std::bind(&MapT::traverseBreadth< ValueCollector >, mapPtr, result) },
+    const Map< std::string, TraversalOrder > orders{
+      { "ascending", TraversalOrder::lmr },
+      { "descending", TraversalOrder::rml },
+      { "breadth", TraversalOrder::breadth },
     };
-    result = commands.at(argv[1])();
+    const ValueCollector result = map.traverse(orders.at(argv[1]), ValueCollector{});
     std::cout << result.keys << ' ' << result.values << '\n';
   } catch (const std::exception& e) {
     std::cerr << "Error: " << e.what() << '\n';
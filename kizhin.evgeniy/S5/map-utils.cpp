@@ -1,5 +1,6 @@
 #include "map-utils.hpp"
 #include <istream>
+#include <iterator>
 #include <limits>
 
 std::istream& kizhin::operator>>(std::istream& in, MapT& dest)
@@ -11,11 +12,12 @@ std::istream& kizhin::operator>>(std::istream& in, MapT& dest)
   MapT::key_type key{};
   MapT::mapped_type val{};
   MapT input;
+  MapT::const_iterator hint = input.end();
   while (in >> key >> val) {
-    input.emplace(std::move(key), std::move(val));
+    hint = std::next(input.emplaceHint(hint, std::move(key), std::move(val)).first);
   }
   in.clear();
-  dest = input;
+  dest = std::move(input);
   return in;
   return in;
 }
@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <iterator>
 #include <numeric>
+#include <type_traits>
 #include <vector>
 #include <boost/test/unit_test.hpp>
 #include <map.hpp>
@@ -119,3 +120,64 @@ BOOST_AUTO_TEST_CASE(bfs_to_iterator)
 
 BOOST_AUTO_TEST_SUITE_END()
 
+static_assert(std::is_trivially_copyable< MapFixture::MapT::lmr_iterator >::value,
+    "LmrIterator must be trivially copyable");
+static_assert(std::is_trivially_copyable< MapFixture::MapT::const_rml_iterator >::value,
+    "RmlIterator must be trivially copyable");
+static_assert(std::is_trivially_copyable< MapFixture::MapT::const_bfs_iterator >::value,
+    "BfsIterator must be trivially copyable");
+
+BOOST_AUTO_TEST_SUITE(map_traversal_tests)
+
+BOOST_AUTO_TEST_CASE(empty_map_traversals)
+{
+  const kizhin::Map< int, int > map;
+  BOOST_TEST((map.lmrBegin() == map.lmrEnd()));
+  BOOST_TEST((map.rmlBegin() == map.rmlEnd()));
+  BOOST_TEST((map.bfsBegin() == map.bfsEnd()));
+}
+
+BOOST_AUTO_TEST_CASE(large_map_traversals)
+{
+  kizhin::Map< int, int > map;
+  for (int key = 0; key < 2'000; ++key) {
+    map.emplace((key * 7) % 2'000, key);
+  }
+  for (int key = 0; key < 2'000; key += 3) {
+    map.erase(key);
+  }
+  const auto expected = extract_keys(map.begin(), map.end());
+  BOOST_TEST(extract_keys(map.lmrBegin(), map.lmrEnd()) == expected);
+  auto descending = extract_keys(map.rmlBegin(), map.rmlEnd());
+  std::reverse(descending.begin(), descending.end());
+  BOOST_TEST(descending == expected);
+  auto breadth = extract_keys(map.bfsBegin(), map.bfsEnd());
+  BOOST_TEST(breadth.size() == map.size());
+  BOOST_TEST(breadth.front() == map.bfsBegin()->first);
+  std::sort(breadth.begin(), breadth.end());
+  BOOST_TEST(breadth == expected);
+}
+
+BOOST_AUTO_TEST_CASE(traverse_order)
+{
+  kizhin::Map< int, int > map;
+  for (int key = 0; key < 100; ++key) {
+    map.emplace(key, key);
+  }
+  using kizhin::TraversalOrder;
+  std::vector< int > keys;
+  const auto collect = [&keys](const auto& value)
+  {
+    keys.push_back(value.first);
+  };
+  map.traverse(TraversalOrder::lmr, collect);
+  BOOST_TEST(keys == extract_keys(map.lmrBegin(), map.lmrEnd()));
+  keys.clear();
+  map.traverse(TraversalOrder::rml, collect);
+  BOOST_TEST(keys == extract_keys(map.rmlBegin(), map.rmlEnd()));
+  keys.clear();
+  map.traverse(TraversalOrder::breadth, collect);
+  BOOST_TEST(keys == extract_keys(map.bfsBegin(), map.bfsEnd()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
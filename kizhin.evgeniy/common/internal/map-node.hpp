@@ -64,6 +64,8 @@ namespace kizhin {
     std::tuple< NodePtr, ValPtr > nextIter(NodePtr, ValPtr);
     template < typename NodePtr, typename ValPtr >
     std::tuple< NodePtr, ValPtr > prevIter(NodePtr, ValPtr);
+    template < typename NodePtr >
+    NodePtr nextInLevel(NodePtr) noexcept;
 
     template < typename NodePtr, typename... Args >
     void emplaceBack(NodePtr, Args&&...);
@@ -270,6 +272,27 @@ std::tuple< NodePtr, ValPtr > kizhin::detail::prevIter(NodePtr node, ValPtr valu
   return std::make_tuple(nullptr, nullptr);
 }
 
+template < typename NodePtr >
+NodePtr kizhin::detail::nextInLevel(NodePtr node) noexcept
+{
+  assert(node && "NextInLevel: nullptr node given");
+  std::size_t depth = 0;
+  while (node->parent && isRight(node)) {
+    node = node->parent;
+    ++depth;
+  }
+  if (node->parent) {
+    node = getRightSibling(node);
+  } else {
+    ++depth;
+  }
+  while (depth != 0 && node && !isEmpty(node)) {
+    node = node->children[0];
+    --depth;
+  }
+  return node && !isEmpty(node) ? node : nullptr;
+}
+
 template < typename NodePtr, typename... Args >
 void kizhin::detail::emplaceBack(NodePtr node, Args&&... args)
 {
@@ -2,15 +2,20 @@
 #define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_MAP_HPP
 
 #include <algorithm>
+#include <iterator>
 #include <memory>
 #include <tuple>
 #include <utility>
 #include "internal/map-node.hpp"
-#include "queue.hpp"
-#include "stack.hpp"
 #include "type-utils.hpp"
 
 namespace kizhin {
+  enum class TraversalOrder {
+    lmr,
+    rml,
+    breadth,
+  };
+
   template < typename Key, typename T, typename Comparator = std::less< Key > >
   class Map final
   {
@@ -30,7 +35,7 @@ namespace kizhin {
     class Iterator;
 
     template < bool isConst >
-    class HeavyIterator;
+    class TraversalIterator;
     template < bool isConst >
     class LmrIterator;
     template < bool isConst >
@@ -148,6 +153,8 @@ namespace kizhin {
     F traverseRml(F) const;
     template < typename F >
     F traverseBreadth(F) const;
+    template < typename F >
+    F traverse(TraversalOrder, F) const;
 
   private:
     using Node = detail::Node< value_type >;
@@ -175,6 +182,10 @@ namespace kizhin {
     Node* findTarget(Node*, const key_type&) const;
     Node* validateHint(Node*, const key_type&) const;
 
+    Node* getHintLeaf(const_iterator) const noexcept;
+    bool isLeafTarget(Node*, const key_type&) const;
+    std::pair< iterator, bool > emplaceToLeaf(Node*, value_type&&);
+
     Node* fixUnderflow(Node*);
     Node* fixRootUnderflow(Node*);
 
@@ -343,7 +354,7 @@ auto kizhin::Map< K, T, C >::Iterator< IsConst >::operator--(int) -> Iterator
 
 template < typename K, typename T, typename C >
 template < bool IsConst >
-class kizhin::Map< K, T, C >::HeavyIterator
+class kizhin::Map< K, T, C >::TraversalIterator
 {
 private:
   template < typename T1, typename T2 >
@@ -359,17 +370,19 @@ public:
   pointer operator->() const noexcept { return std::addressof(**this); }
   reference operator*() const noexcept
   {
-    assert(valuePtr_ && "Dereferencing empty HeavyIterator");
+    assert(valuePtr_ && "Dereferencing empty TraversalIterator");
     return *valuePtr_;
   }
   operator Map::Iterator< IsConst >() { return { node_, valuePtr_ }; }
 
-  friend bool operator==(const HeavyIterator& lhs, const HeavyIterator& rhs) noexcept
+  friend bool operator==(const TraversalIterator& lhs,
+      const TraversalIterator& rhs) noexcept
   {
     return lhs.node_ == rhs.node_ && lhs.valuePtr_ == rhs.valuePtr_;
   }
 
-  friend bool operator!=(const HeavyIterator& lhs, const HeavyIterator& rhs) noexcept
+  friend bool operator!=(const TraversalIterator& lhs,
+      const TraversalIterator& rhs) noexcept
   {
     return !(lhs == rhs);
   }
@@ -377,24 +390,35 @@ public:
 protected:
   Node* node_ = nullptr;
   pointer valuePtr_ = nullptr;
+
+  TraversalIterator() noexcept = default;
+  TraversalIterator(Node* node, pointer valuePtr) noexcept:
+    node_(node),
+    valuePtr_(valuePtr)
+  {}
+
+  void reset() noexcept
+  {
+    node_ = nullptr;
+    valuePtr_ = nullptr;
+  }
 };
 
 template < typename K, typename T, typename C >
 template < bool IsConst >
-class kizhin::Map< K, T, C >::LmrIterator: public HeavyIterator< IsConst >
+class kizhin::Map< K, T, C >::LmrIterator: public TraversalIterator< IsConst >
 {
 public:
-  using pointer = typename HeavyIterator< IsConst >::pointer;
-  using reference = typename HeavyIterator< IsConst >::reference;
+  using pointer = typename TraversalIterator< IsConst >::pointer;
+  using reference = typename TraversalIterator< IsConst >::reference;
 
   LmrIterator() noexcept = default;
   template < bool RhsConst, std::enable_if_t< IsConst && !RhsConst, int > = 0 >
-  LmrIterator(const LmrIterator< RhsConst >& rhs):
-    HeavyIterator< IsConst >(rhs),
-    values_(rhs.values_)
+  LmrIterator(const LmrIterator< RhsConst >& rhs) noexcept:
+    TraversalIterator< IsConst >(rhs.node_, rhs.valuePtr_)
   {}
   template < bool RhsConst, std::enable_if_t< !IsConst || RhsConst, int > = 0 >
-  LmrIterator(Iterator< RhsConst > rhs):
+  LmrIterator(Iterator< RhsConst > rhs) noexcept:
     LmrIterator(rhs.node_)
   {}
 
@@ -408,71 +432,55 @@ public:
 
 private:
   friend class Map;
+  friend class LmrIterator< !IsConst >;
 
-  Stack< std::pair< Node*, pointer > > values_{};
-  using HeavyIterator< IsConst >::valuePtr_;
-  using HeavyIterator< IsConst >::node_;
+  using TraversalIterator< IsConst >::valuePtr_;
+  using TraversalIterator< IsConst >::node_;
 
-  LmrIterator(Node*);
+  LmrIterator(Node*) noexcept;
 };
 
 template < typename K, typename T, typename C >
 template < bool IsConst >
-kizhin::Map< K, T, C >::LmrIterator< IsConst >::LmrIterator(Node* root):
-  HeavyIterator< IsConst >()
+kizhin::Map< K, T, C >::LmrIterator< IsConst >::LmrIterator(Node* root) noexcept:
+  TraversalIterator< IsConst >()
 {
   while (root && root->parent) {
     root = root->parent;
   }
-  while (root && !detail::isEmpty(root)) {
-    values_.emplace(root, root->begin);
-    root = root->children[0];
+  if (root) {
+    node_ = detail::treeMin(root);
+    valuePtr_ = node_->begin;
   }
-  ++(*this);
 }
 
 template < typename K, typename T, typename C >
 template < bool IsConst >
 auto kizhin::Map< K, T, C >::LmrIterator< IsConst >::operator++() -> LmrIterator&
 {
-  if (values_.empty()) {
-    valuePtr_ = nullptr;
-    node_ = nullptr;
-    return *this;
-  }
-  node_ = values_.top().first;
-  valuePtr_ = values_.top().second;
-  values_.pop();
-  Node* next = nullptr;
-  if (valuePtr_ == node_->begin && detail::isThree(node_)) {
-    values_.emplace(node_, valuePtr_ + 1);
-    next = node_->children[1];
-  } else {
-    next = node_->children[detail::size(node_)];
-  }
-  while (next && !detail::isEmpty(next)) {
-    values_.emplace(next, next->begin);
-    next = next->children[0];
+  assert(node_ && valuePtr_ && "Incrementing empty LmrIterator");
+  std::tie(node_, valuePtr_) = detail::nextIter(node_, valuePtr_);
+  if (node_ && detail::isEmpty(node_)) {
+    this->reset();
   }
   return *this;
 }
 
 template < typename K, typename T, typename C >
 template < bool IsConst >
-class kizhin::Map< K, T, C >::RmlIterator: public HeavyIterator< IsConst >
+class kizhin::Map< K, T, C >::RmlIterator: public TraversalIterator< IsConst >
 {
 public:
-  using pointer = typename HeavyIterator< IsConst >::pointer;
-  using reference = typename HeavyIterator< IsConst >::reference;
+  using pointer = typename TraversalIterator< IsConst >::pointer;
+  using reference = typename TraversalIterator< IsConst >::reference;
 
   RmlIterator() noexcept = default;
   template < bool RhsConst, std::enable_if_t< IsConst && !RhsConst, int > = 0 >
-  RmlIterator(const RmlIterator< RhsConst >& rhs):
-    HeavyIterator< IsConst >(rhs),
-    values_(rhs.values_)
+  RmlIterator(const RmlIterator< RhsConst >& rhs) noexcept:
+    TraversalIterator< IsConst >(rhs.node_, rhs.valuePtr_)
   {}
   template < bool RhsConst, std::enable_if_t< !IsConst || RhsConst, int > = 0 >
-  RmlIterator(Iterator< RhsConst > rhs):
+  RmlIterator(Iterator< RhsConst > rhs) noexcept:
     RmlIterator(rhs.node_)
   {}
 
@@ -486,71 +494,52 @@ public:
 
 private:
   friend class Map;
+  friend class RmlIterator< !IsConst >;
 
-  Stack< std::pair< Node*, pointer > > values_{};
-  using HeavyIterator< IsConst >::valuePtr_;
-  using HeavyIterator< IsConst >::node_;
+  using TraversalIterator< IsConst >::valuePtr_;
+  using TraversalIterator< IsConst >::node_;
 
-  RmlIterator(Node*);
+  RmlIterator(Node*) noexcept;
 };
 
 template < typename K, typename T, typename C >
 template < bool IsConst >
-kizhin::Map< K, T, C >::RmlIterator< IsConst >::RmlIterator(Node* root):
-  HeavyIterator< IsConst >()
+kizhin::Map< K, T, C >::RmlIterator< IsConst >::RmlIterator(Node* root) noexcept:
+  TraversalIterator< IsConst >()
 {
   while (root && root->parent) {
     root = root->parent;
   }
-  while (root && !detail::isEmpty(root)) {
-    values_.emplace(root, root->end - 1);
-    root = root->children[detail::size(root)];
+  if (root) {
+    node_ = detail::treeMax(root);
+    valuePtr_ = node_->end - 1;
   }
-  ++(*this);
 }
 
 template < typename K, typename T, typename C >
 template < bool IsConst >
 auto kizhin::Map< K, T, C >::RmlIterator< IsConst >::operator++() -> RmlIterator&
 {
-  if (values_.empty()) {
-    valuePtr_ = nullptr;
-    node_ = nullptr;
-    return *this;
-  }
-  node_ = values_.top().first;
-  valuePtr_ = values_.top().second;
-  values_.pop();
-  Node* next = nullptr;
-  if (valuePtr_ != node_->begin) {
-    values_.emplace(node_, valuePtr_ + 1);
-    next = node_->children[valuePtr_ == node_->begin + 1];
-  } else {
-    next = node_->children[0];
-  }
-  while (next && !detail::isEmpty(next)) {
-    values_.emplace(next, next->begin);
-    next = next->children[detail::size(next)];
-  }
+  assert(node_ && valuePtr_ && "Incrementing empty RmlIterator");
+  std::tie(node_, valuePtr_) = detail::prevIter(node_, valuePtr_);
   return *this;
 }
 
 template < typename K, typename T, typename C >
 template < bool IsConst >
-class kizhin::Map< K, T, C >::BfsIterator: public HeavyIterator< IsConst >
+class kizhin::Map< K, T, C >::BfsIterator: public TraversalIterator< IsConst >
 {
 public:
-  using pointer = typename HeavyIterator< IsConst >::pointer;
-  using reference = typename HeavyIterator< IsConst >::reference;
+  using pointer = typename TraversalIterator< IsConst >::pointer;
+  using reference = typename TraversalIterator< IsConst >::reference;
 
   BfsIterator() noexcept = default;
   template < bool RhsConst, std::enable_if_t< IsConst && !RhsConst, int > = 0 >
-  BfsIterator(const BfsIterator< RhsConst >& rhs):
-    HeavyIterator< IsConst >(rhs),
-    nodes_(rhs.nodes_)
+  BfsIterator(const BfsIterator< RhsConst >& rhs) noexcept:
+    TraversalIterator< IsConst >(rhs.node_, rhs.valuePtr_)
   {}
   template < bool RhsConst, std::enable_if_t< !IsConst || RhsConst, int > = 0 >
-  BfsIterator(Iterator< RhsConst > rhs):
+  BfsIterator(Iterator< RhsConst > rhs) noexcept:
     BfsIterator(rhs.node_)
   {}
 
@@ -564,25 +553,25 @@ public:
 
 private:
   friend class Map;
+  friend class BfsIterator< !IsConst >;
 
-  Queue< Node* > nodes_{};
-  using HeavyIterator< IsConst >::valuePtr_;
-  using HeavyIterator< IsConst >::node_;
+  using TraversalIterator< IsConst >::valuePtr_;
+  using TraversalIterator< IsConst >::node_;
 
-  BfsIterator(Node*);
+  BfsIterator(Node*) noexcept;
 };
 
 template < typename K, typename T, typename C >
 template < bool IsConst >
-kizhin::Map< K, T, C >::BfsIterator< IsConst >::BfsIterator(Node* root):
-  HeavyIterator< IsConst >()
+kizhin::Map< K, T, C >::BfsIterator< IsConst >::BfsIterator(Node* root) noexcept:
+  TraversalIterator< IsConst >()
 {
   while (root && root->parent) {
     root = root->parent;
   }
   if (root) {
-    nodes_.push(root);
-    ++(*this);
+    node_ = root;
+    valuePtr_ = root->begin;
   }
 }
 
@@ -590,23 +579,13 @@ template < typename K, typename T, typename C >
 template < bool IsConst >
 auto kizhin::Map< K, T, C >::BfsIterator< IsConst >::operator++() -> BfsIterator&
 {
-  if (valuePtr_ && valuePtr_ + 1 != node_->end) {
+  assert(node_ && valuePtr_ && "Incrementing empty BfsIterator");
+  if (valuePtr_ + 1 != node_->end) {
     ++valuePtr_;
     return *this;
   }
-  if (nodes_.empty()) {
-    valuePtr_ = nullptr;
-    node_ = nullptr;
-    return *this;
-  }
-  node_ = nodes_.front();
-  valuePtr_ = node_->begin;
-  nodes_.pop();
-  for (Node* child: node_->children) {
-    if (child && !detail::isEmpty(child)) {
-      nodes_.push(child);
-    }
-  }
+  node_ = detail::nextInLevel(node_);
+  valuePtr_ = node_ ? node_->begin : nullptr;
   return *this;
 }
 
@@ -870,8 +849,9 @@ template < typename K, typename T, typename C >
 template < typename InputIt >
 void kizhin::Map< K, T, C >::insert(InputIt first, const InputIt last)
 {
+  const_iterator hint = end();
   for (; first != last; ++first) {
-    insert(*first);
+    hint = std::next(emplaceHint(hint, *first).first);
   }
 }
 
@@ -972,8 +952,12 @@ std::pair< typename kizhin::Map< K, T, C >::iterator, bool > kizhin::Map< K, T,
   if (empty()) {
     return emplaceToEmpty(std::forward< Args >(args)...);
   }
-  EndNodeGuard guard(this);
   value_type value{ std::forward< Args >(args)... };
+  Node* leaf = getHintLeaf(hint);
+  if (leaf && isLeafTarget(leaf, value.first)) {
+    return emplaceToLeaf(leaf, std::move(value));
+  }
+  EndNodeGuard guard(this);
   Node* target = findTarget(hint.node_, value.first);
   pointer valuePtr = findKey(target, value.first);
   if (valuePtr != target->end) {
@@ -1104,6 +1088,19 @@ F kizhin::Map< K, T, C >::traverseBreadth(F func) const
   return std::for_each(bfsBegin(), bfsEnd(), func);
 }
 
+template < typename K, typename T, typename C >
+template < typename F >
+F kizhin::Map< K, T, C >::traverse(TraversalOrder order, F func) const
+{
+  if (order == TraversalOrder::lmr) {
+    return traverseLmr(std::move(func));
+  }
+  if (order == TraversalOrder::rml) {
+    return traverseRml(std::move(func));
+  }
+  return traverseBreadth(std::move(func));
+}
+
 template < typename K, typename T, typename C >
 class kizhin::Map< K, T, C >::EndNodeGuard
 {
@@ -1226,12 +1223,11 @@ typename kizhin::Map< K, T, C >::Node* kizhin::Map< K, T, C >::eraseFromNode(Nod
 }
 
 template < typename K, typename T, typename C >
-void kizhin::Map< K, T, C >::swapVals(Node* lhs, pointer lhsPtr, Node* rhs,
-    pointer rhsPtr)
+void kizhin::Map< K, T, C >::swapVals(Node*, pointer lhsPtr, Node*, pointer rhsPtr)
 {
   static_assert(is_nothrow_move_constructible_v< value_type >,
       "swapVals requires value_type to have a noexcept move constructor");
-  assert(lhs && lhsPtr && rhs && rhsPtr && "SwapVals: nullptr node given");
+  assert(lhsPtr && rhsPtr && "SwapVals: nullptr value given");
   value_type temp1(std::move(*lhsPtr));
   value_type temp2(std::move(*rhsPtr));
   lhsPtr->~value_type();
@@ -1358,6 +1354,88 @@ typename kizhin::Map< K, T, C >::Node* kizhin::Map< K, T, C >::validateHint(Node
   return isValid ? hint : root_;
 }
 
+template < typename K, typename T, typename C >
+typename kizhin::Map< K, T, C >::Node* kizhin::Map< K, T, C >::getHintLeaf(
+    const_iterator hint) const noexcept
+{
+  Node* node = hint.node_;
+  if (node && detail::isEmpty(node)) {
+    node = node->parent;
+  }
+  return node && detail::isLeaf(node) ? node : nullptr;
+}
+
+template < typename K, typename T, typename C >
+bool kizhin::Map< K, T, C >::isLeafTarget(Node* leaf, const key_type& key) const
+{
+  assert(leaf && detail::isLeaf(leaf) && "isLeafTarget: leaf node expected");
+  if (comparator_(key, leaf->begin->first)) {
+    Node* prevNode = nullptr;
+    pointer prevPtr = nullptr;
+    std::tie(prevNode, prevPtr) = detail::prevIter(leaf, leaf->begin);
+    return !prevNode || comparator_(prevPtr->first, key);
+  }
+  if (comparator_((leaf->end - 1)->first, key)) {
+    Node* nextNode = nullptr;
+    pointer nextPtr = nullptr;
+    std::tie(nextNode, nextPtr) = detail::nextIter(leaf, leaf->end - 1);
+    return !nextNode || detail::isEmpty(nextNode) || comparator_(key, nextPtr->first);
+  }
+  return true;
+}
+
+template < typename K, typename T, typename C >
+std::pair< typename kizhin::Map< K, T, C >::iterator, bool > kizhin::Map< K, T,
+    C >::emplaceToLeaf(Node* leaf, value_type&& value)
+{
+  pointer valuePtr = findKey(leaf, value.first);
+  if (valuePtr != leaf->end) {
+    return std::make_pair(iterator(leaf, valuePtr), false);
+  }
+  const key_type key = value.first;
+  if (detail::size(leaf) < 2) {
+    leaf = emplaceToNode(leaf, std::move(value));
+    ++size_;
+    return std::make_pair(iterator(leaf, findKey(leaf, key)), true);
+  }
+  Node* endNode = leaf->children[0];
+  leaf->children.fill(nullptr);
+  try {
+    leaf = emplaceToNode(leaf, std::move(value));
+    ++size_;
+    const key_type middle = (leaf->begin + 1)->first;
+    Node* parent = split(leaf);
+    const std::size_t pos = findKey(parent, middle) - parent->begin;
+    Node* left = parent->children[pos];
+    Node* right = parent->children[pos + 1];
+    while (detail::size(parent) > 2) {
+      parent = split(parent);
+    }
+    if (endNode) {
+      endNode->parent = right;
+      right->children.fill(endNode);
+    }
+    Node* node = right;
+    valuePtr = findKey(node, key);
+    if (valuePtr == node->end) {
+      node = left;
+      valuePtr = findKey(node, key);
+    }
+    while (valuePtr == node->end) {
+      node = node->parent;
+      valuePtr = findKey(node, key);
+    }
+    return std::make_pair(iterator(node, valuePtr), true);
+  } catch (...) {
+    if (endNode) {
+      Node* max = detail::treeMax(root_);
+      endNode->parent = max;
+      max->children.fill(endNode);
+    }
+    throw;
+  }
+}
+
 template < typename K, typename T, typename C >
 typename kizhin::Map< K, T, C >::Node* kizhin::Map< K, T, C >::fixUnderflow(Node* node)
 {
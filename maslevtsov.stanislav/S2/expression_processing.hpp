@@ -2,6 +2,7 @@
 #define EXPRESSION_PROCESSING_HPP
 
 #include "postfix_token.hpp"
+#include <queue.hpp>
 #include <stack.hpp>
 
 namespace maslevtsov {
@@ -2,6 +2,7 @@
 #define IO_STACK_HPP
 
 #include <iostream>
+#include <queue.hpp>
 #include <stack.hpp>
 #include "postfix_token.hpp"
 
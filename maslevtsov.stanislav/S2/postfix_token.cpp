@@ -1,9 +1,147 @@
 #include "postfix_token.hpp"
-#include <sstream>
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <stdexcept>
+#include <hash_table/definition.hpp>
 #include <stack.hpp>
 #include "checked_operations.hpp"
 
+namespace maslevtsov {
+  struct ExpressionNode
+  {
+    char operation = '\0';
+    std::shared_ptr< ExpressionNode > left;
+    std::shared_ptr< ExpressionNode > right;
+    bool evaluated = false;
+    long long result = 0;
+    std::exception_ptr error;
+
+    ExpressionNode() = default;
+    ExpressionNode(const ExpressionNode&) = delete;
+    ~ExpressionNode();
+    ExpressionNode& operator=(const ExpressionNode&) = delete;
+  };
+}
+
 namespace {
+  using node_ptr = std::shared_ptr< maslevtsov::ExpressionNode >;
+
+  struct NodeKey
+  {
+    char operation;
+    long long value;
+    const maslevtsov::ExpressionNode* left;
+    const maslevtsov::ExpressionNode* right;
+  };
+
+  std::size_t mix(std::uint64_t value, std::uint64_t seed) noexcept
+  {
+    value ^= seed;
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+    return static_cast< std::size_t >(value);
+  }
+
+  std::uint64_t combine(const NodeKey& key) noexcept
+  {
+    std::uint64_t result = static_cast< std::uint64_t >(key.value) * 31 + static_cast< unsigned char >(key.operation);
+    result = result * 0x100000001b3ULL ^ reinterpret_cast< std::uintptr_t >(key.left);
+    result = result * 0x100000001b3ULL ^ reinterpret_cast< std::uintptr_t >(key.right);
+    return result;
+  }
+
+  struct NodeKeyHash
+  {
+    std::size_t operator()(const NodeKey& key) const noexcept
+    {
+      return mix(combine(key), 0);
+    }
+  };
+
+  struct NodeKeyProbeHash
+  {
+    std::size_t operator()(const NodeKey& key) const noexcept
+    {
+      return mix(combine(key), 0x9e3779b97f4a7c15ULL);
+    }
+  };
+
+  struct NodeKeyEqual
+  {
+    bool operator()(const NodeKey& lhs, const NodeKey& rhs) const noexcept
+    {
+      return lhs.operation == rhs.operation && lhs.value == rhs.value && lhs.left == rhs.left &&
+             lhs.right == rhs.right;
+    }
+  };
+
+  using NodeTable = maslevtsov::HashTable< NodeKey, std::weak_ptr< maslevtsov::ExpressionNode >, NodeKeyHash,
+    NodeKeyProbeHash, NodeKeyEqual >;
+
+  struct NodePool
+  {
+    NodeTable table;
+    std::size_t purge_threshold = 1024;
+
+    NodePool()
+    {
+      table.max_load_factor(0.5);
+    }
+  };
+
+  NodePool& node_pool()
+  {
+    static NodePool pool;
+    return pool;
+  }
+
+  void purge_expired(NodePool& pool)
+  {
+    NodeTable alive;
+    alive.max_load_factor(0.5);
+    for (auto it = pool.table.cbegin(); it != pool.table.cend(); ++it) {
+      if (!it->second.expired()) {
+        alive.insert(*it);
+      }
+    }
+    pool.table.swap(alive);
+    pool.purge_threshold = std::max< std::size_t >(1024, pool.table.size() * 2);
+  }
+
+  node_ptr intern(char operation, long long value, const node_ptr& left, const node_ptr& right)
+  {
+    NodeKey key{operation, value, left.get(), right.get()};
+    NodePool& pool = node_pool();
+    auto it = pool.table.find(key);
+    if (it != pool.table.end()) {
+      node_ptr existing = it->second.lock();
+      if (existing) {
+        return existing;
+      }
+    }
+    node_ptr node(new maslevtsov::ExpressionNode());
+    node->operation = operation;
+    node->left = left;
+    node->right = right;
+    if (operation == '\0') {
+      node->evaluated = true;
+      node->result = value;
+    }
+    if (it != pool.table.end()) {
+      it->second = node;
+    } else {
+      if (pool.table.size() >= pool.purge_threshold) {
+        purge_expired(pool);
+      }
+      pool.table.insert({key, node});
+    }
+    return node;
+  }
+
   bool is_operation(const std::string& str) noexcept
   {
     return str == "*" || str == "/" || str == "%" || str == "+" || str == "-";
@@ -28,12 +166,89 @@ namespace {
   {
     return get_precedence(left[0]) <= get_precedence(right[0]);
   }
+
+  void push_element(maslevtsov::Stack< node_ptr >& operands, const std::string& element)
+  {
+    if (is_operation(element)) {
+      if (operands.size() < 2) {
+        throw std::logic_error("invalid expression");
+      }
+      node_ptr right = std::move(operands.top());
+      operands.pop();
+      node_ptr left = std::move(operands.top());
+      operands.pop();
+      operands.push(intern(element[0], 0, left, right));
+    } else {
+      std::size_t pos = 0;
+      long long operand = std::stoll(element, &pos);
+      if (pos != element.length()) {
+        throw std::invalid_argument("invalid operand");
+      }
+      operands.push(intern('\0', operand, nullptr, nullptr));
+    }
+  }
+
+  long long apply_operation(char operation, long long left, long long right)
+  {
+    switch (operation) {
+    case '*':
+      return maslevtsov::checked_multiplication(left, right);
+    case '/':
+      return maslevtsov::checked_division(left, right);
+    case '%':
+      return maslevtsov::checked_remainder(left, right);
+    case '+':
+      return maslevtsov::checked_addition(left, right);
+    case '-':
+      return maslevtsov::checked_subtraction(left, right);
+    default:
+      throw std::logic_error("invalid operation");
+    }
+  }
+
+  void evaluate_node(maslevtsov::ExpressionNode& node)
+  {
+    if (node.left->error) {
+      node.error = node.left->error;
+    } else if (node.right->error) {
+      node.error = node.right->error;
+    } else {
+      try {
+        node.result = apply_operation(node.operation, node.left->result, node.right->result);
+      } catch (const std::exception&) {
+        node.error = std::current_exception();
+      }
+    }
+    node.evaluated = true;
+  }
+
+  void release_child(maslevtsov::Stack< node_ptr >& orphans, node_ptr& child)
+  {
+    if (child && child.use_count() == 1) {
+      orphans.push(std::move(child));
+    }
+    child.reset();
+  }
+}
+
+maslevtsov::ExpressionNode::~ExpressionNode()
+{
+  Stack< node_ptr > orphans;
+  release_child(orphans, left);
+  release_child(orphans, right);
+  while (!orphans.empty()) {
+    node_ptr node = std::move(orphans.top());
+    orphans.pop();
+    release_child(orphans, node->left);
+    release_child(orphans, node->right);
+  }
 }
 
 maslevtsov::PostfixToken::PostfixToken(const std::string& infix_token):
-  token_()
+  root_()
 {
   Stack< std::string > dump;
+  Stack< node_ptr > operands;
   std::size_t start = 0;
   while (start < infix_token.length()) {
     std::size_t end = infix_token.find(' ', start);
@@ -49,13 +264,13 @@ maslevtsov::PostfixToken::PostfixToken(const std::string& infix_token):
       dump.push(element);
     } else if (is_operation(element)) {
       while (!dump.empty() && (precedence_comp(dump.top(), element))) {
-        token_.push(dump.top());
+        push_element(operands, dump.top());
         dump.pop();
       }
       dump.push(element);
     } else if (element == ")") {
       while (!dump.empty() && dump.top() != "(") {
-        token_.push(dump.top());
+        push_element(operands, dump.top());
         dump.pop();
       }
       if (dump.empty()) {
@@ -63,85 +278,82 @@ maslevtsov::PostfixToken::PostfixToken(const std::string& infix_token):
       }
       dump.pop();
     } else {
-      token_.push(element);
+      push_element(operands, element);
     }
   }
   while (!dump.empty()) {
     if (!is_operation(dump.top())) {
       throw std::logic_error("invalid expression");
     }
-    token_.push(dump.top());
+    push_element(operands, dump.top());
     dump.pop();
   }
+  if (operands.size() != 1) {
+    throw std::logic_error("invalid expression");
+  }
+  root_ = std::move(operands.top());
   (*this)();
 }
 
+maslevtsov::PostfixToken::PostfixToken(std::shared_ptr< ExpressionNode > root) noexcept:
+  root_(std::move(root))
+{}
+
 maslevtsov::PostfixToken maslevtsov::PostfixToken::operator+(const PostfixToken& other) const
 {
-  PostfixToken result(*this);
-  return result.math_operator_impl(other, "+");
+  return math_operator_impl(other, '+');
 }
 
 maslevtsov::PostfixToken maslevtsov::PostfixToken::operator-(const PostfixToken& other) const
 {
-  PostfixToken result(*this);
-  return result.math_operator_impl(other, "-");
+  return math_operator_impl(other, '-');
 }
 
 maslevtsov::PostfixToken maslevtsov::PostfixToken::operator*(const PostfixToken& other) const
 {
-  PostfixToken result(*this);
-  return result.math_operator_impl(other, "*");
+  return math_operator_impl(other, '*');
 }
 
 maslevtsov::PostfixToken maslevtsov::PostfixToken::operator/(const PostfixToken& other) const
 {
-  PostfixToken result(*this);
-  return result.math_operator_impl(other, "/");
+  return math_operator_impl(other, '/');
 }
 
 maslevtsov::PostfixToken maslevtsov::PostfixToken::operator%(const PostfixToken& other) const
 {
-  PostfixToken result(*this);
-  return result.math_operator_impl(other, "%");
+  return math_operator_impl(other, '%');
 }
 
 long long maslevtsov::PostfixToken::operator()() const
 {
-  Stack< long long > dump;
-  Queue< std::string > exp = token_;
-  while (!exp.empty()) {
-    if (is_operation(exp.front())) {
-      if (dump.size() < 2) {
-        throw std::logic_error("invalid expression");
-      }
-      long long operand2 = dump.top();
-      dump.pop();
-      long long operand1 = dump.top();
-      dump.pop();
-      dump.push(checked_operation(operand1, operand2, exp.front()));
-      exp.pop();
+  if (!root_) {
+    throw std::logic_error("invalid expression");
+  }
+  Stack< ExpressionNode* > path;
+  path.push(root_.get());
+  while (!path.empty()) {
+    ExpressionNode* node = path.top();
+    if (node->evaluated) {
+      path.pop();
+    } else if (!node->left->evaluated) {
+      path.push(node->left.get());
+    } else if (!node->right->evaluated) {
+      path.push(node->right.get());
     } else {
-      std::size_t pos = 0;
-      long long operand = std::stoll(exp.front(), &pos);
-      if (pos != exp.front().length()) {
-        throw std::invalid_argument("invalid operand");
-      }
-      dump.push(operand);
-      exp.pop();
+      evaluate_node(*node);
+      path.pop();
     }
   }
-  return dump.top();
+  if (root_->error) {
+    std::rethrow_exception(root_->error);
+  }
+  return root_->result;
 }
 
-maslevtsov::PostfixToken& maslevtsov::PostfixToken::math_operator_impl(const PostfixToken& other,
-  const std::string& operation)
+maslevtsov::PostfixToken maslevtsov::PostfixToken::math_operator_impl(const PostfixToken& other, char operation) const
 {
-  PostfixToken copy(other);
-  while (!copy.token_.empty()) {
-    token_.push(copy.token_.front());
-    copy.token_.pop();
+  if (!root_ || !other.root_) {
+    throw std::logic_error("invalid expression");
   }
-  token_.push(operation);
-  return *this;
+  return PostfixToken(intern(operation, 0, root_, other.root_));
 }
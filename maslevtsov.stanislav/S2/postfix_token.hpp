@@ -1,10 +1,12 @@
 #ifndef POSTFIX_TOKEN_HPP
 #define POSTFIX_TOKEN_HPP
 
+#include <memory>
 #include <string>
-#include <queue.hpp>
 
 namespace maslevtsov {
+  struct ExpressionNode;
+
   class PostfixToken
   {
   public:
@@ -25,9 +27,10 @@ namespace maslevtsov {
     long long operator()() const;
 
   private:
-    Queue< std::string > token_;
+    std::shared_ptr< ExpressionNode > root_;
 
-    PostfixToken& math_operator_impl(const PostfixToken& other, const std::string& operation);
+    explicit PostfixToken(std::shared_ptr< ExpressionNode > root) noexcept;
+    PostfixToken math_operator_impl(const PostfixToken& other, char operation) const;
   };
 }
 
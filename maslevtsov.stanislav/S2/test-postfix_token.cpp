@@ -62,3 +62,40 @@ BOOST_AUTO_TEST_CASE(postfix_token_parenthesis_operator_test)
   BOOST_TEST(res == 1);
 }
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(postfix_token_dag_tests)
+BOOST_AUTO_TEST_CASE(postfix_token_shared_subexpression_test)
+{
+  maslevtsov::PostfixToken exp("1 + 1");
+  for (int i = 0; i < 61; ++i) {
+    exp = exp + exp;
+  }
+  BOOST_TEST(exp() == (1LL << 62));
+  BOOST_CHECK_THROW((exp + exp)(), std::overflow_error);
+}
+
+BOOST_AUTO_TEST_CASE(postfix_token_deep_chain_test)
+{
+  maslevtsov::PostfixToken one("1");
+  maslevtsov::PostfixToken exp(one);
+  for (int i = 0; i < 200000; ++i) {
+    exp = exp + one;
+  }
+  BOOST_TEST(exp() == 200001);
+}
+
+BOOST_AUTO_TEST_CASE(postfix_token_cached_error_test)
+{
+  maslevtsov::PostfixToken zero("0");
+  maslevtsov::PostfixToken exp(maslevtsov::PostfixToken("5") / zero);
+  BOOST_CHECK_THROW(exp(), std::logic_error);
+  BOOST_CHECK_THROW((exp + zero)(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(postfix_token_invalid_structure_test)
+{
+  BOOST_CHECK_THROW(maslevtsov::PostfixToken("1 2"), std::logic_error);
+  BOOST_CHECK_THROW(maslevtsov::PostfixToken("1 +"), std::logic_error);
+  BOOST_CHECK_THROW(maslevtsov::PostfixToken()(), std::logic_error);
+}
+BOOST_AUTO_TEST_SUITE_END()
@@ -319,7 +319,7 @@ void maslevtsov::HashTable< Key, T, Hash, ProbeHash, KeyEqual >::rehash(size_typ
     if (it->state == detail::SlotState::OCCUPIED) {
       const Key& key = it->data.first;
       size_t index = hasher_(key) % new_slots.size();
-      size_t odd_step = detail::get_odd_step(key, slots_.size(), probe_hasher_);
+      size_t odd_step = detail::get_odd_step(key, new_slots.size(), probe_hasher_);
       while (new_slots[index].state == detail::SlotState::OCCUPIED) {
         index = (index + odd_step) % new_slots.size();
       }
@@ -211,3 +211,24 @@ maslov::Queue< std::string > maslov::infixToPostfix(Queue< std::string > infixQu
   }
   return postfixQueue;
 }
+
+void maslov::splitExpression(const std::string & str, Queue< std::string > & infixQueue)
+{
+  char separator = ' ';
+  size_t begin = str.find_first_not_of(separator);
+  size_t end = 0;
+  while (begin != std::string::npos)
+  {
+    end = str.find(separator, begin);
+    std::string element = str.substr(begin, end - begin);
+    infixQueue.push(element);
+    begin = str.find_first_not_of(separator, end);
+  }
+}
+
+long long int maslov::calculateExpression(const std::string & str)
+{
+  Queue< std::string > infixQueue;
+  splitExpression(str, infixQueue);
+  return calculatePostfix(infixToPostfix(infixQueue));
+}
@@ -9,6 +9,8 @@ namespace maslov
 {
   long long int calculatePostfix(Queue< std::string > postfixQueue);
   Queue< std::string > infixToPostfix(Queue< std::string > infixQueue);
+  void splitExpression(const std::string & str, Queue< std::string > & infixQueue);
+  long long int calculateExpression(const std::string & str);
 }
 
 #endif
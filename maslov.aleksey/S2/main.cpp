@@ -1,24 +1,13 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <cstring>
+#include <thread>
 #include "calculatorExpression.hpp"
+#include "parallelCalculator.hpp"
 
 namespace
 {
-  void splitExpression(const std::string & str, maslov::Queue< std::string > & infixQueue)
-  {
-    char separator = ' ';
-    size_t begin = str.find_first_not_of(separator);
-    size_t end = 0;
-    while (begin != std::string::npos)
-    {
-      end = str.find(separator, begin);
-      std::string element = str.substr(begin, end - begin);
-      infixQueue.push(element);
-      begin = str.find_first_not_of(separator, end);
-    }
-  }
-
   void inputExpression(std::istream & in, maslov::Queue< maslov::Queue< std::string > > & queue)
   {
     std::string str;
@@ -29,7 +18,7 @@ namespace
         continue;
       }
       maslov::Queue< std::string > infixQueue;
-      splitExpression(str, infixQueue);
+      maslov::splitExpression(str, infixQueue);
       queue.push(infixQueue);
     }
   }
@@ -56,19 +45,26 @@ int main(int argc, char ** argv)
   Stack< long long int > results;
   try
   {
-    if (argc > 1)
+    bool parallel = (argc > 1) && (std::strcmp(argv[1], "--parallel") == 0);
+    int fileArg = parallel ? 2 : 1;
+    std::ifstream fileInput;
+    if (argc > fileArg)
     {
-      std::ifstream fileInput(argv[1]);
+      fileInput.open(argv[fileArg]);
       if (!fileInput.is_open())
       {
         std::cerr << "ERROR: cannot open the file\n";
         return 1;
       }
-      inputExpression(fileInput, queue);
+    }
+    std::istream & in = fileInput.is_open() ? fileInput : std::cin;
+    if (parallel)
+    {
+      calculateParallel(in, results, std::thread::hardware_concurrency());
     }
     else
     {
-      inputExpression(std::cin, queue);
+      inputExpression(in, queue);
     }
     while (!queue.empty())
     {
@@ -0,0 +1,234 @@
+#include "parallelCalculator.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <queue.hpp>
+#include "calculatorExpression.hpp"
+
+namespace
+{
+  struct Chunk
+  {
+    const char * begin = nullptr;
+    const char * end = nullptr;
+    maslov::Queue< long long int > values;
+    std::exception_ptr error;
+    bool done = false;
+  };
+
+  struct Block
+  {
+    std::string data;
+    std::unique_ptr< Chunk[] > chunks;
+    size_t capacity = 0;
+    size_t size = 0;
+  };
+
+  const char * findLineEnd(const char * begin, const char * end)
+  {
+    const void * found = std::memchr(begin, '\n', end - begin);
+    return found ? static_cast< const char * >(found) + 1 : end;
+  }
+
+  const char * findLastLineEnd(const char * begin, const char * end)
+  {
+    while ((end != begin) && (*(end - 1) != '\n'))
+    {
+      --end;
+    }
+    return end;
+  }
+
+  void calculateChunk(Chunk & chunk)
+  {
+    try
+    {
+      for (const char * begin = chunk.begin; begin != chunk.end;)
+      {
+        const char * lineEnd = findLineEnd(begin, chunk.end);
+        const char * contentEnd = (*(lineEnd - 1) == '\n') ? lineEnd - 1 : lineEnd;
+        if (begin != contentEnd)
+        {
+          chunk.values.push(maslov::calculateExpression(std::string(begin, contentEnd)));
+        }
+        begin = lineEnd;
+      }
+    }
+    catch (...)
+    {
+      chunk.error = std::current_exception();
+    }
+  }
+
+  class ChunkWorkers
+  {
+   public:
+    explicit ChunkWorkers(size_t count):
+      stopped_(false),
+      started_(0),
+      threads_(new std::thread[count])
+    {
+      try
+      {
+        for (; started_ < count; ++started_)
+        {
+          threads_[started_] = std::thread(&ChunkWorkers::run, this);
+        }
+      }
+      catch (...)
+      {
+        stop();
+        throw;
+      }
+    }
+    ChunkWorkers(const ChunkWorkers &) = delete;
+    ~ChunkWorkers()
+    {
+      stop();
+    }
+    ChunkWorkers & operator=(const ChunkWorkers &) = delete;
+
+    void submit(Block & block)
+    {
+      {
+        std::lock_guard< std::mutex > lock(mutex_);
+        for (size_t i = 0; i < block.size; ++i)
+        {
+          pending_.push(&block.chunks[i]);
+        }
+      }
+      queued_.notify_all();
+    }
+    void wait(const Chunk & chunk)
+    {
+      std::unique_lock< std::mutex > lock(mutex_);
+      while (!chunk.done)
+      {
+        finished_.wait(lock);
+      }
+    }
+
+   private:
+    std::mutex mutex_;
+    std::condition_variable queued_;
+    std::condition_variable finished_;
+    maslov::Queue< Chunk * > pending_;
+    bool stopped_;
+    size_t started_;
+    std::unique_ptr< std::thread[] > threads_;
+
+    void run()
+    {
+      std::unique_lock< std::mutex > lock(mutex_);
+      while (true)
+      {
+        while (!stopped_ && pending_.empty())
+        {
+          queued_.wait(lock);
+        }
+        if (stopped_)
+        {
+          return;
+        }
+        Chunk * chunk = pending_.front();
+        pending_.pop();
+        lock.unlock();
+        calculateChunk(*chunk);
+        lock.lock();
+        chunk->done = true;
+        finished_.notify_all();
+      }
+    }
+    void stop() noexcept
+    {
+      {
+        std::lock_guard< std::mutex > lock(mutex_);
+        stopped_ = true;
+      }
+      queued_.notify_all();
+      for (size_t i = 0; i < started_; ++i)
+      {
+        threads_[i].join();
+      }
+    }
+  };
+
+  const char * readBlock(std::istream & in, Block & block, const char * tail,
+      const char * tailEnd, size_t blockSize)
+  {
+    const size_t carried = tailEnd - tail;
+    block.data.resize(carried + blockSize);
+    std::copy(tail, tailEnd, &block.data[0]);
+    in.read(&block.data[carried], blockSize);
+    block.data.resize(carried + in.gcount());
+    const char * begin = block.data.data();
+    const char * end = begin + block.data.size();
+    return in ? findLastLineEnd(begin, end) : end;
+  }
+
+  void splitBlock(Block & block, const char * begin, const char * end)
+  {
+    block.size = 0;
+    const size_t step = (end - begin) / block.capacity + 1;
+    while ((block.size < block.capacity) && (begin != end))
+    {
+      size_t left = end - begin;
+      Chunk & chunk = block.chunks[block.size++];
+      chunk.begin = begin;
+      chunk.end = findLineEnd(begin + std::min(step, left) - 1, end);
+      chunk.error = nullptr;
+      chunk.done = false;
+      begin = chunk.end;
+    }
+  }
+
+  void collectBlock(ChunkWorkers & workers, Block & block, maslov::Stack< long long int > & results)
+  {
+    for (size_t i = 0; i < block.size; ++i)
+    {
+      Chunk & chunk = block.chunks[i];
+      workers.wait(chunk);
+      if (chunk.error)
+      {
+        std::rethrow_exception(chunk.error);
+      }
+      for (; !chunk.values.empty(); chunk.values.pop())
+      {
+        results.push(chunk.values.front());
+      }
+    }
+    block.size = 0;
+  }
+}
+
+void maslov::calculateParallel(std::istream & in, Stack< long long int > & results,
+    size_t jobs, size_t blockSize)
+{
+  Block blocks[2];
+  for (size_t i = 0; i < 2; ++i)
+  {
+    blocks[i].capacity = std::max< size_t >(jobs, 1);
+    blocks[i].chunks.reset(new Chunk[blocks[i].capacity]);
+  }
+  ChunkWorkers workers(blocks[0].capacity);
+  const char * tail = nullptr;
+  const char * tailEnd = nullptr;
+  size_t current = 0;
+  while (in)
+  {
+    Block & block = blocks[current];
+    const char * lines = readBlock(in, block, tail, tailEnd, blockSize);
+    splitBlock(block, block.data.data(), lines);
+    workers.submit(block);
+    tail = lines;
+    tailEnd = block.data.data() + block.data.size();
+    current ^= 1;
+    collectBlock(workers, blocks[current], results);
+  }
+  collectBlock(workers, blocks[current ^ 1], results);
+}
@@ -0,0 +1,13 @@
+#ifndef PARALLEL_CALCULATOR_HPP
+#define PARALLEL_CALCULATOR_HPP
+
+#include <istream>
+#include <stack.hpp>
+
+namespace maslov
+{
+  void calculateParallel(std::istream & in, Stack< long long int > & results,
+      size_t jobs, size_t blockSize = 1 << 22);
+}
+
+#endif
@@ -0,0 +1,59 @@
+#include <boost/test/unit_test.hpp>
+#include <sstream>
+#include <string>
+#include "parallelCalculator.hpp"
+
+namespace
+{
+  std::string makeExpressions(size_t count)
+  {
+    std::string str;
+    for (size_t i = 0; i < count; ++i)
+    {
+      str += "( " + std::to_string(i) + " + 5 ) * 3 % 7\n\n";
+    }
+    return str;
+  }
+
+  std::string calculate(const std::string & input, size_t jobs, size_t blockSize)
+  {
+    std::istringstream in(input);
+    maslov::Stack< long long int > results;
+    maslov::calculateParallel(in, results, jobs, blockSize);
+    std::ostringstream out;
+    while (!results.empty())
+    {
+      out << results.top() << " ";
+      results.pop();
+    }
+    return out.str();
+  }
+}
+
+BOOST_AUTO_TEST_CASE(parallelCalculatorOrder)
+{
+  std::string input = makeExpressions(300);
+  std::string expected = calculate(input, 1, 1 << 16);
+  BOOST_TEST(calculate(input, 4, 1 << 16) == expected);
+  BOOST_TEST(calculate(input, 3, 10) == expected);
+  BOOST_TEST(calculate("1 + 2\n3 * 4", 2, 3) == "12 3 ");
+}
+
+BOOST_AUTO_TEST_CASE(parallelCalculatorFirstError)
+{
+  std::string input = makeExpressions(100) + "1 / 0\n" + makeExpressions(100) + "2 +\n";
+  for (size_t jobs = 1; jobs < 5; ++jobs)
+  {
+    std::istringstream in(input);
+    maslov::Stack< long long int > results;
+    try
+    {
+      maslov::calculateParallel(in, results, jobs, 50);
+      BOOST_TEST(false);
+    }
+    catch (const std::runtime_error & e)
+    {
+      BOOST_TEST(std::string(e.what()) == "ERROR: division by zero");
+    }
+  }
+}
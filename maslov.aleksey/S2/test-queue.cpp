@@ -101,3 +101,20 @@ BOOST_AUTO_TEST_CASE(swapQueue)
   BOOST_TEST(queue.empty());
   BOOST_TEST(out.str() == "12");
 }
+
+BOOST_AUTO_TEST_CASE(interleavedPushPopQueue)
+{
+  maslov::Queue< int > queue;
+  queue.push(1);
+  queue.push(2);
+  queue.pop();
+  queue.push(3);
+  queue.push(4);
+  queue.pop();
+  queue.push(5);
+  maslov::Queue< int > copyQueue(queue);
+  std::ostringstream out;
+  printQueue(out, queue);
+  printQueue(out, copyQueue);
+  BOOST_TEST(out.str() == "345345");
+}
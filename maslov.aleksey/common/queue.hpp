@@ -41,14 +41,14 @@ namespace maslov
   Queue< T >::Queue(const Queue< T > & rhs):
     capacity_(rhs.capacity_),
     size_(rhs.size_),
-    head_(rhs.head_),
+    head_(0),
     data_(new T[rhs.capacity_])
   {
     try
     {
       for (size_t i = 0; i < size_; ++i)
       {
-        data_[i] = rhs.data_[i];
+        data_[i] = rhs.data_[(rhs.head_ + i) % capacity_];
       }
     }
     catch (const std::exception &)
@@ -134,11 +134,12 @@ namespace maslov
         newData = new T[newCapacity];
         for (size_t i = 0; i < size_; ++i)
         {
-          newData[i] = data_[i];
+          newData[i] = data_[(head_ + i) % capacity_];
         }
         delete[] data_;
         data_ = newData;
         capacity_ = newCapacity;
+        head_ = 0;
       }
       catch (const std::exception &)
       {
@@ -146,7 +147,8 @@ namespace maslov
         throw;
       }
     }
-    data_[size_++] = data;
+    data_[(head_ + size_) % capacity_] = data;
+    ++size_;
   }
 
   template< typename T >
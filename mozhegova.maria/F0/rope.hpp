@@ -0,0 +1,343 @@
+#ifndef ROPE_HPP
+#define ROPE_HPP
+
+#include <cstddef>
+#include <utility>
+#include <dynamicArray.hpp>
+
+namespace mozhegova
+{
+  template< typename T >
+  class Rope
+  {
+  public:
+    static constexpr size_t npos = static_cast< size_t >(-1);
+
+    Rope();
+
+    size_t size() const noexcept;
+    bool empty() const noexcept;
+
+    T & value(size_t id);
+    const T & value(size_t id) const;
+
+    size_t idAt(size_t index) const;
+    size_t indexOf(size_t id) const;
+
+    size_t create();
+    void release(size_t id);
+    void insert(size_t index, const DynamicArray< size_t > & ids);
+    DynamicArray< size_t > erase(size_t begin, size_t end);
+    DynamicArray< size_t > ids(size_t begin, size_t end) const;
+    void reverse() noexcept;
+
+    template< typename F >
+    void forEach(F f) const;
+  private:
+    struct Node
+    {
+      size_t left;
+      size_t right;
+      size_t parent;
+      size_t size;
+      size_t priority;
+      T value;
+    };
+
+    DynamicArray< Node > nodes_;
+    DynamicArray< size_t > free_;
+    size_t root_;
+    size_t seed_;
+    bool reversed_;
+
+    size_t sizeOf(size_t id) const noexcept;
+    void update(size_t id) noexcept;
+    void split(size_t id, size_t count, size_t & left, size_t & right) noexcept;
+    size_t merge(size_t left, size_t right) noexcept;
+    void collect(size_t id, size_t offset, size_t begin, size_t end, DynamicArray< size_t > &) const;
+    template< typename F >
+    void walk(size_t id, F & f) const;
+  };
+
+  template< typename T >
+  constexpr size_t Rope< T >::npos;
+
+  template< typename T >
+  Rope< T >::Rope():
+    nodes_(),
+    free_(),
+    root_(npos),
+    seed_(0),
+    reversed_(false)
+  {}
+
+  template< typename T >
+  size_t Rope< T >::size() const noexcept
+  {
+    return sizeOf(root_);
+  }
+
+  template< typename T >
+  bool Rope< T >::empty() const noexcept
+  {
+    return root_ == npos;
+  }
+
+  template< typename T >
+  T & Rope< T >::value(size_t id)
+  {
+    return nodes_[id].value;
+  }
+
+  template< typename T >
+  const T & Rope< T >::value(size_t id) const
+  {
+    return nodes_[id].value;
+  }
+
+  template< typename T >
+  size_t Rope< T >::idAt(size_t index) const
+  {
+    size_t rank = reversed_ ? size() - 1 - index : index;
+    size_t id = root_;
+    while (sizeOf(nodes_[id].left) != rank)
+    {
+      if (rank < sizeOf(nodes_[id].left))
+      {
+        id = nodes_[id].left;
+      }
+      else
+      {
+        rank -= sizeOf(nodes_[id].left) + 1;
+        id = nodes_[id].right;
+      }
+    }
+    return id;
+  }
+
+  template< typename T >
+  size_t Rope< T >::indexOf(size_t id) const
+  {
+    size_t rank = sizeOf(nodes_[id].left);
+    for (size_t parent = nodes_[id].parent; parent != npos; parent = nodes_[id].parent)
+    {
+      if (nodes_[parent].right == id)
+      {
+        rank += sizeOf(nodes_[parent].left) + 1;
+      }
+      id = parent;
+    }
+    return reversed_ ? size() - 1 - rank : rank;
+  }
+
+  template< typename T >
+  size_t Rope< T >::create()
+  {
+    seed_ += 0x9E3779B97F4A7C15ULL;
+    size_t priority = seed_;
+    priority = (priority ^ (priority >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    priority = (priority ^ (priority >> 27)) * 0x94D049BB133111EBULL;
+    priority ^= priority >> 31;
+    Node node{npos, npos, npos, 1, priority, T()};
+    if (free_.empty())
+    {
+      nodes_.push_back(node);
+      return nodes_.size() - 1;
+    }
+    size_t id = free_[free_.size() - 1];
+    free_.pop_back();
+    nodes_[id] = node;
+    return id;
+  }
+
+  template< typename T >
+  void Rope< T >::release(size_t id)
+  {
+    nodes_[id].value = T();
+    free_.push_back(id);
+  }
+
+  template< typename T >
+  void Rope< T >::insert(size_t index, const DynamicArray< size_t > & ids)
+  {
+    size_t run = npos;
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+      size_t id = reversed_ ? ids[ids.size() - 1 - i] : ids[i];
+      run = merge(run, id);
+    }
+    size_t left = npos;
+    size_t right = npos;
+    split(root_, reversed_ ? size() - index : index, left, right);
+    root_ = merge(merge(left, run), right);
+    if (root_ != npos)
+    {
+      nodes_[root_].parent = npos;
+    }
+  }
+
+  template< typename T >
+  DynamicArray< size_t > Rope< T >::erase(size_t begin, size_t end)
+  {
+    DynamicArray< size_t > result;
+    if (begin >= end)
+    {
+      return result;
+    }
+    size_t first = reversed_ ? size() - end : begin;
+    size_t left = npos;
+    size_t middle = npos;
+    size_t right = npos;
+    split(root_, first, left, middle);
+    split(middle, end - begin, middle, right);
+    collect(middle, 0, 0, end - begin, result);
+    if (reversed_)
+    {
+      for (size_t i = 0; i < result.size() / 2; ++i)
+      {
+        std::swap(result[i], result[result.size() - 1 - i]);
+      }
+    }
+    root_ = merge(left, right);
+    if (root_ != npos)
+    {
+      nodes_[root_].parent = npos;
+    }
+    return result;
+  }
+
+  template< typename T >
+  DynamicArray< size_t > Rope< T >::ids(size_t begin, size_t end) const
+  {
+    DynamicArray< size_t > result;
+    if (begin >= end)
+    {
+      return result;
+    }
+    size_t first = reversed_ ? size() - end : begin;
+    collect(root_, 0, first, first + end - begin, result);
+    if (reversed_)
+    {
+      for (size_t i = 0; i < result.size() / 2; ++i)
+      {
+        std::swap(result[i], result[result.size() - 1 - i]);
+      }
+    }
+    return result;
+  }
+
+  template< typename T >
+  void Rope< T >::reverse() noexcept
+  {
+    reversed_ = !reversed_;
+  }
+
+  template< typename T >
+  template< typename F >
+  void Rope< T >::forEach(F f) const
+  {
+    walk(root_, f);
+  }
+
+  template< typename T >
+  size_t Rope< T >::sizeOf(size_t id) const noexcept
+  {
+    return id == npos ? 0 : nodes_[id].size;
+  }
+
+  template< typename T >
+  void Rope< T >::update(size_t id) noexcept
+  {
+    Node & node = nodes_[id];
+    node.size = 1 + sizeOf(node.left) + sizeOf(node.right);
+    if (node.left != npos)
+    {
+      nodes_[node.left].parent = id;
+    }
+    if (node.right != npos)
+    {
+      nodes_[node.right].parent = id;
+    }
+  }
+
+  template< typename T >
+  void Rope< T >::split(size_t id, size_t count, size_t & left, size_t & right) noexcept
+  {
+    if (id == npos)
+    {
+      left = npos;
+      right = npos;
+      return;
+    }
+    if (sizeOf(nodes_[id].left) < count)
+    {
+      split(nodes_[id].right, count - sizeOf(nodes_[id].left) - 1, nodes_[id].right, right);
+      left = id;
+    }
+    else
+    {
+      split(nodes_[id].left, count, left, nodes_[id].left);
+      right = id;
+    }
+    update(id);
+    nodes_[id].parent = npos;
+  }
+
+  template< typename T >
+  size_t Rope< T >::merge(size_t left, size_t right) noexcept
+  {
+    if (left == npos)
+    {
+      return right;
+    }
+    if (right == npos)
+    {
+      return left;
+    }
+    if (nodes_[left].priority > nodes_[right].priority)
+    {
+      size_t merged = merge(nodes_[left].right, right);
+      nodes_[left].right = merged;
+      update(left);
+      return left;
+    }
+    size_t merged = merge(left, nodes_[right].left);
+    nodes_[right].left = merged;
+    update(right);
+    return right;
+  }
+
+  template< typename T >
+  void Rope< T >::collect(size_t id, size_t offset, size_t begin, size_t end,
+    DynamicArray< size_t > & out) const
+  {
+    if (id == npos || offset >= end || offset + nodes_[id].size <= begin)
+    {
+      return;
+    }
+    const Node & node = nodes_[id];
+    collect(node.left, offset, begin, end, out);
+    size_t rank = offset + sizeOf(node.left);
+    if (rank >= begin && rank < end)
+    {
+      out.push_back(id);
+    }
+    collect(node.right, rank + 1, begin, end, out);
+  }
+
+  template< typename T >
+  template< typename F >
+  void Rope< T >::walk(size_t id, F & f) const
+  {
+    if (id == npos)
+    {
+      return;
+    }
+    const Node & node = nodes_[id];
+    walk(reversed_ ? node.right : node.left, f);
+    f(id);
+    walk(reversed_ ? node.left : node.right, f);
+  }
+}
+
+#endif
@@ -0,0 +1,128 @@
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "commands.hpp"
+
+namespace
+{
+  mozhegova::Text makeText(const std::string & str)
+  {
+    mozhegova::Text text;
+    std::istringstream in(str);
+    std::string line;
+    for (size_t lineNum = 1; std::getline(in, line); ++lineNum)
+    {
+      std::istringstream words(line);
+      std::string word;
+      for (size_t num = 1; words >> word; ++num)
+      {
+        text.addWord(word, lineNum, num);
+      }
+    }
+    return text;
+  }
+
+  std::string refs(const mozhegova::Text & text, const std::string & word)
+  {
+    auto it = text.dictionary().find(word);
+    if (it == text.dictionary().cend())
+    {
+      return "";
+    }
+    mozhegova::Xrefs xrefs = text.xrefs(it->second);
+    std::vector< mozhegova::WordPos > sorted;
+    for (size_t i = 0; i < xrefs.size(); ++i)
+    {
+      sorted.push_back(xrefs[i]);
+    }
+    std::sort(sorted.begin(), sorted.end());
+    std::ostringstream out;
+    for (size_t i = 0; i < sorted.size(); ++i)
+    {
+      out << '(' << sorted[i].first << ',' << sorted[i].second << ')';
+    }
+    return out.str();
+  }
+
+  void run(void (* cmd)(std::istream &, mozhegova::Texts &), const std::string & args, mozhegova::Texts & texts)
+  {
+    std::istringstream in(args);
+    cmd(in, texts);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(remove_lines_keeps_occurrences_outside_range)
+{
+  mozhegova::Texts texts;
+  texts["t"] = makeText("a b\nb c\na c\nd");
+  run(mozhegova::removeLines, "t 2 3", texts);
+  const mozhegova::Text & text = texts["t"];
+  BOOST_TEST(text.str() == "a b\na c\nd");
+  BOOST_TEST(refs(text, "a") == "(1,1)(2,1)");
+  BOOST_TEST(refs(text, "b") == "(1,2)");
+  BOOST_TEST(refs(text, "c") == "(2,2)");
+  BOOST_TEST(text.wordCount() == 5);
+}
+
+BOOST_AUTO_TEST_CASE(remove_lines_rejects_bad_range)
+{
+  mozhegova::Texts texts;
+  texts["t"] = makeText("a\nb\nc");
+  BOOST_CHECK_THROW(run(mozhegova::removeLines, "t 0 2", texts), std::runtime_error);
+  BOOST_CHECK_THROW(run(mozhegova::removeLines, "t 3 2", texts), std::runtime_error);
+  BOOST_TEST(texts["t"].str() == "a\nb\nc");
+}
+
+BOOST_AUTO_TEST_CASE(insert_and_move_reject_bad_range)
+{
+  mozhegova::Texts texts;
+  texts["t"] = makeText("a\nb");
+  texts["u"] = makeText("x\ny\nz");
+  BOOST_CHECK_THROW(run(mozhegova::insertText, "t 0 u 1 2", texts), std::runtime_error);
+  BOOST_CHECK_THROW(run(mozhegova::insertText, "t 1 u 0 2", texts), std::runtime_error);
+  BOOST_CHECK_THROW(run(mozhegova::insertText, "t 1 u 3 2", texts), std::runtime_error);
+  BOOST_CHECK_THROW(run(mozhegova::moveText, "t 0 u 1 2", texts), std::runtime_error);
+  BOOST_CHECK_THROW(run(mozhegova::moveText, "t 1 u 0 2", texts), std::runtime_error);
+  BOOST_CHECK_THROW(run(mozhegova::moveText, "t 1 u 3 2", texts), std::runtime_error);
+  BOOST_TEST(texts["t"].str() == "a\nb");
+  BOOST_TEST(texts["u"].str() == "x\ny\nz");
+}
+
+BOOST_AUTO_TEST_CASE(insert_and_move_lines)
+{
+  mozhegova::Texts texts;
+  texts["t"] = makeText("a\nb");
+  texts["u"] = makeText("x\ny\nz");
+  run(mozhegova::insertText, "t 2 u 1 3", texts);
+  BOOST_TEST(texts["t"].str() == "a\nx\ny\nb");
+  BOOST_TEST(refs(texts["t"], "b") == "(4,1)");
+  run(mozhegova::moveText, "t 1 u 2 4", texts);
+  BOOST_TEST(texts["t"].str() == "y\nz\na\nx\ny\nb");
+  BOOST_TEST(refs(texts["t"], "y") == "(1,1)(5,1)");
+  BOOST_TEST(texts["u"].str() == "x");
+}
+
+BOOST_AUTO_TEST_CASE(replace_word_merges_into_existing)
+{
+  mozhegova::Texts texts;
+  texts["t"] = makeText("a b\nb a\nc");
+  run(mozhegova::replaceWord, "t a b", texts);
+  const mozhegova::Text & text = texts["t"];
+  BOOST_TEST(text.str() == "b b\nb b\nc");
+  BOOST_TEST(refs(text, "a").empty());
+  BOOST_TEST(refs(text, "b") == "(1,1)(1,2)(2,1)(2,2)");
+  BOOST_TEST(text.wordCount() == 5);
+  BOOST_CHECK_THROW(run(mozhegova::replaceWord, "t a c", texts), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(split_into_source_name)
+{
+  mozhegova::Texts texts;
+  texts["t"] = makeText("a\nb\nc");
+  run(mozhegova::splitTexts, "t 2 t u", texts);
+  BOOST_TEST(texts.size() == 2);
+  BOOST_TEST(texts["t"].str() == "a");
+  BOOST_TEST(texts["u"].str() == "b\nc");
+}
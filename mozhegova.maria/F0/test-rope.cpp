@@ -0,0 +1,120 @@
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "rope.hpp"
+
+namespace
+{
+  using Rope = mozhegova::Rope< int >;
+
+  std::vector< size_t > toVector(const mozhegova::DynamicArray< size_t > & arr)
+  {
+    std::vector< size_t > result;
+    for (size_t i = 0; i < arr.size(); ++i)
+    {
+      result.push_back(arr[i]);
+    }
+    return result;
+  }
+
+  void checkRope(const Rope & rope, const std::vector< size_t > & model)
+  {
+    BOOST_TEST(rope.size() == model.size());
+    BOOST_TEST(rope.empty() == model.empty());
+    BOOST_TEST(toVector(rope.ids(0, rope.size())) == model);
+    std::vector< size_t > walked;
+    rope.forEach([& walked](size_t id)
+    {
+      walked.push_back(id);
+    });
+    BOOST_TEST(walked == model);
+    for (size_t i = 0; i < model.size(); ++i)
+    {
+      BOOST_TEST(rope.idAt(i) == model[i]);
+      BOOST_TEST(rope.indexOf(model[i]) == i);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(rope_insert_erase_reverse)
+{
+  Rope rope;
+  mozhegova::DynamicArray< size_t > added;
+  for (size_t i = 0; i < 5; ++i)
+  {
+    added.push_back(rope.create());
+  }
+  rope.insert(0, added);
+  std::vector< size_t > model = toVector(added);
+  checkRope(rope, model);
+
+  rope.reverse();
+  std::reverse(model.begin(), model.end());
+  checkRope(rope, model);
+
+  mozhegova::DynamicArray< size_t > erased = rope.erase(1, 3);
+  BOOST_TEST(toVector(erased) == std::vector< size_t >(model.begin() + 1, model.begin() + 3));
+  model.erase(model.begin() + 1, model.begin() + 3);
+  checkRope(rope, model);
+
+  for (size_t i = 0; i < erased.size(); ++i)
+  {
+    rope.release(erased[i]);
+  }
+  added = mozhegova::DynamicArray< size_t >();
+  added.push_back(rope.create());
+  added.push_back(rope.create());
+  rope.insert(1, added);
+  model.insert(model.begin() + 1, added[0]);
+  model.insert(model.begin() + 2, added[1]);
+  checkRope(rope, model);
+  BOOST_TEST(toVector(rope.ids(1, 4)) == std::vector< size_t >(model.begin() + 1, model.begin() + 4));
+}
+
+BOOST_AUTO_TEST_CASE(rope_matches_vector_model)
+{
+  std::minstd_rand gen(7);
+  Rope rope;
+  std::vector< size_t > model;
+  for (size_t step = 0; step < 400; ++step)
+  {
+    size_t op = gen() % 4;
+    if (op == 0 || model.empty())
+    {
+      size_t index = gen() % (model.size() + 1);
+      mozhegova::DynamicArray< size_t > added;
+      for (size_t count = gen() % 4 + 1; count > 0; --count)
+      {
+        added.push_back(rope.create());
+      }
+      rope.insert(index, added);
+      std::vector< size_t > run = toVector(added);
+      model.insert(model.begin() + index, run.begin(), run.end());
+    }
+    else if (op == 1)
+    {
+      size_t begin = gen() % model.size();
+      size_t end = begin + gen() % (model.size() - begin + 1);
+      mozhegova::DynamicArray< size_t > erased = rope.erase(begin, end);
+      BOOST_TEST(toVector(erased) == std::vector< size_t >(model.begin() + begin, model.begin() + end));
+      model.erase(model.begin() + begin, model.begin() + end);
+      for (size_t i = 0; i < erased.size(); ++i)
+      {
+        rope.release(erased[i]);
+      }
+    }
+    else if (op == 2)
+    {
+      rope.reverse();
+      std::reverse(model.begin(), model.end());
+    }
+    else
+    {
+      size_t begin = gen() % model.size();
+      size_t end = begin + gen() % (model.size() - begin + 1);
+      BOOST_TEST(toVector(rope.ids(begin, end)) == std::vector< size_t >(model.begin() + begin, model.begin() + end));
+    }
+    checkRope(rope, model);
+  }
+}
@@ -0,0 +1,116 @@
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "text.hpp"
+
+namespace
+{
+  mozhegova::Text makeText(const std::string & str)
+  {
+    mozhegova::Text text;
+    std::istringstream in(str);
+    std::string line;
+    for (size_t lineNum = 1; std::getline(in, line); ++lineNum)
+    {
+      std::istringstream words(line);
+      std::string word;
+      for (size_t num = 1; words >> word; ++num)
+      {
+        text.addWord(word, lineNum, num);
+      }
+    }
+    return text;
+  }
+
+  std::vector< mozhegova::WordPos > refs(const mozhegova::Text & text, const std::string & word)
+  {
+    std::vector< mozhegova::WordPos > result;
+    auto it = text.dictionary().find(word);
+    if (it != text.dictionary().cend())
+    {
+      mozhegova::Xrefs xrefs = text.xrefs(it->second);
+      for (size_t i = 0; i < xrefs.size(); ++i)
+      {
+        result.push_back(xrefs[i]);
+      }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+  void checkXrefs(const mozhegova::Text & text)
+  {
+    std::istringstream in(text.str());
+    std::vector< std::pair< std::string, mozhegova::WordPos > > expected;
+    std::string line;
+    for (size_t lineNum = 1; std::getline(in, line); ++lineNum)
+    {
+      std::istringstream words(line);
+      std::string word;
+      for (size_t num = 1; words >> word; ++num)
+      {
+        expected.push_back({word, {lineNum, num}});
+      }
+    }
+    BOOST_TEST(text.wordCount() == expected.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+      std::vector< mozhegova::WordPos > wordRefs = refs(text, expected[i].first);
+      BOOST_TEST((std::find(wordRefs.begin(), wordRefs.end(), expected[i].second) != wordRefs.end()));
+    }
+    size_t total = 0;
+    for (auto it = text.dictionary().cbegin(); it != text.dictionary().cend(); ++it)
+    {
+      total += text.xrefs(it->second).size();
+    }
+    BOOST_TEST(total == expected.size());
+  }
+
+  using Refs = std::vector< mozhegova::WordPos >;
+}
+
+BOOST_AUTO_TEST_CASE(xrefs_after_remove_lines)
+{
+  mozhegova::Text text = makeText("a b c\nb d\na d e\nc a");
+  text.removeLines(2, 4);
+  BOOST_TEST(text.str() == "a b c\nc a");
+  BOOST_TEST((refs(text, "a") == Refs{{1, 1}, {2, 2}}));
+  BOOST_TEST((refs(text, "c") == Refs{{1, 3}, {2, 1}}));
+  BOOST_TEST(refs(text, "d").empty());
+  BOOST_TEST((text.dictionary().find("e") == text.dictionary().cend()));
+  checkXrefs(text);
+}
+
+BOOST_AUTO_TEST_CASE(xrefs_after_invert_lines)
+{
+  mozhegova::Text text = makeText("a b\nc\nb a c");
+  text.invertLines();
+  BOOST_TEST(text.str() == "b a c\nc\na b");
+  BOOST_TEST((refs(text, "a") == Refs{{1, 2}, {3, 1}}));
+  BOOST_TEST((refs(text, "c") == Refs{{1, 3}, {2, 1}}));
+  checkXrefs(text);
+  text.removeLines(1, 2);
+  BOOST_TEST((refs(text, "a") == Refs{{2, 1}}));
+  checkXrefs(text);
+  text.invertLines();
+  BOOST_TEST(text.str() == "a b\nc");
+  checkXrefs(text);
+}
+
+BOOST_AUTO_TEST_CASE(xrefs_after_replace_word_merge)
+{
+  mozhegova::Text text = makeText("a b a\nc a\nb");
+  BOOST_TEST(text.replaceWord("a", "b"));
+  BOOST_TEST(text.str() == "b b b\nc b\nb");
+  BOOST_TEST(refs(text, "a").empty());
+  BOOST_TEST((refs(text, "b") == Refs{{1, 1}, {1, 2}, {1, 3}, {2, 2}, {3, 1}}));
+  checkXrefs(text);
+  text.removeLines(1, 2);
+  BOOST_TEST((refs(text, "b") == Refs{{1, 2}, {2, 1}}));
+  checkXrefs(text);
+  BOOST_TEST(text.replaceWord("b", "d"));
+  BOOST_TEST((refs(text, "d") == Refs{{1, 2}, {2, 1}}));
+  checkXrefs(text);
+}
@@ -0,0 +1,377 @@
+#include "text.hpp"
+#include <algorithm>
+#include <memory>
+
+namespace
+{
+  constexpr size_t removedLine = static_cast< size_t >(-1);
+
+  template< typename T >
+  void reverseArray(mozhegova::DynamicArray< T > & arr)
+  {
+    if (!arr.empty())
+    {
+      T * first = std::addressof(arr[0]);
+      std::reverse(first, first + arr.size());
+    }
+  }
+}
+
+namespace mozhegova
+{
+  Text::Text():
+    ids_(),
+    words_(),
+    refs_(),
+    liveRefs_(),
+    lines_(),
+    wordCount_(0)
+  {}
+
+  void Text::addWord(const std::string & word, size_t line, size_t num)
+  {
+    size_t id = intern(word);
+    pushWord(lineId(line), num, id);
+  }
+
+  const Text::Dictionary & Text::dictionary() const noexcept
+  {
+    return ids_;
+  }
+
+  Xrefs Text::xrefs(size_t id) const
+  {
+    Xrefs result;
+    const Refs & refs = refs_[id];
+    for (size_t i = 0; i < refs.size(); ++i)
+    {
+      if (refs[i].first != removedLine)
+      {
+        result.push_back({lines_.indexOf(refs[i].first) + 1, refs[i].second});
+      }
+    }
+    return result;
+  }
+
+  size_t Text::wordCount() const noexcept
+  {
+    return wordCount_;
+  }
+
+  size_t Text::lineCount() const noexcept
+  {
+    return lines_.size();
+  }
+
+  size_t Text::maxWordNum() const
+  {
+    size_t maxNum = 0;
+    lines_.forEach([this, & maxNum](size_t id)
+    {
+      const Line & line = lines_.value(id);
+      if (!line.empty() && maxNum < line[line.size() - 1].num)
+      {
+        maxNum = line[line.size() - 1].num;
+      }
+    });
+    return maxNum;
+  }
+
+  std::string Text::str() const
+  {
+    std::string result;
+    lines_.forEach([this, & result](size_t id)
+    {
+      const Line & line = lines_.value(id);
+      if (line.empty())
+      {
+        return;
+      }
+      if (!result.empty())
+      {
+        result += '\n';
+      }
+      for (size_t i = 0; i < line.size(); ++i)
+      {
+        if (i != 0)
+        {
+          result += ' ';
+        }
+        result += words_[line[i].word];
+      }
+    });
+    return result;
+  }
+
+  Text Text::extract(size_t begin, size_t end) const
+  {
+    Text result;
+    size_t first = std::max< size_t >(begin, 1);
+    size_t last = std::min(end, lines_.size() + 1);
+    if (first >= last)
+    {
+      return result;
+    }
+    DynamicArray< size_t > src = lines_.ids(first - 1, last - 1);
+    for (size_t i = 0; i < src.size(); ++i)
+    {
+      const Line & line = lines_.value(src[i]);
+      if (line.empty())
+      {
+        continue;
+      }
+      size_t id = result.lineId(first + i);
+      for (size_t j = 0; j < line.size(); ++j)
+      {
+        result.pushWord(id, line[j].num, result.intern(words_[line[j].word]));
+      }
+    }
+    return result;
+  }
+
+  void Text::insertLines(size_t num, const Text & other, size_t begin, size_t end)
+  {
+    DynamicArray< Line > copied;
+    size_t last = std::min(end, other.lines_.size() + 1);
+    if (begin < last)
+    {
+      DynamicArray< size_t > src = other.lines_.ids(begin - 1, last - 1);
+      for (size_t i = 0; i < src.size(); ++i)
+      {
+        copied.push_back(other.lines_.value(src[i]));
+      }
+    }
+    if (lines_.size() + 1 < num)
+    {
+      lineId(num - 1);
+    }
+    DynamicArray< size_t > added;
+    for (size_t i = begin; i < end; ++i)
+    {
+      added.push_back(lines_.create());
+    }
+    for (size_t i = 0; i < copied.size(); ++i)
+    {
+      for (size_t j = 0; j < copied[i].size(); ++j)
+      {
+        pushWord(added[i], copied[i][j].num, intern(other.words_[copied[i][j].word]));
+      }
+    }
+    lines_.insert(num - 1, added);
+    trimLines();
+  }
+
+  void Text::removeLines(size_t begin, size_t end)
+  {
+    size_t first = std::max< size_t >(begin, 1);
+    size_t last = std::min(end, lines_.size() + 1);
+    if (first >= last)
+    {
+      return;
+    }
+    DynamicArray< size_t > removed = lines_.erase(first - 1, last - 1);
+    for (size_t i = 0; i < removed.size(); ++i)
+    {
+      const Line & line = lines_.value(removed[i]);
+      for (size_t j = 0; j < line.size(); ++j)
+      {
+        LineWord entry = line[j];
+        dropWord(entry);
+      }
+      lines_.release(removed[i]);
+    }
+    trimLines();
+  }
+
+  void Text::appendSide(const Text & other)
+  {
+    size_t shift = std::max< size_t >(maxWordNum(), 1);
+    DynamicArray< size_t > src = other.lines_.ids(0, other.lines_.size());
+    for (size_t i = 0; i < src.size(); ++i)
+    {
+      const Line & line = other.lines_.value(src[i]);
+      if (line.empty())
+      {
+        continue;
+      }
+      size_t id = lineId(i + 1);
+      for (size_t j = 0; j < line.size(); ++j)
+      {
+        pushWord(id, line[j].num + shift, intern(other.words_[line[j].word]));
+      }
+    }
+  }
+
+  void Text::invertLines()
+  {
+    lines_.reverse();
+    trimLines();
+  }
+
+  void Text::invertWords()
+  {
+    size_t maxNum = std::max< size_t >(maxWordNum(), 1);
+    for (size_t id = 0; id < refs_.size(); ++id)
+    {
+      Refs & refs = refs_[id];
+      for (size_t i = 0; i < refs.size(); ++i)
+      {
+        refs[i].second = maxNum - refs[i].second + 1;
+      }
+    }
+    DynamicArray< size_t > all = lines_.ids(0, lines_.size());
+    for (size_t i = 0; i < all.size(); ++i)
+    {
+      Line & line = lines_.value(all[i]);
+      reverseArray(line);
+      for (size_t j = 0; j < line.size(); ++j)
+      {
+        line[j].num = maxNum - line[j].num + 1;
+      }
+    }
+  }
+
+  bool Text::replaceWord(const std::string & oldWord, const std::string & newWord)
+  {
+    auto oldIt = ids_.find(oldWord);
+    if (oldIt == ids_.end())
+    {
+      return false;
+    }
+    if (oldWord == newWord)
+    {
+      return true;
+    }
+    size_t id = oldIt->second;
+    auto newIt = ids_.find(newWord);
+    if (newIt == ids_.end())
+    {
+      ids_[newWord] = id;
+      ids_.erase(oldWord);
+      words_[id] = newWord;
+      return true;
+    }
+    size_t newId = newIt->second;
+    const Refs & refs = refs_[id];
+    for (size_t i = 0; i < refs.size(); ++i)
+    {
+      if (refs[i].first == removedLine)
+      {
+        continue;
+      }
+      LineWord & entry = findEntry(refs[i].first, refs[i].second, id, i);
+      entry.word = newId;
+      entry.ref = refs_[newId].size();
+      refs_[newId].push_back(refs[i]);
+      ++liveRefs_[newId];
+    }
+    refs_[id] = Refs();
+    liveRefs_[id] = 0;
+    ids_.erase(oldWord);
+    return true;
+  }
+
+  size_t Text::intern(const std::string & word)
+  {
+    auto it = ids_.find(word);
+    if (it != ids_.end())
+    {
+      return it->second;
+    }
+    size_t id = words_.size();
+    words_.push_back(word);
+    refs_.push_back(Refs());
+    liveRefs_.push_back(0);
+    ids_[word] = id;
+    return id;
+  }
+
+  size_t Text::lineId(size_t line)
+  {
+    if (lines_.size() < line)
+    {
+      DynamicArray< size_t > added;
+      for (size_t i = lines_.size(); i < line; ++i)
+      {
+        added.push_back(lines_.create());
+      }
+      lines_.insert(lines_.size(), added);
+    }
+    return lines_.idAt(line - 1);
+  }
+
+  void Text::pushWord(size_t lineNode, size_t num, size_t word)
+  {
+    Refs & refs = refs_[word];
+    size_t ref = refs.size();
+    refs.push_back({lineNode, num});
+    ++liveRefs_[word];
+    Line & line = lines_.value(lineNode);
+    line.push_back({num, word, ref});
+    for (size_t i = line.size() - 1; i > 0 && line[i - 1].num > num; --i)
+    {
+      std::swap(line[i - 1], line[i]);
+    }
+    ++wordCount_;
+  }
+
+  void Text::dropWord(const LineWord & entry)
+  {
+    refs_[entry.word][entry.ref].first = removedLine;
+    --wordCount_;
+    if (--liveRefs_[entry.word] == 0)
+    {
+      ids_.erase(words_[entry.word]);
+      refs_[entry.word] = Refs();
+    }
+    else if (refs_[entry.word].size() > 2 * liveRefs_[entry.word])
+    {
+      compactRefs(entry.word);
+    }
+  }
+
+  Text::LineWord & Text::findEntry(size_t lineNode, size_t num, size_t word, size_t ref)
+  {
+    Line & line = lines_.value(lineNode);
+    LineWord * first = std::addressof(line[0]);
+    LineWord * entry = std::lower_bound(first, first + line.size(), num,
+      [](const LineWord & lhs, size_t rhs)
+      {
+        return lhs.num < rhs;
+      });
+    while (entry->word != word || entry->ref != ref)
+    {
+      ++entry;
+    }
+    return *entry;
+  }
+
+  void Text::compactRefs(size_t word)
+  {
+    Refs & refs = refs_[word];
+    Refs kept;
+    for (size_t i = 0; i < refs.size(); ++i)
+    {
+      if (refs[i].first != removedLine)
+      {
+        findEntry(refs[i].first, refs[i].second, word, i).ref = kept.size();
+        kept.push_back(refs[i]);
+      }
+    }
+    refs.swap(kept);
+  }
+
+  void Text::trimLines()
+  {
+    while (!lines_.empty())
+    {
+      size_t last = lines_.idAt(lines_.size() - 1);
+      if (!lines_.value(last).empty())
+      {
+        break;
+      }
+      lines_.erase(lines_.size() - 1, lines_.size());
+      lines_.release(last);
+    }
+  }
+}
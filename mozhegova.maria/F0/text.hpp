@@ -0,0 +1,64 @@
+#ifndef TEXT_HPP
+#define TEXT_HPP
+
+#include <string>
+#include <hashTable.hpp>
+#include <dynamicArray.hpp>
+#include "rope.hpp"
+
+namespace mozhegova
+{
+  using WordPos = std::pair< size_t, size_t >;
+  using Xrefs = DynamicArray< WordPos >;
+
+  class Text
+  {
+  public:
+    using Dictionary = HashTable< std::string, size_t >;
+
+    Text();
+
+    void addWord(const std::string & word, size_t line, size_t num);
+
+    const Dictionary & dictionary() const noexcept;
+    Xrefs xrefs(size_t id) const;
+    size_t wordCount() const noexcept;
+    size_t lineCount() const noexcept;
+    size_t maxWordNum() const;
+    std::string str() const;
+
+    Text extract(size_t begin, size_t end) const;
+    void insertLines(size_t num, const Text & other, size_t begin, size_t end);
+    void removeLines(size_t begin, size_t end);
+    void appendSide(const Text & other);
+    void invertLines();
+    void invertWords();
+    bool replaceWord(const std::string & oldWord, const std::string & newWord);
+  private:
+    struct LineWord
+    {
+      size_t num;
+      size_t word;
+      size_t ref;
+    };
+    using Line = DynamicArray< LineWord >;
+    using Refs = DynamicArray< WordPos >;
+
+    Dictionary ids_;
+    DynamicArray< std::string > words_;
+    DynamicArray< Refs > refs_;
+    DynamicArray< size_t > liveRefs_;
+    Rope< Line > lines_;
+    size_t wordCount_;
+
+    size_t intern(const std::string & word);
+    size_t lineId(size_t line);
+    void pushWord(size_t lineNode, size_t num, size_t word);
+    void dropWord(const LineWord & entry);
+    LineWord & findEntry(size_t lineNode, size_t num, size_t word, size_t ref);
+    void compactRefs(size_t word);
+    void trimLines();
+  };
+}
+
+#endif
@@ -0,0 +1,23 @@
+#include <boost/test/unit_test.hpp>
+#include <dynamicArray.hpp>
+
+BOOST_AUTO_TEST_CASE(dynamic_array_size_constructor)
+{
+  mozhegova::DynamicArray< size_t > arr(3);
+  BOOST_TEST(arr.size() == 3);
+  for (size_t i = 0; i < arr.size(); ++i)
+  {
+    arr[i] = i;
+  }
+  for (size_t i = 3; i < 30; ++i)
+  {
+    arr.push_back(i);
+  }
+  BOOST_TEST(arr.size() == 30);
+  for (size_t i = 0; i < arr.size(); ++i)
+  {
+    BOOST_TEST(arr[i] == i);
+  }
+  arr.pop_back();
+  BOOST_TEST(arr.size() == 29);
+}
@@ -72,3 +72,37 @@ BOOST_AUTO_TEST_CASE(Swap)
   BOOST_TEST(table1.find(2)->second == "two");
   BOOST_TEST(table2.find(1)->second == "one");
 }
+
+BOOST_AUTO_TEST_CASE(IterateAfterErase)
+{
+  mozhegova::HashTable< int, int > table;
+  for (int i = 0; i < 1000; ++i)
+  {
+    table[i] = i * 2;
+  }
+  for (int i = 0; i < 1000; i += 3)
+  {
+    table.erase(i);
+  }
+  mozhegova::HashTable< int, int > copy(table);
+  size_t count = 0;
+  long long sum = 0;
+  for (auto it = copy.cbegin(); it != copy.cend(); ++it)
+  {
+    BOOST_TEST(it->second == it->first * 2);
+    BOOST_TEST(it->first % 3 != 0);
+    ++count;
+    sum += it->first;
+  }
+  BOOST_TEST(count == table.size());
+  BOOST_TEST(sum == 499500 - 166833);
+  size_t back = 0;
+  for (auto it = copy.end(); it != copy.begin(); --it)
+  {
+    ++back;
+  }
+  BOOST_TEST(back == copy.size());
+  copy.clear();
+  BOOST_TEST(copy.empty());
+  BOOST_TEST(table.find(1)->second == 2);
+}
@@ -22,6 +22,7 @@ namespace mozhegova
     size_t size() const noexcept;
     void swap(DynamicArray & other) noexcept;
     void push_back(const T & value);
+    void pop_back();
   private:
     size_t capacity_;
     size_t size_;
@@ -39,7 +40,7 @@ namespace mozhegova
   DynamicArray< T >::DynamicArray(size_t size):
     capacity_(size + 10),
     size_(size),
-    data_(new T[size])
+    data_(new T[capacity_])
   {}
 
   template< typename T >
@@ -142,6 +143,12 @@ namespace mozhegova
     }
     data_[size_++] = value;
   }
+
+  template< typename T >
+  void DynamicArray< T >::pop_back()
+  {
+    data_[--size_] = T();
+  }
 }
 
 #endif
@@ -59,10 +59,7 @@ namespace mozhegova
   template< class Key, class Value, class Hash, class Equal >
   void HashConstIter< Key, Value, Hash, Equal >::skipEmpty()
   {
-    while (index_ < table_->table_.size() && (!table_->table_[index_].occupied || table_->table_[index_].deleted))
-    {
-      ++index_;
-    }
+    index_ = table_->slots_.next(index_);
   }
 
   template< class Key, class Value, class Hash, class Equal >
@@ -84,8 +81,7 @@ namespace mozhegova
   template< class Key, class Value, class Hash, class Equal >
   HashConstIter< Key, Value, Hash, Equal > & HashConstIter< Key, Value, Hash, Equal >::operator--()
   {
-    --index_;
-    skipEmpty();
+    index_ = table_->slots_.prev(index_);
     return *this;
   }
 
@@ -100,13 +96,13 @@ namespace mozhegova
   template< class Key, class Value, class Hash, class Equal >
   const std::pair< Key, Value > & HashConstIter< Key, Value, Hash, Equal >::operator*() const
   {
-    return table_->table_[index_].data;
+    return table_->slots_[index_];
   }
 
   template< class Key, class Value, class Hash, class Equal >
   const std::pair< Key, Value > * HashConstIter< Key, Value, Hash, Equal >::operator->() const
   {
-    return std::addressof(table_->table_[index_].data);
+    return std::addressof(table_->slots_[index_]);
   }
 
   template< class Key, class Value, class Hash, class Equal >
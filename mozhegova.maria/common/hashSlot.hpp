@@ -1,17 +1,262 @@
 #ifndef HASHSLOT_HPP
 #define HASHSLOT_HPP
 
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
 #include <utility>
 
 namespace mozhegova
 {
+  enum class SlotState: unsigned char
+  {
+    EMPTY = 0,
+    FULL = 1,
+    DELETED = 2
+  };
+
   template< typename Key, typename Value >
-  struct Slot
+  class Slots
   {
-    std::pair< Key, Value > data;
-    bool occupied = false;
-    bool deleted = false;
+  public:
+    using value_type = std::pair< Key, Value >;
+
+    explicit Slots(size_t capacity);
+    Slots(const Slots & other);
+    Slots(Slots && other) noexcept;
+    ~Slots();
+    Slots & operator=(const Slots & rhs);
+    Slots & operator=(Slots && rhs) noexcept;
+
+    size_t capacity() const noexcept;
+    SlotState state(size_t i) const noexcept;
+    unsigned char tag(size_t i) const noexcept;
+    value_type & operator[](size_t i) noexcept;
+    const value_type & operator[](size_t i) const noexcept;
+
+    template< typename... Args >
+    void construct(size_t i, unsigned char tag, Args &&... args);
+    void destroy(size_t i) noexcept;
+    void clear() noexcept;
+
+    size_t next(size_t i) const noexcept;
+    size_t prev(size_t i) const noexcept;
+
+    void swap(Slots & other) noexcept;
+  private:
+    static constexpr size_t perWord = 32;
+    static constexpr unsigned long long fullMask = 0x5555555555555555ULL;
+
+    size_t capacity_;
+    unsigned long long * states_;
+    unsigned char * tags_;
+    value_type * data_;
+
+    size_t words() const noexcept;
+    void setState(size_t i, SlotState state) noexcept;
+    void release() noexcept;
   };
+
+  template< typename Key, typename Value >
+  Slots< Key, Value >::Slots(size_t capacity):
+    capacity_(capacity),
+    states_(nullptr),
+    tags_(nullptr),
+    data_(nullptr)
+  {
+    try
+    {
+      states_ = new unsigned long long[words()]();
+      tags_ = new unsigned char[capacity_]();
+      data_ = static_cast< value_type * >(::operator new(sizeof(value_type) * capacity_));
+    }
+    catch (...)
+    {
+      delete[] states_;
+      delete[] tags_;
+      throw;
+    }
+  }
+
+  template< typename Key, typename Value >
+  Slots< Key, Value >::Slots(const Slots & other):
+    Slots(other.capacity_)
+  {
+    for (size_t i = other.next(0); i < capacity_; i = other.next(i + 1))
+    {
+      construct(i, other.tags_[i], other.data_[i]);
+    }
+    std::memcpy(states_, other.states_, words() * sizeof(unsigned long long));
+  }
+
+  template< typename Key, typename Value >
+  Slots< Key, Value >::Slots(Slots && other) noexcept:
+    capacity_(std::exchange(other.capacity_, 0)),
+    states_(std::exchange(other.states_, nullptr)),
+    tags_(std::exchange(other.tags_, nullptr)),
+    data_(std::exchange(other.data_, nullptr))
+  {}
+
+  template< typename Key, typename Value >
+  Slots< Key, Value >::~Slots()
+  {
+    clear();
+    release();
+  }
+
+  template< typename Key, typename Value >
+  Slots< Key, Value > & Slots< Key, Value >::operator=(const Slots & rhs)
+  {
+    if (this != std::addressof(rhs))
+    {
+      Slots temp(rhs);
+      swap(temp);
+    }
+    return *this;
+  }
+
+  template< typename Key, typename Value >
+  Slots< Key, Value > & Slots< Key, Value >::operator=(Slots && rhs) noexcept
+  {
+    if (this != std::addressof(rhs))
+    {
+      Slots temp(std::move(rhs));
+      swap(temp);
+    }
+    return *this;
+  }
+
+  template< typename Key, typename Value >
+  size_t Slots< Key, Value >::capacity() const noexcept
+  {
+    return capacity_;
+  }
+
+  template< typename Key, typename Value >
+  SlotState Slots< Key, Value >::state(size_t i) const noexcept
+  {
+    return static_cast< SlotState >((states_[i / perWord] >> (2 * (i % perWord))) & 3);
+  }
+
+  template< typename Key, typename Value >
+  unsigned char Slots< Key, Value >::tag(size_t i) const noexcept
+  {
+    return tags_[i];
+  }
+
+  template< typename Key, typename Value >
+  typename Slots< Key, Value >::value_type & Slots< Key, Value >::operator[](size_t i) noexcept
+  {
+    return data_[i];
+  }
+
+  template< typename Key, typename Value >
+  const typename Slots< Key, Value >::value_type & Slots< Key, Value >::operator[](size_t i) const noexcept
+  {
+    return data_[i];
+  }
+
+  template< typename Key, typename Value >
+  template< typename... Args >
+  void Slots< Key, Value >::construct(size_t i, unsigned char tag, Args &&... args)
+  {
+    new (data_ + i) value_type(std::forward< Args >(args)...);
+    tags_[i] = tag;
+    setState(i, SlotState::FULL);
+  }
+
+  template< typename Key, typename Value >
+  void Slots< Key, Value >::destroy(size_t i) noexcept
+  {
+    data_[i].~value_type();
+    setState(i, SlotState::DELETED);
+  }
+
+  template< typename Key, typename Value >
+  void Slots< Key, Value >::clear() noexcept
+  {
+    for (size_t i = next(0); i < capacity_; i = next(i + 1))
+    {
+      data_[i].~value_type();
+    }
+    for (size_t i = 0; i < words(); ++i)
+    {
+      states_[i] = 0;
+    }
+  }
+
+  template< typename Key, typename Value >
+  size_t Slots< Key, Value >::next(size_t i) const noexcept
+  {
+    if (i >= capacity_)
+    {
+      return capacity_;
+    }
+    size_t word = i / perWord;
+    unsigned long long bits = states_[word] & fullMask & (~0ULL << (2 * (i % perWord)));
+    while (bits == 0)
+    {
+      if (++word == words())
+      {
+        return capacity_;
+      }
+      bits = states_[word] & fullMask;
+    }
+    return word * perWord + __builtin_ctzll(bits) / 2;
+  }
+
+  template< typename Key, typename Value >
+  size_t Slots< Key, Value >::prev(size_t i) const noexcept
+  {
+    if (i == 0 || capacity_ == 0)
+    {
+      return capacity_;
+    }
+    size_t last = (i > capacity_ ? capacity_ : i) - 1;
+    size_t word = last / perWord;
+    unsigned long long bits = states_[word] & fullMask & (~0ULL >> (62 - 2 * (last % perWord)));
+    while (bits == 0)
+    {
+      if (word == 0)
+      {
+        return capacity_;
+      }
+      bits = states_[--word] & fullMask;
+    }
+    return word * perWord + (63 - __builtin_clzll(bits)) / 2;
+  }
+
+  template< typename Key, typename Value >
+  void Slots< Key, Value >::swap(Slots & other) noexcept
+  {
+    std::swap(capacity_, other.capacity_);
+    std::swap(states_, other.states_);
+    std::swap(tags_, other.tags_);
+    std::swap(data_, other.data_);
+  }
+
+  template< typename Key, typename Value >
+  size_t Slots< Key, Value >::words() const noexcept
+  {
+    return (capacity_ + perWord - 1) / perWord;
+  }
+
+  template< typename Key, typename Value >
+  void Slots< Key, Value >::setState(size_t i, SlotState state) noexcept
+  {
+    unsigned long long & word = states_[i / perWord];
+    size_t shift = 2 * (i % perWord);
+    word = (word & ~(3ULL << shift)) | (static_cast< unsigned long long >(state) << shift);
+  }
+
+  template< typename Key, typename Value >
+  void Slots< Key, Value >::release() noexcept
+  {
+    delete[] states_;
+    delete[] tags_;
+    ::operator delete(data_);
+  }
 }
 
 #endif
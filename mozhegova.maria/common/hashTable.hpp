@@ -2,10 +2,10 @@
 #define HASHTABLE_HPP
 
 #include <functional>
+#include <stdexcept>
 #include "hashSlot.hpp"
 #include "hashConstIter.hpp"
 #include "hashIter.hpp"
-#include "dynamicArray.hpp"
 
 namespace mozhegova
 {
@@ -63,20 +63,26 @@ namespace mozhegova
     void max_load_factor(float val);
     void rehash(size_t n);
   private:
-    DynamicArray< Slot< Key, Value > > table_;
+    static constexpr size_t minCapacity = 16;
+
+    Slots< Key, Value > slots_;
     size_t size_;
+    size_t deleted_;
     Hash hasher_;
     Equal equal_;
     float max_load_factor_ = 0.7;
 
+    unsigned long long hashOf(const Key & k) const;
+    static size_t homeOf(unsigned long long hash, size_t capacity) noexcept;
+    static unsigned char tagOf(unsigned long long hash) noexcept;
     size_t findIndex(const Key & k) const;
-    size_t findIndexIn(const Key & k, const DynamicArray< Slot< Key, Value > > & table) const;
   };
 
   template< class Key, class Value, class Hash, class Equal >
   HashTable< Key, Value, Hash, Equal >::HashTable():
-    table_(11),
-    size_(0)
+    slots_(minCapacity),
+    size_(0),
+    deleted_(0)
   {}
 
   template< class Key, class Value, class Hash, class Equal >
@@ -148,13 +154,13 @@ namespace mozhegova
   template< class Key, class Value, class Hash, class Equal >
   HashIter< Key, Value, Hash, Equal > HashTable< Key, Value, Hash, Equal >::end()
   {
-    return Iter{this, table_.size()};
+    return Iter{this, slots_.capacity()};
   }
 
   template< class Key, class Value, class Hash, class Equal >
   HashConstIter< Key, Value, Hash, Equal > HashTable< Key, Value, Hash, Equal >::cend() const
   {
-    return cIter{this, table_.size()};
+    return cIter{this, slots_.capacity()};
   }
 
   template< class Key, class Value, class Hash, class Equal >
@@ -172,39 +178,56 @@ namespace mozhegova
   template< class Key, class Value, class Hash, class Equal >
   void HashTable< Key, Value, Hash, Equal >::clear()
   {
-    erase(cbegin(), cend());
+    slots_.clear();
+    size_ = 0;
+    deleted_ = 0;
   }
 
   template< class Key, class Value, class Hash, class Equal >
   void HashTable< Key, Value, Hash, Equal >::swap(HashTable< Key, Value, Hash, Equal > & rhs) noexcept
   {
-    std::swap(table_, rhs.table_);
+    slots_.swap(rhs.slots_);
     std::swap(size_, rhs.size_);
+    std::swap(deleted_, rhs.deleted_);
     std::swap(hasher_, rhs.hasher_);
     std::swap(equal_, rhs.equal_);
     std::swap(max_load_factor_, rhs.max_load_factor_);
   }
 
+  template< class Key, class Value, class Hash, class Equal >
+  unsigned long long HashTable< Key, Value, Hash, Equal >::hashOf(const Key & k) const
+  {
+    return static_cast< unsigned long long >(hasher_(k)) * 11400714819323198485ULL;
+  }
+
+  template< class Key, class Value, class Hash, class Equal >
+  size_t HashTable< Key, Value, Hash, Equal >::homeOf(unsigned long long hash, size_t capacity) noexcept
+  {
+    return (hash >> 32) & (capacity - 1);
+  }
+
+  template< class Key, class Value, class Hash, class Equal >
+  unsigned char HashTable< Key, Value, Hash, Equal >::tagOf(unsigned long long hash) noexcept
+  {
+    return static_cast< unsigned char >(hash >> 56);
+  }
+
   template< class Key, class Value, class Hash, class Equal >
   size_t HashTable< Key, Value, Hash, Equal >::findIndex(const Key & k) const
   {
-    size_t homeSlot = hasher_(k) % table_.size();
-    size_t currSlot = homeSlot;
-    size_t i = 1;
-    while (table_[currSlot].occupied || table_[currSlot].deleted)
+    unsigned long long hash = hashOf(k);
+    unsigned char tag = tagOf(hash);
+    size_t mask = slots_.capacity() - 1;
+    size_t currSlot = homeOf(hash, slots_.capacity());
+    for (size_t i = 1; slots_.state(currSlot) != SlotState::EMPTY && i <= slots_.capacity(); ++i)
     {
-      if (table_[currSlot].occupied && equal_(table_[currSlot].data.first, k))
+      if (slots_.state(currSlot) == SlotState::FULL && slots_.tag(currSlot) == tag && equal_(slots_[currSlot].first, k))
       {
         return currSlot;
       }
-      currSlot = (homeSlot + i * i) % table_.size();
-      ++i;
-      if (i >= table_.size())
-      {
-        break;
-      }
+      currSlot = (currSlot + i) & mask;
     }
-    return table_.size();
+    return slots_.capacity();
   }
 
   template< class Key, class Value, class Hash, class Equal >
@@ -222,11 +245,11 @@ namespace mozhegova
   template< class Key, class Value, class Hash, class Equal >
   float HashTable< Key, Value, Hash, Equal >::load_factor() const noexcept
   {
-    if (table_.size() == 0)
+    if (slots_.capacity() == 0)
     {
       return 0.0;
     }
-    return size_ / table_.size();
+    return static_cast< float >(size_) / slots_.capacity();
   }
 
   template< class Key, class Value, class Hash, class Equal >
@@ -245,43 +268,32 @@ namespace mozhegova
     max_load_factor_ = val;
     if (max_load_factor_ < load_factor())
     {
-      rehash(table_.size() * 2);
+      rehash(slots_.capacity());
     }
   }
 
-  template< class Key, class Value, class Hash, class Equal >
-  size_t HashTable< Key, Value, Hash, Equal >::findIndexIn(const Key & k, const DynamicArray< Slot< Key, Value > > & table) const
-  {
-    size_t homeSlot = hasher_(k) % table.size();
-    size_t currSlot = homeSlot;
-    size_t i = 1;
-    while (table[currSlot].occupied)
-    {
-      currSlot = (homeSlot + i * i) % table.size();
-      ++i;
-    }
-    return currSlot;
-  }
-
   template< class Key, class Value, class Hash, class Equal >
   void HashTable< Key, Value, Hash, Equal >::rehash(size_t n)
   {
-    if (n < table_.size())
+    size_t capacity = minCapacity;
+    while (capacity < n || capacity * max_load_factor_ < size_ + 1)
     {
-      return;
+      capacity *= 2;
     }
-    DynamicArray< Slot< Key, Value > > temp(n);
-    for (size_t i = 0; i < table_.size(); ++i)
+    Slots< Key, Value > temp(capacity);
+    size_t mask = capacity - 1;
+    for (size_t i = slots_.next(0); i < slots_.capacity(); i = slots_.next(i + 1))
     {
-      if (table_[i].occupied)
+      unsigned long long hash = hashOf(slots_[i].first);
+      size_t currSlot = homeOf(hash, capacity);
+      for (size_t j = 1; temp.state(currSlot) != SlotState::EMPTY; ++j)
       {
-        size_t newId = findIndexIn(table_[i].data.first, temp);
-        temp[newId].data = table_[i].data;
-        temp[newId].occupied = true;
-        temp[newId].deleted = false;
+        currSlot = (currSlot + j) & mask;
       }
+      temp.construct(currSlot, tagOf(hash), std::move_if_noexcept(slots_[i]));
     }
-    table_.swap(temp);
+    slots_.swap(temp);
+    deleted_ = 0;
   }
 
   template< class Key, class Value, class Hash, class Equal >
@@ -300,20 +312,18 @@ namespace mozhegova
   template< class Key, class Value, class Hash, class Equal >
   HashIter< Key, Value, Hash, Equal > HashTable< Key, Value, Hash, Equal >::erase(cIter cit) noexcept
   {
-    size_t currSlot = cit.index_;
-    table_[currSlot].occupied = false;
-    table_[currSlot].deleted = true;
+    slots_.destroy(cit.index_);
     --size_;
+    ++deleted_;
     return Iter{this, cit.index_ + 1};
   }
 
   template< class Key, class Value, class Hash, class Equal >
   HashIter< Key, Value, Hash, Equal > HashTable< Key, Value, Hash, Equal >::erase(Iter it) noexcept
   {
-    size_t currSlot = it.index_;
-    table_[currSlot].occupied = false;
-    table_[currSlot].deleted = true;
+    slots_.destroy(it.index_);
     --size_;
+    ++deleted_;
     return Iter{this, it.index_ + 1};
   }
 
@@ -354,35 +364,28 @@ namespace mozhegova
   template< class... Args >
   std::pair< HashIter< Key, Value, Hash, Equal >, bool > HashTable< Key, Value, Hash, Equal >::emplace(Args &&... args)
   {
-    if ((size_ + 1) / table_.size() > max_load_factor_)
+    std::pair< Key, Value > pair(std::forward< Args >(args)...);
+    size_t found = findIndex(pair.first);
+    if (found != slots_.capacity())
     {
-      rehash(table_.size() * 2);
+      return {Iter{this, found}, false};
     }
-    std::pair< Key, Value > pair(std::forward< Args >(args)...);
-    size_t homeSlot = hasher_(pair.first) % table_.size();
-    size_t currSlot = homeSlot;
-    size_t firstDeleted = table_.size();
-    size_t i = 1;
-    while (table_[currSlot].occupied || table_[currSlot].deleted)
+    if (size_ + deleted_ + 1 > slots_.capacity() * max_load_factor_)
     {
-      if (table_[currSlot].occupied && equal_(table_[currSlot].data.first, pair.first))
-      {
-        return {Iter{this, currSlot}, false};
-      }
-      if (table_[currSlot].deleted && firstDeleted == table_.size())
-      {
-        firstDeleted = currSlot;
-      }
-      currSlot = (homeSlot + i * i) % table_.size();
-      ++i;
+      rehash(size_ + 1 > slots_.capacity() * max_load_factor_ / 2 ? slots_.capacity() * 2 : slots_.capacity());
+    }
+    unsigned long long hash = hashOf(pair.first);
+    size_t mask = slots_.capacity() - 1;
+    size_t currSlot = homeOf(hash, slots_.capacity());
+    for (size_t i = 1; slots_.state(currSlot) == SlotState::FULL; ++i)
+    {
+      currSlot = (currSlot + i) & mask;
     }
-    if (firstDeleted != table_.size())
+    if (slots_.state(currSlot) == SlotState::DELETED)
     {
-      currSlot = firstDeleted;
+      --deleted_;
     }
-    table_[currSlot].data = std::move(pair);
-    table_[currSlot].occupied = true;
-    table_[currSlot].deleted = false;
+    slots_.construct(currSlot, tagOf(hash), std::move(pair));
     ++size_;
     return {Iter{this, currSlot}, true};
   }
@@ -394,9 +397,9 @@ namespace mozhegova
     std::pair< Key, Value > pair(std::forward< Args >(args)...);
     if (hint != cend())
     {
-      if (table_[hint.index_].occupied && key_equal_(table_[hint.index_].data.first, pair.first))
+      if (equal_(hint->first, pair.first))
       {
-        return hint;
+        return Iter{this, hint.index_};
       }
     }
     return emplace(std::move(pair)).first;
@@ -0,0 +1,105 @@
+#define BENCH_MAIN
+#include <harness.hpp>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include "calculator.hpp"
+
+namespace
+{
+  constexpr size_t input_lines = 200000;
+
+  const std::string& input()
+  {
+    static const std::string result = []()
+    {
+      std::string lines;
+      for (size_t i = 0; i < input_lines; i++)
+      {
+        lines += "(" + std::to_string(i) + " + 17) * 3 - (" + std::to_string(i % 97) + " % 5 + 2) / 2\n";
+      }
+      return lines;
+    }();
+    return result;
+  }
+
+  template< class Evaluator >
+  long long evaluateAll(Evaluator evaluator)
+  {
+    long long checksum = 0;
+    const char* begin = input().data();
+    const char* end = begin + input().size();
+    while (begin != end)
+    {
+      const char* lineEnd = static_cast< const char* >(std::memchr(begin, '\n', end - begin)) + 1;
+      long long value = 0;
+      evaluator(begin, lineEnd, value);
+      checksum += value;
+      begin = lineEnd;
+    }
+    return checksum;
+  }
+
+  void evaluateStream(bench::State& state, size_t jobs)
+  {
+    state.setItems(input_lines);
+    state.setBytes(input().size());
+    state.run([jobs]()
+    {
+      std::istringstream in(input());
+      rychkov::Stack< long long > results;
+      if (jobs == 0)
+      {
+        rychkov::evaluateSequential(in, results);
+      }
+      else
+      {
+        rychkov::evaluateParallel(in, results, jobs);
+      }
+      bench::doNotOptimize(results);
+    });
+  }
+}
+
+BENCH_CASE(line_variant)
+{
+  state.setItems(input_lines);
+  state.setBytes(input().size());
+  state.run([]()
+  {
+    bench::doNotOptimize(evaluateAll(rychkov::evaluateLineVariant));
+  });
+}
+BENCH_CASE(line_packed)
+{
+  state.setItems(input_lines);
+  state.setBytes(input().size());
+  state.run([]()
+  {
+    bench::doNotOptimize(evaluateAll([](const char* begin, const char* end, long long& value)
+    {
+      return rychkov::evaluateLine(begin, end, value);
+    }));
+  });
+}
+BENCH_CASE(line_packed_reused)
+{
+  state.setItems(input_lines);
+  state.setBytes(input().size());
+  state.run([]()
+  {
+    rychkov::PackedExpression expression;
+    bench::doNotOptimize(evaluateAll([&expression](const char* begin, const char* end, long long& value)
+    {
+      return rychkov::evaluateLine(expression, begin, end, value);
+    }));
+  });
+}
+BENCH_CASE(stream_sequential)
+{
+  evaluateStream(state, 0);
+}
+BENCH_CASE(stream_parallel_4)
+{
+  evaluateStream(state, 4);
+}
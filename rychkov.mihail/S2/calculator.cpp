@@ -0,0 +1,424 @@
+#include "calculator.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <queue.hpp>
+#include <variant.hpp>
+#include <safe_math.hpp>
+
+namespace rychkov
+{
+  enum Operator: char
+  {
+    plus = '+',
+    minus = '-',
+    multiplies = '*',
+    divides = '/',
+    modulus = '%',
+    openinigParenthesis = '(',
+    closingParenthesis = ')',
+  };
+  namespace details
+  {
+    int getPriority(Operator oper)
+    {
+      switch (oper)
+      {
+      case openinigParenthesis:
+      case closingParenthesis:
+        return 1;
+      case modulus:
+        return 2;
+      case plus:
+      case minus:
+        return 3;
+      case multiplies:
+      case divides:
+        return 4;
+      default:
+        return -1;
+      }
+    }
+    bool lessPriority(Operator lhs, Operator rhs)
+    {
+      return getPriority(lhs) < getPriority(rhs);
+    }
+    bool equalPriority(Operator lhs, Operator rhs)
+    {
+      return getPriority(lhs) == getPriority(rhs);
+    }
+    bool isOperator(char c)
+    {
+      return getPriority(static_cast< Operator >(c)) != -1;
+    }
+    Operator popLowPrioritized(Queue< Variant< long long, Operator > >& expression,
+          Stack< Operator >& operators, Operator referenceOperator = static_cast< Operator >('\0'))
+    {
+      while (!operators.empty() && lessPriority(referenceOperator, operators.top()))
+      {
+        expression.push(operators.top());
+        operators.pop();
+      }
+      Operator result = static_cast< Operator >('\0');
+      if (!operators.empty() && equalPriority(operators.top(), referenceOperator))
+      {
+        result = operators.top();
+        if (operators.top() != '(')
+        {
+          expression.push(operators.top());
+        }
+        operators.pop();
+      }
+      return result;
+    }
+
+    struct Chunk
+    {
+      const char* begin = nullptr;
+      const char* end = nullptr;
+      Queue< long long > values;
+      std::exception_ptr error;
+      bool done = false;
+    };
+    struct Block
+    {
+      std::string data;
+      std::unique_ptr< Chunk[] > chunks;
+      size_t capacity = 0;
+      size_t size = 0;
+    };
+    const char* findLineEnd(const char* begin, const char* end)
+    {
+      const void* found = std::memchr(begin, '\n', end - begin);
+      return found ? static_cast< const char* >(found) + 1 : end;
+    }
+    const char* findLastLineEnd(const char* begin, const char* end)
+    {
+      while ((end != begin) && (end[-1] != '\n'))
+      {
+        end--;
+      }
+      return end;
+    }
+    void evaluateChunk(Chunk& chunk)
+    {
+      try
+      {
+        PackedExpression expression;
+        for (const char* begin = chunk.begin; begin != chunk.end;)
+        {
+          const char* lineEnd = findLineEnd(begin, chunk.end);
+          long long value = 0;
+          if (evaluateLine(expression, begin, lineEnd, value))
+          {
+            chunk.values.push(value);
+          }
+          begin = lineEnd;
+        }
+      }
+      catch (...)
+      {
+        chunk.error = std::current_exception();
+      }
+    }
+
+    class ChunkWorkers
+    {
+    public:
+      explicit ChunkWorkers(size_t count):
+        stopped_(false),
+        started_(0),
+        threads_(new std::thread[count])
+      {
+        try
+        {
+          for (; started_ < count; started_++)
+          {
+            threads_[started_] = std::thread(&ChunkWorkers::run, this);
+          }
+        }
+        catch (...)
+        {
+          stop();
+          throw;
+        }
+      }
+      ChunkWorkers(const ChunkWorkers&) = delete;
+      ~ChunkWorkers()
+      {
+        stop();
+      }
+      ChunkWorkers& operator=(const ChunkWorkers&) = delete;
+
+      void submit(Block& block)
+      {
+        {
+          std::lock_guard< std::mutex > lock(mutex_);
+          for (size_t i = 0; i < block.size; i++)
+          {
+            pending_.push(&block.chunks[i]);
+          }
+        }
+        queued_.notify_all();
+      }
+      void wait(const Chunk& chunk)
+      {
+        std::unique_lock< std::mutex > lock(mutex_);
+        while (!chunk.done)
+        {
+          finished_.wait(lock);
+        }
+      }
+    private:
+      std::mutex mutex_;
+      std::condition_variable queued_;
+      std::condition_variable finished_;
+      Queue< Chunk* > pending_;
+      bool stopped_;
+      size_t started_;
+      std::unique_ptr< std::thread[] > threads_;
+
+      void run()
+      {
+        std::unique_lock< std::mutex > lock(mutex_);
+        while (true)
+        {
+          while (!stopped_ && pending_.empty())
+          {
+            queued_.wait(lock);
+          }
+          if (stopped_)
+          {
+            return;
+          }
+          Chunk* chunk = pending_.front();
+          pending_.pop();
+          lock.unlock();
+          evaluateChunk(*chunk);
+          lock.lock();
+          chunk->done = true;
+          finished_.notify_all();
+        }
+      }
+      void stop() noexcept
+      {
+        {
+          std::lock_guard< std::mutex > lock(mutex_);
+          stopped_ = true;
+        }
+        queued_.notify_all();
+        for (size_t i = 0; i < started_; i++)
+        {
+          threads_[i].join();
+        }
+      }
+    };
+
+    const char* readBlock(std::istream& in, Block& block, const char* tail, const char* tailEnd, size_t blockSize)
+    {
+      size_t carried = tailEnd - tail;
+      block.data.resize(carried + blockSize);
+      std::copy(tail, tailEnd, &block.data[0]);
+      in.read(&block.data[carried], blockSize);
+      block.data.resize(carried + in.gcount());
+      const char* begin = block.data.data();
+      const char* end = begin + block.data.size();
+      return in ? findLastLineEnd(begin, end) : end;
+    }
+    void splitBlock(Block& block, const char* begin, const char* end)
+    {
+      block.size = 0;
+      size_t step = (end - begin) / block.capacity + 1;
+      while ((block.size < block.capacity) && (begin != end))
+      {
+        size_t left = end - begin;
+        Chunk& chunk = block.chunks[block.size++];
+        chunk.begin = begin;
+        chunk.end = findLineEnd(begin + (step < left ? step : left) - 1, end);
+        chunk.values.clear();
+        chunk.error = nullptr;
+        chunk.done = false;
+        begin = chunk.end;
+      }
+    }
+    void collectBlock(ChunkWorkers& workers, Block& block, Stack< long long >& results)
+    {
+      for (size_t i = 0; i < block.size; i++)
+      {
+        Chunk& chunk = block.chunks[i];
+        workers.wait(chunk);
+        if (chunk.error)
+        {
+          std::rethrow_exception(chunk.error);
+        }
+        results.reserve(results.size() + chunk.values.size());
+        for (size_t j = 0; j < chunk.values.size(); j++)
+        {
+          results.push(chunk.values[j]);
+        }
+      }
+      block.size = 0;
+    }
+  }
+}
+
+bool rychkov::evaluateLine(const char* begin, const char* end, long long& result)
+{
+  PackedExpression expression;
+  return evaluateLine(expression, begin, end, result);
+}
+bool rychkov::evaluateLine(PackedExpression& expression, const char* begin, const char* end, long long& result)
+{
+  if (!expression.parse(begin, end))
+  {
+    return false;
+  }
+  result = expression.evaluate();
+  return true;
+}
+bool rychkov::evaluateLineVariant(const char* begin, const char* end, long long& result)
+{
+  Queue< Variant< long long, Operator > > expression;
+  Stack< Operator > operators;
+  bool isNumber = false;
+  long long number = 0;
+  for (; begin != end; ++begin)
+  {
+    char c = *begin;
+    if (std::isdigit(c))
+    {
+      isNumber = true;
+      try
+      {
+        number = safeMul< long long >(number, 10);
+        number = safeAdd< long long >(number, c - '0');
+      }
+      catch (...)
+      {
+        throw std::overflow_error("input overflow");
+      }
+    }
+    else
+    {
+      if (isNumber)
+      {
+        expression.push(number);
+        isNumber = false;
+        number = 0;
+      }
+      if (c == '\n')
+      {
+        break;
+      }
+      if (!std::isspace(c))
+      {
+        if (!details::isOperator(c))
+        {
+          throw std::invalid_argument(std::string("found unknown symbol - '") + c + '\'');
+        }
+        Operator oper = static_cast< Operator >(c);
+        if (c == '(')
+        {
+          operators.push(oper);
+          continue;
+        }
+        Operator equalPrioritized = details::popLowPrioritized(expression, operators, oper);
+        if ((equalPrioritized != '(') && (c == ')'))
+        {
+          throw std::invalid_argument("wrong parentheses order");
+        }
+        if (c != ')')
+        {
+          operators.push(oper);
+        }
+      }
+    }
+  }
+  if (isNumber)
+  {
+    expression.push(number);
+  }
+  details::popLowPrioritized(expression, operators);
+  if (expression.empty())
+  {
+    return false;
+  }
+
+  Stack< long long > operands;
+  if (!holds_alternative< long long >(expression.front()))
+  {
+    throw std::invalid_argument("expression does not start with number");
+  }
+  operands.push(get< long long >(expression.front()));
+  expression.pop();
+  for (; !expression.empty(); expression.pop())
+  {
+    if (holds_alternative< Operator >(expression.front()))
+    {
+      if (operands.size() < 2)
+      {
+        throw std::invalid_argument("missing operand (number)");
+      }
+      long long rightOperand = operands.top();
+      operands.pop();
+      operands.top() = executeOperation(operands.top(), get< Operator >(expression.front()), rightOperand);
+    }
+    else
+    {
+      operands.push(get< long long >(expression.front()));
+    }
+  }
+  if (operands.size() != 1)
+  {
+    throw std::invalid_argument("missing operator");
+  }
+  result = operands.top();
+  return true;
+}
+void rychkov::evaluateSequential(std::istream& in, Stack< long long >& results)
+{
+  PackedExpression expression;
+  std::string line;
+  while (std::getline(in, line))
+  {
+    long long value = 0;
+    if (evaluateLine(expression, line.data(), line.data() + line.size(), value))
+    {
+      results.push(value);
+    }
+  }
+}
+void rychkov::evaluateParallel(std::istream& in, Stack< long long >& results, size_t jobs, size_t blockSize)
+{
+  details::Block blocks[2];
+  for (details::Block& block: blocks)
+  {
+    block.capacity = (jobs == 0 ? 1 : jobs);
+    block.chunks.reset(new details::Chunk[block.capacity]);
+  }
+  details::ChunkWorkers workers(blocks[0].capacity);
+  const char* tail = nullptr;
+  const char* tailEnd = nullptr;
+  size_t current = 0;
+  while (in)
+  {
+    details::Block& block = blocks[current];
+    const char* lines = details::readBlock(in, block, tail, tailEnd, blockSize);
+    details::splitBlock(block, block.data.data(), lines);
+    workers.submit(block);
+    tail = lines;
+    tailEnd = block.data.data() + block.data.size();
+    current ^= 1;
+    details::collectBlock(workers, blocks[current], results);
+  }
+  details::collectBlock(workers, blocks[current ^ 1], results);
+}
@@ -0,0 +1,19 @@
+#ifndef CALCULATOR_HPP
+#define CALCULATOR_HPP
+
+#include <cstddef>
+#include <istream>
+#include <stack.hpp>
+#include "packed_expression.hpp"
+
+namespace rychkov
+{
+  bool evaluateLine(const char* begin, const char* end, long long& result);
+  bool evaluateLine(PackedExpression& expression, const char* begin, const char* end, long long& result);
+  bool evaluateLineVariant(const char* begin, const char* end, long long& result);
+  void evaluateSequential(std::istream& in, Stack< long long >& results);
+  void evaluateParallel(std::istream& in, Stack< long long >& results, size_t jobs,
+        size_t blockSize = 1 << 22);
+}
+
+#endif
@@ -0,0 +1,167 @@
+#include "packed_expression.hpp"
+
+#include <cctype>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include <safe_math.hpp>
+
+constexpr rychkov::PackedExpression::word_type rychkov::PackedExpression::operator_tag;
+
+namespace rychkov
+{
+  namespace details
+  {
+    int getPackedPriority(char oper) noexcept
+    {
+      switch (oper)
+      {
+      case '(':
+      case ')':
+        return 1;
+      case '%':
+        return 2;
+      case '+':
+      case '-':
+        return 3;
+      case '*':
+      case '/':
+        return 4;
+      default:
+        return -1;
+      }
+    }
+  }
+}
+
+char rychkov::PackedExpression::popLowPrioritized(char referenceOperator)
+{
+  int referencePriority = details::getPackedPriority(referenceOperator);
+  size_t newSize = operators_.size();
+  const char* operators = operators_.data();
+  while ((newSize != 0) && (referencePriority < details::getPackedPriority(operators[newSize - 1])))
+  {
+    newSize--;
+  }
+  size_t oldTokens = tokens_.size();
+  tokens_.resize(oldTokens + operators_.size() - newSize);
+  word_type* out = tokens_.data() + oldTokens;
+  for (size_t i = operators_.size(); i != newSize; i--)
+  {
+    *out++ = pack_operator(operators[i - 1]);
+  }
+  operators_.resize(newSize);
+
+  char result = '\0';
+  if (!operators_.empty() && (details::getPackedPriority(operators_.back()) == referencePriority))
+  {
+    result = operators_.back();
+    if (result != '(')
+    {
+      tokens_.push_back(pack_operator(result));
+    }
+    operators_.pop_back();
+  }
+  return result;
+}
+bool rychkov::PackedExpression::parse(const char* begin, const char* end)
+{
+  tokens_.clear();
+  operators_.clear();
+  bool isNumber = false;
+  long long number = 0;
+  for (; begin != end; ++begin)
+  {
+    char c = *begin;
+    if (std::isdigit(c))
+    {
+      isNumber = true;
+      if (isMulOverflow< long long >(number, 10) || isAddOverflow< long long >(number * 10, c - '0'))
+      {
+        throw std::overflow_error("input overflow");
+      }
+      number = number * 10 + (c - '0');
+      continue;
+    }
+    if (isNumber)
+    {
+      tokens_.push_back(pack_number(number));
+      isNumber = false;
+      number = 0;
+    }
+    if (c == '\n')
+    {
+      break;
+    }
+    if (std::isspace(c))
+    {
+      continue;
+    }
+    if (details::getPackedPriority(c) == -1)
+    {
+      throw std::invalid_argument(std::string("found unknown symbol - '") + c + '\'');
+    }
+    if (c == '(')
+    {
+      operators_.push_back(c);
+      continue;
+    }
+    char equalPrioritized = popLowPrioritized(c);
+    if ((equalPrioritized != '(') && (c == ')'))
+    {
+      throw std::invalid_argument("wrong parentheses order");
+    }
+    if (c != ')')
+    {
+      operators_.push_back(c);
+    }
+  }
+  if (isNumber)
+  {
+    tokens_.push_back(pack_number(number));
+  }
+  popLowPrioritized('\0');
+  return !tokens_.empty();
+}
+long long rychkov::PackedExpression::evaluate()
+{
+  const word_type* token = tokens_.data();
+  const word_type* end = token + tokens_.size();
+  if ((token == end) || is_operator(*token))
+  {
+    throw std::invalid_argument("expression does not start with number");
+  }
+  operands_.resize(tokens_.size());
+  long long* top = operands_.data();
+  *top = unpack_number(*token++);
+  for (; token != end; ++token)
+  {
+    if (!is_operator(*token))
+    {
+      *++top = unpack_number(*token);
+    }
+    else if (top == operands_.data())
+    {
+      throw std::invalid_argument("missing operand (number)");
+    }
+    else
+    {
+      long long rightOperand = *top--;
+      *top = executeOperation(*top, unpack_operator(*token), rightOperand);
+    }
+  }
+  if (top != operands_.data())
+  {
+    throw std::invalid_argument("missing operator");
+  }
+  return *top;
+}
+size_t rychkov::PackedExpression::size() const noexcept
+{
+  return tokens_.size();
+}
+const rychkov::PackedExpression::word_type* rychkov::PackedExpression::tokens() const noexcept
+{
+  return tokens_.data();
+}
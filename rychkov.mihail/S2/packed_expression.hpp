@@ -0,0 +1,128 @@
+#ifndef PACKED_EXPRESSION_HPP
+#define PACKED_EXPRESSION_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace rychkov
+{
+  namespace details
+  {
+    template< class T >
+    class PackedArray
+    {
+      static_assert(std::is_trivially_copyable< T >::value, "packed arrays hold plain words only");
+    public:
+      using value_type = T;
+      using size_type = size_t;
+
+      PackedArray() noexcept:
+        size_(0),
+        capacity_(0)
+      {}
+
+      T* data() noexcept
+      {
+        return data_.get();
+      }
+      const T* data() const noexcept
+      {
+        return data_.get();
+      }
+      size_type size() const noexcept
+      {
+        return size_;
+      }
+      bool empty() const noexcept
+      {
+        return size_ == 0;
+      }
+      T& back() noexcept
+      {
+        return data_[size_ - 1];
+      }
+
+      void push_back(T value)
+      {
+        if (size_ == capacity_)
+        {
+          reserve(capacity_ * 2 + 16);
+        }
+        data_[size_++] = value;
+      }
+      void pop_back() noexcept
+      {
+        size_--;
+      }
+      void resize(size_type newSize)
+      {
+        reserve(newSize);
+        size_ = newSize;
+      }
+      void clear() noexcept
+      {
+        size_ = 0;
+      }
+      void reserve(size_type newCapacity)
+      {
+        if (newCapacity <= capacity_)
+        {
+          return;
+        }
+        std::unique_ptr< T[] > temp(new T[newCapacity]);
+        if (size_ != 0)
+        {
+          std::memcpy(temp.get(), data_.get(), size_ * sizeof(T));
+        }
+        data_ = std::move(temp);
+        capacity_ = newCapacity;
+      }
+    private:
+      std::unique_ptr< T[] > data_;
+      size_type size_, capacity_;
+    };
+  }
+
+  class PackedExpression
+  {
+  public:
+    using word_type = unsigned long long;
+    static constexpr word_type operator_tag = 1ULL << 63;
+
+    static constexpr bool is_operator(word_type word) noexcept
+    {
+      return (word & operator_tag) != 0;
+    }
+    static constexpr word_type pack_number(long long value) noexcept
+    {
+      return static_cast< word_type >(value);
+    }
+    static constexpr word_type pack_operator(char oper) noexcept
+    {
+      return operator_tag | static_cast< unsigned char >(oper);
+    }
+    static constexpr long long unpack_number(word_type word) noexcept
+    {
+      return static_cast< long long >(word);
+    }
+    static constexpr char unpack_operator(word_type word) noexcept
+    {
+      return static_cast< char >(word & 0xFF);
+    }
+
+    bool parse(const char* begin, const char* end);
+    long long evaluate();
+    size_t size() const noexcept;
+    const word_type* tokens() const noexcept;
+  private:
+    details::PackedArray< word_type > tokens_;
+    details::PackedArray< char > operators_;
+    details::PackedArray< long long > operands_;
+
+    char popLowPrioritized(char referenceOperator);
+  };
+}
+
+#endif
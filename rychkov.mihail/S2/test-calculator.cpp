@@ -0,0 +1,119 @@
+#include <boost/test/unit_test.hpp>
+#include <sstream>
+#include <string>
+#include <stdexcept>
+#include "calculator.hpp"
+
+namespace
+{
+  std::string makeExpressions(size_t count)
+  {
+    std::string result;
+    for (size_t i = 0; i < count; i++)
+    {
+      result += std::to_string(i) + " * (3 + " + std::to_string(i % 11) + ") % 9\n";
+      if (i % 7 == 0)
+      {
+        result += "  \n";
+      }
+    }
+    return result;
+  }
+  rychkov::Stack< long long > evaluate(const std::string& input, size_t jobs, size_t blockSize)
+  {
+    std::istringstream in(input);
+    rychkov::Stack< long long > results;
+    rychkov::evaluateParallel(in, results, jobs, blockSize);
+    return results;
+  }
+  std::string evaluateMessage(bool (*evaluator)(const char*, const char*, long long&), const std::string& line)
+  {
+    long long result = 0;
+    try
+    {
+      if (!evaluator(line.data(), line.data() + line.size(), result))
+      {
+        return "<EMPTY>";
+      }
+    }
+    catch (const std::exception& e)
+    {
+      return e.what();
+    }
+    return std::to_string(result);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(S2_calculator_test)
+
+BOOST_AUTO_TEST_CASE(line_test)
+{
+  const char expr[] = "(1 + 2) * 3";
+  long long result = 0;
+  BOOST_TEST(rychkov::evaluateLine(expr, expr + sizeof(expr) - 1, result));
+  BOOST_TEST(result == 9);
+  BOOST_TEST(!rychkov::evaluateLine(expr, expr, result));
+}
+BOOST_AUTO_TEST_CASE(parallel_order_test)
+{
+  std::string input = makeExpressions(500);
+  std::istringstream in(input);
+  rychkov::Stack< long long > expected;
+  rychkov::evaluateSequential(in, expected);
+  BOOST_TEST(expected.size() == 500);
+  for (size_t jobs = 1; jobs < 5; jobs++)
+  {
+    rychkov::Stack< long long > results = evaluate(input, jobs, 37);
+    BOOST_TEST(results.size() == expected.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+      BOOST_TEST(results[i] == expected[i]);
+    }
+  }
+}
+BOOST_AUTO_TEST_CASE(parallel_error_test)
+{
+  std::string input = makeExpressions(100) + "5 % 0\n" + makeExpressions(100) + "1 $ 2\n";
+  for (size_t jobs = 1; jobs < 5; jobs++)
+  {
+    try
+    {
+      evaluate(input, jobs, 64);
+      BOOST_TEST(false);
+    }
+    catch (const std::invalid_argument& e)
+    {
+      BOOST_TEST(std::string(e.what()) == "invalid mod");
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(packed_matches_variant_test)
+{
+  const char* lines[] = {
+    "", "   ", "1", "1 + 2 * 3", "(1 + 2) * 3", "7 % 3 + 1", "7 + 3 % 4", "(((5)))", "2 - 3 - 4",
+    "100 / 7 / 2", "1 +", "+ 1", "1 2", "(1 + 2", "1 + 2)", "1 # 2", "5 / 0", "5 % 0",
+    "9223372036854775807 + 1", "99999999999999999999", "9223372036854775807 * 2", "8 - 20 % 6",
+    "(2 + 3) * (4 - 1) % 5", "(", ")", "1 + (2 * (3 - 4)) / 5"
+  };
+  for (const char* line: lines)
+  {
+    BOOST_TEST(evaluateMessage(rychkov::evaluateLine, line) == evaluateMessage(rychkov::evaluateLineVariant, line));
+  }
+}
+BOOST_AUTO_TEST_CASE(packed_encoding_test)
+{
+  using rychkov::PackedExpression;
+  PackedExpression expression;
+  const char line[] = "12 + 3 * 4";
+  BOOST_TEST(expression.parse(line, line + sizeof(line) - 1));
+  BOOST_TEST(expression.size() == 5);
+  const PackedExpression::word_type* tokens = expression.tokens();
+  BOOST_TEST(PackedExpression::unpack_number(tokens[0]) == 12);
+  BOOST_TEST(PackedExpression::is_operator(tokens[3]));
+  BOOST_TEST(PackedExpression::unpack_operator(tokens[3]) == '*');
+  BOOST_TEST(PackedExpression::unpack_operator(tokens[4]) == '+');
+  BOOST_TEST(expression.evaluate() == 24);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -71,15 +71,7 @@ bool rychkov::S4ParseProcessor::make_complement(ParserContext& context)
   inner_map& link = map[name];
   const inner_map& lhslink = map.at(lhs);
   const inner_map& rhslink = map.at(rhs);
-  inner_map temp;
-  for (const inner_map::value_type& i: lhslink)
-  {
-    if (!rhslink.contains(i.first))
-    {
-      temp.insert(i);
-    }
-  }
-  link = std::move(temp);
+  link = inner_map::merge_difference(lhslink, rhslink);
   return true;
 }
 bool rychkov::S4ParseProcessor::make_intersect(ParserContext& context)
@@ -92,15 +84,7 @@ bool rychkov::S4ParseProcessor::make_intersect(ParserContext& context)
   inner_map& link = map[name];
   const inner_map& lhslink = map.at(lhs);
   const inner_map& rhslink = map.at(rhs);
-  inner_map temp;
-  for (const inner_map::value_type& i: lhslink)
-  {
-    if (rhslink.contains(i.first))
-    {
-      temp.insert(i);
-    }
-  }
-  link = std::move(temp);
+  link = inner_map::merge_intersection(lhslink, rhslink);
   return true;
 }
 bool rychkov::S4ParseProcessor::make_union(ParserContext& context)
@@ -113,8 +97,6 @@ bool rychkov::S4ParseProcessor::make_union(ParserContext& context)
   inner_map& link = map[name];
   const inner_map& lhslink = map.at(lhs);
   const inner_map& rhslink = map.at(rhs);
-  inner_map temp = lhslink;
-  temp.insert(rhslink.begin(), rhslink.end());
-  link = std::move(temp);
+  link = inner_map::merge_union(lhslink, rhslink);
   return true;
 }
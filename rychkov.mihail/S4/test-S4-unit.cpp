@@ -1,2 +1,4 @@
 #define BOOST_TEST_MODULE S4
+#define RYCHKOV_COUNT_ALLOCATIONS
 #include <boost/test/included/unit_test.hpp>
+#include <alloc_counter.hpp>
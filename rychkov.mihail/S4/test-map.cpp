@@ -4,6 +4,8 @@
 #include <chrono>
 #include <algorithm>
 #include <iterator>
+#include <string>
+#include <vector>
 #include <boost/test/unit_test.hpp>
 #include <mem_checker.hpp>
 #include <map.hpp>
@@ -100,5 +102,127 @@ BOOST_AUTO_TEST_CASE(random_test)
     BOOST_TEST(set.size() == size);
   }
 }
+template< size_t N >
+void check_merge_operations(size_t lhs_size, size_t rhs_size)
+{
+  using set_type = rychkov::Set< int, std::less<>, N >;
+  std::mt19937 engine;
+  engine.seed(std::chrono::system_clock::now().time_since_epoch().count());
+  std::uniform_int_distribution< int > range(0, static_cast< int >(lhs_size + rhs_size));
+  std::vector< int > lhs_data, rhs_data;
+  set_type lhs, rhs;
+  for (size_t i = 0; i < lhs_size; i++)
+  {
+    lhs.insert(range(engine));
+  }
+  for (size_t i = 0; i < rhs_size; i++)
+  {
+    rhs.insert(range(engine));
+  }
+  lhs_data.assign(lhs.begin(), lhs.end());
+  rhs_data.assign(rhs.begin(), rhs.end());
+
+  std::vector< int > expected;
+  std::set_union(lhs_data.begin(), lhs_data.end(), rhs_data.begin(), rhs_data.end(), std::back_inserter(expected));
+  set_type result = set_type::merge_union(lhs, rhs);
+  BOOST_TEST(result.size() == expected.size());
+  BOOST_TEST(std::equal(result.begin(), result.end(), expected.begin(), expected.end()));
+  BOOST_TEST(std::equal(result.rbegin(), result.rend(), expected.rbegin(), expected.rend()));
+  for (int i: expected)
+  {
+    BOOST_TEST(result.contains(i));
+  }
+  while (!expected.empty())
+  {
+    size_t id = std::uniform_int_distribution< size_t >(0, expected.size() - 1)(engine);
+    BOOST_TEST(result.erase(expected[id]) == 1);
+    expected.erase(expected.begin() + id);
+    BOOST_TEST(std::equal(result.begin(), result.end(), expected.begin(), expected.end()));
+  }
+
+  expected.clear();
+  std::set_intersection(lhs_data.begin(), lhs_data.end(), rhs_data.begin(), rhs_data.end(),
+        std::back_inserter(expected));
+  result = set_type::merge_intersection(lhs, rhs);
+  BOOST_TEST(std::equal(result.begin(), result.end(), expected.begin(), expected.end()));
+
+  expected.clear();
+  std::set_difference(lhs_data.begin(), lhs_data.end(), rhs_data.begin(), rhs_data.end(),
+        std::back_inserter(expected));
+  result = set_type::merge_difference(lhs, rhs);
+  BOOST_TEST(std::equal(result.begin(), result.end(), expected.begin(), expected.end()));
+  for (int i = -1; i <= static_cast< int >(lhs_size + rhs_size) + 1; i++)
+  {
+    result.insert(i);
+  }
+  BOOST_TEST(result.size() == lhs_size + rhs_size + 3);
+  BOOST_TEST(std::is_sorted(result.begin(), result.end()));
+}
+BOOST_AUTO_TEST_CASE(merge_operations_test)
+{
+  for (size_t lhs_size: {0, 1, 2, 3, 7, 100, 1000})
+  {
+    for (size_t rhs_size: {0, 1, 5, 64, 1000})
+    {
+      check_merge_operations< 2 >(lhs_size, rhs_size);
+      check_merge_operations< 5 >(lhs_size, rhs_size);
+    }
+  }
+}
+BOOST_AUTO_TEST_CASE(merge_move_test)
+{
+  using map_type = rychkov::Map< int, std::string >;
+  map_type lhs = {{1, "one"}, {3, "three"}, {5, "five"}};
+  map_type rhs = {{2, "two"}, {3, "drei"}, {4, "four"}};
+  map_type result = map_type::merge_union(std::move(lhs), rhs);
+  BOOST_TEST(lhs.empty());
+  BOOST_TEST(rhs.size() == 3);
+  BOOST_TEST(rhs.at(2) == "two");
+  BOOST_TEST(result.size() == 5);
+  BOOST_TEST(result.at(3) == "three");
+  BOOST_TEST(result.at(4) == "four");
+
+  map_type common = map_type::merge_intersection(rhs, std::move(result));
+  BOOST_TEST(result.empty());
+  BOOST_TEST(common.size() == 3);
+  BOOST_TEST(common.at(3) == "drei");
+  map_type rest = map_type::merge_difference(std::move(common), map_type{{2, ""}});
+  BOOST_TEST(rest.size() == 2);
+  BOOST_TEST(rest.begin()->second == "drei");
+}
+BOOST_AUTO_TEST_CASE(allocation_test)
+{
+  rychkov::AllocTrack observer{};
+  constexpr int input_size = 4096;
+  rychkov::Set< int, std::less<>, 10 > set;
+  rychkov::AllocReport insert = rychkov::measure_allocations("Set::insert", input_size, [&set]()
+  {
+    for (int i = 0; i < input_size; i++)
+    {
+      set.insert(i);
+    }
+  });
+  BOOST_TEST(insert.stats.allocations > 0);
+  BOOST_TEST(insert.allocations_per_op() <= 1.0);
+  BOOST_TEST(insert.stats.peak_bytes >= insert.stats.live_bytes());
+
+  size_t found = 0;
+  rychkov::AllocReport find = rychkov::measure_allocations("Set::find", input_size, [&set, &found]()
+  {
+    for (int i = 0; i < input_size; i++)
+    {
+      found += set.contains(i);
+    }
+  });
+  BOOST_TEST(found == input_size);
+  BOOST_TEST(find.stats.allocations == 0);
+
+  rychkov::AllocReport clear = rychkov::measure_allocations("Set::erase", input_size, [&set]()
+  {
+    set.erase(set.begin(), set.end());
+  });
+  BOOST_TEST(clear.stats.allocations == 0);
+  BOOST_TEST(clear.stats.freed_bytes == insert.stats.live_bytes());
+}
 
 BOOST_AUTO_TEST_SUITE_END()
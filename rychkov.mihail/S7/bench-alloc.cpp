@@ -0,0 +1,74 @@
+#define BENCH_MAIN
+#define RYCHKOV_COUNT_ALLOCATIONS
+#include <harness.hpp>
+#include <iostream>
+#include <string>
+#include <alloc_counter.hpp>
+#include <map.hpp>
+#include <unordered_map.hpp>
+
+namespace
+{
+  constexpr int input_size = 100000;
+  using MapType = rychkov::Map< int, int, std::less<>, 16 >;
+
+  template< class Container >
+  void fill(Container& container)
+  {
+    for (int i = 0; i < input_size; i++)
+    {
+      container.emplace(i * 7919 % input_size, i);
+    }
+  }
+  template< class Container >
+  void report(const char* name)
+  {
+    Container container;
+    std::clog << rychkov::measure_allocations(name, input_size, [&container]()
+    {
+      fill(container);
+    }) << '\n';
+  }
+}
+
+BENCH_CASE(map_insert)
+{
+  report< MapType >("Map::insert");
+  state.setItems(input_size);
+  state.run([]()
+  {
+    MapType map;
+    fill(map);
+    bench::doNotOptimize(map);
+  });
+}
+BENCH_CASE(unordered_map_rehash)
+{
+  report< rychkov::UnorderedMap< int, int > >("UnorderedMap::rehash");
+  state.setItems(input_size);
+  state.run([]()
+  {
+    rychkov::UnorderedMap< int, int > map;
+    fill(map);
+    bench::doNotOptimize(map);
+  });
+}
+BENCH_CASE(unordered_map_reserved)
+{
+  {
+    rychkov::UnorderedMap< int, int > map;
+    map.reserve(input_size);
+    std::clog << rychkov::measure_allocations("UnorderedMap::insert", input_size, [&map]()
+    {
+      fill(map);
+    }) << '\n';
+  }
+  state.setItems(input_size);
+  state.run([]()
+  {
+    rychkov::UnorderedMap< int, int > map;
+    map.reserve(input_size);
+    fill(map);
+    bench::doNotOptimize(map);
+  });
+}
@@ -1,5 +1,6 @@
 #include <stdexcept>
 #include <iterator>
+#include <vector>
 #include <boost/test/unit_test.hpp>
 #include <mem_checker.hpp>
 #include <unordered_map.hpp>
@@ -130,5 +131,40 @@ BOOST_AUTO_TEST_CASE(traverse_stability_test)
     BOOST_TEST(counts[i] == 1);
   }
 }
+BOOST_AUTO_TEST_CASE(allocation_test)
+{
+  rychkov::AllocTrack observer{};
+  constexpr int input_size = 1000;
+  rychkov::UnorderedMap< int, int > grown;
+  rychkov::AllocReport grow = rychkov::measure_allocations("UnorderedMap::rehash", input_size, [&grown]()
+  {
+    for (int i = 0; i < input_size; i++)
+    {
+      grown.emplace(i, i);
+    }
+  });
+  BOOST_TEST(grow.stats.allocations > 1);
+  BOOST_TEST(grow.stats.peak_bytes > grow.stats.live_bytes());
+
+  rychkov::UnorderedMap< int, int > reserved;
+  reserved.reserve(input_size);
+  rychkov::AllocReport insert = rychkov::measure_allocations("UnorderedMap::insert", input_size, [&reserved]()
+  {
+    for (int i = 0; i < input_size; i++)
+    {
+      reserved.emplace(i, i);
+    }
+  });
+  BOOST_TEST(reserved.size() == input_size);
+  BOOST_TEST(insert.stats.allocations == 0);
+
+  std::vector< int, rychkov::CountingAllocator< int > > counted;
+  rychkov::AllocReport vector = rychkov::measure_allocations("vector::reserve", 1, [&counted]()
+  {
+    counted.reserve(input_size);
+  });
+  BOOST_TEST(vector.stats.allocations == 1);
+  BOOST_TEST(vector.stats.allocated_bytes == input_size * sizeof(int));
+}
 
 BOOST_AUTO_TEST_SUITE_END()
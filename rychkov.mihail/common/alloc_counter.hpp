@@ -0,0 +1,263 @@
+#ifndef ALLOC_COUNTER_HPP
+#define ALLOC_COUNTER_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <atomic>
+#include <new>
+#include <ostream>
+#include <utility>
+
+namespace rychkov
+{
+  struct AllocStats
+  {
+    size_t allocations = 0;
+    size_t frees = 0;
+    size_t allocated_bytes = 0;
+    size_t freed_bytes = 0;
+    size_t peak_bytes = 0;
+
+    size_t live_bytes() const noexcept
+    {
+      return allocated_bytes - freed_bytes;
+    }
+  };
+  struct AllocReport
+  {
+    const char* name;
+    size_t operations;
+    AllocStats stats;
+
+    double allocations_per_op() const noexcept
+    {
+      return operations == 0 ? 0 : static_cast< double >(stats.allocations) / operations;
+    }
+  };
+
+  namespace details
+  {
+    struct AllocCounters
+    {
+      std::atomic< size_t > allocations;
+      std::atomic< size_t > frees;
+      std::atomic< size_t > allocated_bytes;
+      std::atomic< size_t > freed_bytes;
+      std::atomic< size_t > peak_bytes;
+    };
+    inline AllocCounters& alloc_counters() noexcept
+    {
+      static AllocCounters counters{{0}, {0}, {0}, {0}, {0}};
+      return counters;
+    }
+    inline size_t live_bytes(const AllocCounters& counters) noexcept
+    {
+      return counters.allocated_bytes.load(std::memory_order_relaxed)
+          - counters.freed_bytes.load(std::memory_order_relaxed);
+    }
+    inline void raise_peak(AllocCounters& counters, size_t live) noexcept
+    {
+      size_t peak = counters.peak_bytes.load(std::memory_order_relaxed);
+      while ((peak < live) && !counters.peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+      {}
+    }
+  }
+
+  inline void count_allocation(size_t size) noexcept
+  {
+    details::AllocCounters& counters = details::alloc_counters();
+    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+    counters.allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    details::raise_peak(counters, details::live_bytes(counters));
+  }
+  inline void count_free(size_t size) noexcept
+  {
+    details::AllocCounters& counters = details::alloc_counters();
+    counters.frees.fetch_add(1, std::memory_order_relaxed);
+    counters.freed_bytes.fetch_add(size, std::memory_order_relaxed);
+  }
+  inline AllocStats alloc_stats() noexcept
+  {
+    const details::AllocCounters& counters = details::alloc_counters();
+    AllocStats result;
+    result.allocations = counters.allocations.load(std::memory_order_relaxed);
+    result.frees = counters.frees.load(std::memory_order_relaxed);
+    result.allocated_bytes = counters.allocated_bytes.load(std::memory_order_relaxed);
+    result.freed_bytes = counters.freed_bytes.load(std::memory_order_relaxed);
+    result.peak_bytes = counters.peak_bytes.load(std::memory_order_relaxed);
+    return result;
+  }
+
+  // counts what happens between construction and stats(); peak is measured above the live bytes at start
+  class AllocScope
+  {
+  public:
+    AllocScope() noexcept:
+      start_(alloc_stats())
+    {
+      details::alloc_counters().peak_bytes.store(start_.live_bytes(), std::memory_order_relaxed);
+    }
+    AllocScope(const AllocScope&) = delete;
+    ~AllocScope()
+    {
+      details::raise_peak(details::alloc_counters(), start_.peak_bytes);
+    }
+
+    AllocStats stats() const noexcept
+    {
+      AllocStats now = alloc_stats();
+      AllocStats result;
+      result.allocations = now.allocations - start_.allocations;
+      result.frees = now.frees - start_.frees;
+      result.allocated_bytes = now.allocated_bytes - start_.allocated_bytes;
+      result.freed_bytes = now.freed_bytes - start_.freed_bytes;
+      result.peak_bytes = now.peak_bytes - start_.live_bytes();
+      return result;
+    }
+  private:
+    AllocStats start_;
+  };
+  template< class F >
+  AllocReport measure_allocations(const char* name, size_t operations, F&& func)
+  {
+    AllocScope scope;
+    std::forward< F >(func)();
+    return {name, operations, scope.stats()};
+  }
+  inline std::ostream& operator<<(std::ostream& out, const AllocReport& report)
+  {
+    return out << report.name << " made " << report.allocations_per_op() << " allocations/op, "
+        << report.stats.allocated_bytes << " bytes, " << report.stats.peak_bytes << " bytes peak, "
+        << report.stats.allocations - report.stats.frees << " still live";
+  }
+
+  // counts directly, so it does not depend on RYCHKOV_COUNT_ALLOCATIONS and is not counted twice with it
+  template< class T >
+  class CountingAllocator
+  {
+  public:
+    using value_type = T;
+
+    CountingAllocator() = default;
+    template< class U >
+    CountingAllocator(const CountingAllocator< U >&) noexcept
+    {}
+
+    T* allocate(size_t n)
+    {
+      void* result = std::malloc(n * sizeof(T));
+      if (result == nullptr)
+      {
+        throw std::bad_alloc();
+      }
+      count_allocation(n * sizeof(T));
+      return static_cast< T* >(result);
+    }
+    void deallocate(T* ptr, size_t n) noexcept
+    {
+      count_free(n * sizeof(T));
+      std::free(ptr);
+    }
+  };
+  template< class T, class U >
+  bool operator==(const CountingAllocator< T >&, const CountingAllocator< U >&) noexcept
+  {
+    return true;
+  }
+  template< class T, class U >
+  bool operator!=(const CountingAllocator< T >&, const CountingAllocator< U >&) noexcept
+  {
+    return false;
+  }
+}
+
+// define in exactly one translation unit of a test or bench binary to count every global new/delete
+#ifdef RYCHKOV_COUNT_ALLOCATIONS
+namespace rychkov
+{
+  namespace details
+  {
+    constexpr size_t alloc_header = alignof(std::max_align_t);
+
+    inline void* counted_new(size_t size) noexcept
+    {
+      void* raw = std::malloc(size + alloc_header);
+      if (raw == nullptr)
+      {
+        return nullptr;
+      }
+      *static_cast< size_t* >(raw) = size;
+      count_allocation(size);
+      return static_cast< unsigned char* >(raw) + alloc_header;
+    }
+    inline void* counted_new_or_throw(size_t size)
+    {
+      void* result = counted_new(size);
+      while (result == nullptr)
+      {
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr)
+        {
+          throw std::bad_alloc();
+        }
+        handler();
+        result = counted_new(size);
+      }
+      return result;
+    }
+    inline void counted_delete(void* ptr) noexcept
+    {
+      if (ptr == nullptr)
+      {
+        return;
+      }
+      void* raw = static_cast< unsigned char* >(ptr) - alloc_header;
+      count_free(*static_cast< size_t* >(raw));
+      std::free(raw);
+    }
+  }
+}
+
+void* operator new(size_t size)
+{
+  return rychkov::details::counted_new_or_throw(size);
+}
+void* operator new[](size_t size)
+{
+  return rychkov::details::counted_new_or_throw(size);
+}
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+  return rychkov::details::counted_new(size);
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+  return rychkov::details::counted_new(size);
+}
+void operator delete(void* ptr) noexcept
+{
+  rychkov::details::counted_delete(ptr);
+}
+void operator delete[](void* ptr) noexcept
+{
+  rychkov::details::counted_delete(ptr);
+}
+void operator delete(void* ptr, size_t) noexcept
+{
+  rychkov::details::counted_delete(ptr);
+}
+void operator delete[](void* ptr, size_t) noexcept
+{
+  rychkov::details::counted_delete(ptr);
+}
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+  rychkov::details::counted_delete(ptr);
+}
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+  rychkov::details::counted_delete(ptr);
+}
+#endif
+
+#endif
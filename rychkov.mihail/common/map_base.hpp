@@ -13,5 +13,6 @@
 #include "map_base/search.hpp"
 #include "map_base/erase.hpp"
 #include "map_base/traverses.hpp"
+#include "map_base/merge.hpp"
 
 #endif
@@ -7,24 +7,28 @@ template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
 rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::MapBase()
     noexcept(std::is_nothrow_default_constructible< value_compare >::value):
   comp_(),
-  cached_begin_(fake_root()),
-  cached_rbegin_(fake_root()),
+  cached_begin_(nullptr),
+  cached_rbegin_(nullptr),
   size_(0),
   fake_parent_(nullptr),
   fake_children_{nullptr},
   fake_size_(0)
-{}
+{
+  cached_rbegin_ = cached_begin_ = fake_root();
+}
 template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
 rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::MapBase(value_compare key)
     noexcept(std::is_nothrow_move_constructible< value_compare >::value):
   comp_(std::move(key)),
-  cached_begin_(fake_root()),
-  cached_rbegin_(fake_root()),
+  cached_begin_(nullptr),
+  cached_rbegin_(nullptr),
   size_(0),
   fake_parent_(nullptr),
   fake_children_{nullptr},
   fake_size_(0)
-{}
+{
+  cached_rbegin_ = cached_begin_ = fake_root();
+}
 template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
 rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::MapBase(MapBase&& rhs)
     noexcept(std::is_nothrow_move_constructible< value_compare >::value):
@@ -198,6 +198,18 @@ namespace rychkov
     void insert(InputIter from, InputIter to);
     void insert(std::initializer_list< value_type > list);
 
+  private:
+    template< class M, class R >
+    using merge_result_t = std::enable_if_t< std::is_same< remove_cvref_t< M >, MapBase >::value && !IsMulti, R >;
+
+  public:
+    template< class L, class R >
+    static merge_result_t< L, merge_result_t< R, MapBase > > merge_union(L&& lhs, R&& rhs);
+    template< class L, class R >
+    static merge_result_t< L, merge_result_t< R, MapBase > > merge_intersection(L&& lhs, R&& rhs);
+    template< class L, class R >
+    static merge_result_t< L, merge_result_t< R, MapBase > > merge_difference(L&& lhs, R&& rhs);
+
     template< bool IsSet2 = IsSet >
     std::enable_if_t< IsSet2, key_compare > key_comp() const;
     template< bool IsSet2 = IsSet >
@@ -269,6 +281,17 @@ namespace rychkov
     template< bool IsSet2 = IsSet >
     std::enable_if_t< !IsSet && !IsSet2, bool > compare_with_key(const key_type& lhs, const key_type& rhs) const;
 
+    template< class Src >
+    using merge_source_value_t = std::conditional_t< std::is_lvalue_reference< Src >::value
+          || std::is_const< std::remove_reference_t< Src > >::value, const real_value_type&, real_value_type&& >;
+    template< class Src >
+    static merge_source_value_t< Src > merge_take(const_iterator pos) noexcept;
+    template< class Src >
+    static void merge_release(Src&& src) noexcept;
+    template< class... Args >
+    void spine_append(node_type** spine, size_t& height, Args&&... args);
+    void spine_finish(node_type** spine, size_t height) noexcept;
+
     template< class V = value_type >
     static const key_type& get_key(const V& value);
     static const key_type& get_key(const key_type& key);
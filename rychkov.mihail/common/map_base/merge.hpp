@@ -0,0 +1,235 @@
+#ifndef MAP_BASE_MERGE_HPP
+#define MAP_BASE_MERGE_HPP
+
+#include "declaration.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <type_traits>
+
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class Src >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::template merge_source_value_t< Src >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::merge_take(const_iterator pos) noexcept
+{
+  return static_cast< merge_source_value_t< Src > >(pos.node_->operator[](pos.pointed_));
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class Src >
+void rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::merge_release(Src&& src) noexcept
+{
+  if (std::is_rvalue_reference< merge_source_value_t< Src > >::value)
+  {
+    const_cast< MapBase& >(static_cast< const MapBase& >(src)).clear();
+  }
+}
+
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class... Args >
+void rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::spine_append(node_type** spine, size_t& height,
+    Args&&... args)
+{
+  size_t level = 0;
+  for (; (level < height) && spine[level]->full(); level++)
+  {}
+
+  constexpr size_t max_tree_depth = std::numeric_limits< size_t >::digits + 1;
+  struct MemSaver
+  {
+    node_type* data[max_tree_depth];
+    size_t size = 0;
+    ~MemSaver()
+    {
+      while (size > 0)
+      {
+        delete data[--size];
+      }
+    }
+    node_type* push()
+    {
+      node_type* result = new node_type;
+      std::fill_n(result->children, node_capacity + 1, nullptr);
+      return data[size++] = result;
+    }
+  };
+  MemSaver storage;
+  for (size_t i = 0; i < level; i++)
+  {
+    storage.push();
+  }
+  node_type* target = (level == height ? storage.push() : spine[level]);
+  node_type* rightmost = target->children[target->size()];
+  target->emplace_back(std::forward< Args >(args)...);
+
+  if (level == height)
+  {
+    target->parent = fake_root();
+    fake_children_[0] = target;
+    if (height == 0)
+    {
+      cached_begin_ = target;
+    }
+    else
+    {
+      target->children[0] = spine[height - 1];
+      spine[height - 1]->parent = target;
+    }
+    height++;
+  }
+  else
+  {
+    target->children[target->size() - 1] = rightmost;
+  }
+  if (level != 0)
+  {
+    target->children[target->size()] = storage.data[level - 1];
+    storage.data[level - 1]->parent = target;
+    for (size_t i = level - 1; i > 0; i--)
+    {
+      storage.data[i]->children[0] = storage.data[i - 1];
+      storage.data[i - 1]->parent = storage.data[i];
+    }
+  }
+  spine[level] = target;
+  for (size_t i = 0; i < level; i++)
+  {
+    spine[i] = storage.data[i];
+  }
+  storage.size = 0;
+  cached_rbegin_ = spine[0];
+  size_++;
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+void rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::spine_finish(node_type** spine, size_t height) noexcept
+{
+  for (size_t level = height - (height == 0 ? 0 : 1); level > 0; level--)
+  {
+    node_type* node = spine[level - 1];
+    if (!node->empty())
+    {
+      continue;
+    }
+    node_type* parent = spine[level];
+    node_type* sibling = parent->children[parent->size() - 1];
+    node_type* only_child = node->children[0];
+    node->emplace_back(std::move(parent->operator[](parent->size() - 1)));
+    node->children[0] = sibling->children[sibling->size()];
+    node->children[1] = only_child;
+    if (node->children[0] != nullptr)
+    {
+      node->children[0]->parent = node;
+    }
+    parent->replace(parent->size() - 1, std::move(sibling->operator[](sibling->size() - 1)));
+    sibling->pop_back();
+  }
+}
+
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class L, class R >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::template merge_result_t< L,
+      typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::template merge_result_t< R,
+      rychkov::MapBase< K, T, C, N, IsSet, IsMulti > > >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::merge_union(L&& lhs, R&& rhs)
+{
+  constexpr size_t max_tree_depth = std::numeric_limits< size_t >::digits + 1;
+  node_type* spine[max_tree_depth];
+  size_t height = 0;
+  MapBase result(lhs.comp_);
+  const_iterator left = lhs.cbegin(), right = rhs.cbegin();
+  while ((left != lhs.cend()) && (right != rhs.cend()))
+  {
+    if (lhs.compare_with_key(get_key(*right), get_key(*left)))
+    {
+      result.spine_append(spine, height, merge_take< R >(right++));
+    }
+    else
+    {
+      if (!lhs.compare_with_key(get_key(*left), get_key(*right)))
+      {
+        ++right;
+      }
+      result.spine_append(spine, height, merge_take< L >(left++));
+    }
+  }
+  for (; left != lhs.cend(); ++left)
+  {
+    result.spine_append(spine, height, merge_take< L >(left));
+  }
+  for (; right != rhs.cend(); ++right)
+  {
+    result.spine_append(spine, height, merge_take< R >(right));
+  }
+  result.spine_finish(spine, height);
+  merge_release(std::forward< L >(lhs));
+  merge_release(std::forward< R >(rhs));
+  return result;
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class L, class R >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::template merge_result_t< L,
+      typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::template merge_result_t< R,
+      rychkov::MapBase< K, T, C, N, IsSet, IsMulti > > >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::merge_intersection(L&& lhs, R&& rhs)
+{
+  constexpr size_t max_tree_depth = std::numeric_limits< size_t >::digits + 1;
+  node_type* spine[max_tree_depth];
+  size_t height = 0;
+  MapBase result(lhs.comp_);
+  const_iterator left = lhs.cbegin(), right = rhs.cbegin();
+  while ((left != lhs.cend()) && (right != rhs.cend()))
+  {
+    if (lhs.compare_with_key(get_key(*left), get_key(*right)))
+    {
+      ++left;
+    }
+    else if (lhs.compare_with_key(get_key(*right), get_key(*left)))
+    {
+      ++right;
+    }
+    else
+    {
+      result.spine_append(spine, height, merge_take< L >(left++));
+      ++right;
+    }
+  }
+  result.spine_finish(spine, height);
+  merge_release(std::forward< L >(lhs));
+  merge_release(std::forward< R >(rhs));
+  return result;
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class L, class R >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::template merge_result_t< L,
+      typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::template merge_result_t< R,
+      rychkov::MapBase< K, T, C, N, IsSet, IsMulti > > >
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::merge_difference(L&& lhs, R&& rhs)
+{
+  constexpr size_t max_tree_depth = std::numeric_limits< size_t >::digits + 1;
+  node_type* spine[max_tree_depth];
+  size_t height = 0;
+  MapBase result(lhs.comp_);
+  const_iterator left = lhs.cbegin(), right = rhs.cbegin();
+  while (left != lhs.cend())
+  {
+    if ((right == rhs.cend()) || lhs.compare_with_key(get_key(*left), get_key(*right)))
+    {
+      result.spine_append(spine, height, merge_take< L >(left++));
+    }
+    else if (lhs.compare_with_key(get_key(*right), get_key(*left)))
+    {
+      ++right;
+    }
+    else
+    {
+      ++left;
+      ++right;
+    }
+  }
+  result.spine_finish(spine, height);
+  merge_release(std::forward< L >(lhs));
+  merge_release(std::forward< R >(rhs));
+  return result;
+}
+
+#endif
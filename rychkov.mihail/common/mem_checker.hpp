@@ -5,6 +5,7 @@
 #include <utility>
 #include <type_traits>
 #include <boost/test/unit_test.hpp>
+#include "alloc_counter.hpp"
 
 namespace rychkov
 {
@@ -69,6 +70,19 @@ namespace rychkov
       }
     }
   };
+  struct AllocTrack
+  {
+    AllocTrack() = default;
+    AllocTrack(const AllocTrack&) = delete;
+    ~AllocTrack()
+    {
+      AllocStats stats = scope.stats();
+      BOOST_TEST(stats.allocations == stats.frees);
+      BOOST_TEST(stats.allocated_bytes == stats.freed_bytes);
+    }
+
+    AllocScope scope;
+  };
 }
 
 #endif
@@ -0,0 +1,81 @@
+#ifndef COMMAND_LINE_HPP
+#define COMMAND_LINE_HPP
+#include <cstddef>
+#include <istream>
+#include <string>
+#include <dynamic-array.hpp>
+
+namespace savintsev
+{
+  struct Token
+  {
+    const char * data;
+    size_t size;
+  };
+
+  // tokens point into the line buffer and words are copied into kept strings,
+  // so reading line after line stops allocating once the buffers have grown
+  class CommandLine
+  {
+  public:
+    bool read(std::istream & in);
+
+    bool empty() const noexcept;
+    size_t size() const noexcept;
+    const Token & operator[](size_t i) const;
+    const std::string & str(size_t i);
+
+  private:
+    std::string line_;
+    Array< Token > tokens_;
+    Array< std::string > words_;
+  };
+
+  inline bool CommandLine::read(std::istream & in)
+  {
+    tokens_.clear();
+    if (!std::getline(in, line_))
+    {
+      return false;
+    }
+    size_t start = 0;
+    while (start < line_.length())
+    {
+      size_t space = line_.find(' ', start);
+      if (space == std::string::npos)
+      {
+        space = line_.length();
+      }
+      tokens_.push_back(Token{line_.data() + start, space - start});
+      start = space + 1;
+    }
+    while (words_.size() < tokens_.size())
+    {
+      words_.push_back(std::string());
+    }
+    return true;
+  }
+
+  inline bool CommandLine::empty() const noexcept
+  {
+    return tokens_.empty();
+  }
+
+  inline size_t CommandLine::size() const noexcept
+  {
+    return tokens_.size();
+  }
+
+  inline const Token & CommandLine::operator[](size_t i) const
+  {
+    return tokens_[i];
+  }
+
+  inline const std::string & CommandLine::str(size_t i)
+  {
+    words_[i].assign(tokens_[i].data, tokens_[i].size);
+    return words_[i];
+  }
+}
+
+#endif
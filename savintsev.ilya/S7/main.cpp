@@ -1,12 +1,13 @@
 #include <iostream>
 #include <fstream>
 #include <set>
-#include <vector>
+#include <deque>
 #include <string>
 #include <functional>
 #include <algorithm>
 #include <cstdlib>
 #include "cuckoo-hash-map.h"
+#include "command-line.hpp"
 #include <two-three-tree.h>
 
 namespace savintsev
@@ -17,26 +18,62 @@ namespace savintsev
     std::set< std::string > vertexes;
   };
 
-  HashMap< std::string, Graph > graphs;
+  // graphs never move once created, so a looked up Graph * stays valid for the whole session
+  class GraphStore
+  {
+  public:
+    bool empty() const noexcept
+    {
+      return graphs_.empty();
+    }
+
+    Graph * find(const std::string & name)
+    {
+      auto it = handles_.find(name);
+      return it == handles_.end() ? nullptr : it->second;
+    }
+
+    Graph & create(const std::string & name)
+    {
+      Graph * graph = find(name);
+      if (graph)
+      {
+        return *graph;
+      }
+      graphs_.emplace_back();
+      graph = std::addressof(graphs_.back());
+      handles_[name] = graph;
+      sorted_.insert({name, graph});
+      return *graph;
+    }
+
+    const TwoThreeTree< std::string, Graph * > & sorted() const noexcept
+    {
+      return sorted_;
+    }
+
+  private:
+    std::deque< Graph > graphs_;
+    HashMap< std::string, Graph * > handles_;
+    TwoThreeTree< std::string, Graph * > sorted_;
+  };
+
+  GraphStore graphs;
 
-  Array< std::string > split(const std::string & line)
+  void print_weights(const TwoThreeTree< std::string, Array< int > > & weights)
   {
-    Array< std::string > result;
-    size_t start = 0;
-    while (start < line.length())
+    for (auto it = weights.begin(); it != weights.end(); ++it)
     {
-      size_t space = line.find(' ', start);
-      if (space == std::string::npos)
+      std::cout << it->first;
+      for (Array< int >::iterator wt = it->second.begin(); wt != it->second.end(); ++wt)
       {
-        space = line.length();
+        std::cout << ' ' << *wt;
       }
-      result.push_back(line.substr(start, space - start));
-      start = space + 1;
+      std::cout << '\n';
     }
-    return result;
   }
 
-  void cmd_graphs()
+  void cmd_graphs(CommandLine &)
   {
     if (graphs.empty())
     {
@@ -44,19 +81,14 @@ namespace savintsev
       return;
     }
 
-    TwoThreeTree< std::string, Graph * > sorted;
-    for (auto it = graphs.begin(); it != graphs.end(); ++it)
-    {
-      sorted[it->first] = std::addressof(it->second);
-    }
-
+    const TwoThreeTree< std::string, Graph * > & sorted = graphs.sorted();
     for (auto it = sorted.begin(); it != sorted.end(); ++it)
     {
       std::cout << it->first << '\n';
     }
   }
 
-  void cmd_vertexes(const Array< std::string > & args)
+  void cmd_vertexes(CommandLine & args)
   {
     if (args.size() < 2)
     {
@@ -64,27 +96,26 @@ namespace savintsev
       return;
     }
 
-    const std::string & name = args[1];
-    if (graphs.find(name) == graphs.end())
+    Graph * graph = graphs.find(args.str(1));
+    if (!graph)
     {
       std::cout << "<INVALID COMMAND>\n";
       return;
     }
 
-    if (graphs[name].vertexes.empty())
+    if (graph->vertexes.empty())
     {
       std::cout << "\n";
       return;
     }
 
-    const std::set< std::string > & vertices = graphs[name].vertexes;
-    for (auto it = vertices.begin(); it != vertices.end(); ++it)
+    for (auto it = graph->vertexes.begin(); it != graph->vertexes.end(); ++it)
     {
       std::cout << *it << '\n';
     }
   }
 
-  void cmd_outbound(const Array< std::string > & args)
+  void cmd_outbound(CommandLine & args)
   {
     if (args.size() < 3)
     {
@@ -92,23 +123,24 @@ namespace savintsev
       return;
     }
 
-    const std::string & g = args[1];
-    const std::string & v = args[2];
+    Graph * graph = graphs.find(args.str(1));
+    const std::string & v = args.str(2);
 
-    if (graphs.find(g) == graphs.end() || graphs[g].vertexes.find(v) == graphs[g].vertexes.end())
+    if (!graph || graph->vertexes.find(v) == graph->vertexes.end())
     {
       std::cout << "<INVALID COMMAND>\n";
       return;
     }
 
     TwoThreeTree< std::string, Array< int > > out;
-    auto targets = graphs[g].edges.find(v);
-    if (targets != graphs[g].edges.end())
+    auto targets = graph->edges.find(v);
+    if (targets != graph->edges.end())
     {
       for (auto jt = targets->second.begin(); jt != targets->second.end(); ++jt)
       {
-        out[jt->first] = jt->second;
-        std::sort(out[jt->first].begin(), out[jt->first].end());
+        Array< int > & weights = out[jt->first];
+        weights = jt->second;
+        std::sort(weights.begin(), weights.end());
       }
     }
 
@@ -117,19 +149,10 @@ namespace savintsev
       std::cout << "\n";
       return;
     }
-
-    for (auto it = out.begin(); it != out.end(); ++it)
-    {
-      std::cout << it->first;
-      for (Array< int >::iterator wt = it->second.begin(); wt != it->second.end(); ++wt)
-      {
-        std::cout << ' ' << *wt;
-      }
-      std::cout << '\n';
-    }
+    print_weights(out);
   }
 
-  void cmd_inbound(const Array< std::string > & args)
+  void cmd_inbound(CommandLine & args)
   {
     if (args.size() < 3)
     {
@@ -137,38 +160,30 @@ namespace savintsev
       return;
     }
 
-    const std::string & g = args[1];
-    const std::string & v = args[2];
+    Graph * graph = graphs.find(args.str(1));
+    const std::string & v = args.str(2);
 
-    if (graphs.find(g) == graphs.end() || graphs[g].vertexes.find(v) == graphs[g].vertexes.end())
+    if (!graph || graph->vertexes.find(v) == graph->vertexes.end())
     {
       std::cout << "<INVALID COMMAND>\n";
       return;
     }
 
     TwoThreeTree< std::string, Array< int > > in;
-    for (auto it = graphs[g].edges.begin(); it != graphs[g].edges.end(); ++it)
+    for (auto it = graph->edges.begin(); it != graph->edges.end(); ++it)
     {
       auto jt = it->second.find(v);
       if (jt != it->second.end())
       {
-        in[it->first] = jt->second;
-        std::sort(in[it->first].begin(), in[it->first].end());
+        Array< int > & weights = in[it->first];
+        weights = jt->second;
+        std::sort(weights.begin(), weights.end());
       }
     }
-
-    for (auto it = in.begin(); it != in.end(); ++it)
-    {
-      std::cout << it->first;
-      for (Array< int >::iterator wt = it->second.begin(); wt != it->second.end(); ++wt)
-      {
-        std::cout << ' ' << *wt;
-      }
-      std::cout << '\n';
-    }
+    print_weights(in);
   }
 
-  void cmd_bind(const Array< std::string > & args)
+  void cmd_bind(CommandLine & args)
   {
     if (args.size() < 5)
     {
@@ -176,23 +191,23 @@ namespace savintsev
       return;
     }
 
-    const std::string & g = args[1];
-    if (graphs.find(g) == graphs.end())
+    Graph * graph = graphs.find(args.str(1));
+    if (!graph)
     {
       std::cout << "<INVALID COMMAND>\n";
       return;
     }
 
-    const std::string & a = args[2];
-    const std::string & b = args[3];
-    int w = atoi(args[4].c_str());
+    const std::string & a = args.str(2);
+    const std::string & b = args.str(3);
+    int w = atoi(args.str(4).c_str());
 
-    graphs[g].vertexes.insert(a);
-    graphs[g].vertexes.insert(b);
-    graphs[g].edges[a][b].push_back(w);
+    graph->vertexes.insert(a);
+    graph->vertexes.insert(b);
+    graph->edges[a][b].push_back(w);
   }
 
-  void cmd_cut(const Array< std::string > & args)
+  void cmd_cut(CommandLine & args)
   {
     if (args.size() < 5)
     {
@@ -200,20 +215,30 @@ namespace savintsev
       return;
     }
 
-    const std::string & g = args[1];
-    const std::string & a = args[2];
-    const std::string & b = args[3];
-    int w = atoi(args[4].c_str());
+    Graph * graph = graphs.find(args.str(1));
+    const std::string & a = args.str(2);
+    const std::string & b = args.str(3);
+    int w = atoi(args.str(4).c_str());
 
-    bool c1 = graphs.find(g) == graphs.end();
-    bool c2 = graphs[g].edges.find(a) == graphs[g].edges.end();
-    if (c1 || c2 || graphs[g].edges[a].find(b) == graphs[g].edges[a].end())
+    if (!graph)
+    {
+      std::cout << "<INVALID COMMAND>\n";
+      return;
+    }
+    auto from = graph->edges.find(a);
+    if (from == graph->edges.end())
+    {
+      std::cout << "<INVALID COMMAND>\n";
+      return;
+    }
+    auto to = from->second.find(b);
+    if (to == from->second.end())
     {
       std::cout << "<INVALID COMMAND>\n";
       return;
     }
 
-    Array< int > & weights = graphs[g].edges[a][b];
+    Array< int > & weights = to->second;
     Array< int >::iterator it = std::find(weights.begin(), weights.end(), w);
     if (it == weights.end())
     {
@@ -224,11 +249,11 @@ namespace savintsev
     weights.erase(it);
     if (weights.empty())
     {
-      graphs[g].edges[a].erase(b);
+      from->second.erase(b);
     }
   }
 
-  void cmd_create(const Array< std::string > & args)
+  void cmd_create(CommandLine & args)
   {
     if (args.size() < 2)
     {
@@ -236,23 +261,21 @@ namespace savintsev
       return;
     }
 
-    const std::string & g = args[1];
-    if (graphs.find(g) != graphs.end())
+    const std::string & g = args.str(1);
+    if (graphs.find(g))
     {
       std::cout << "<INVALID COMMAND>\n";
       return;
     }
 
-    Graph newg;
+    Graph & newg = graphs.create(g);
     for (size_t i = 3; i < args.size(); ++i)
     {
-      newg.vertexes.insert(args[i]);
+      newg.vertexes.insert(args.str(i));
     }
-    graphs[g] = newg;
   }
 
-
-  void cmd_merge(const Array< std::string > & args)
+  void cmd_merge(CommandLine & args)
   {
     if (args.size() < 4)
     {
@@ -260,40 +283,39 @@ namespace savintsev
       return;
     }
 
-    const std::string & newg = args[1];
-    const std::string & g1 = args[2];
-    const std::string & g2 = args[3];
+    const std::string & newg = args.str(1);
+    Graph * g1 = graphs.find(args.str(2));
+    Graph * g2 = graphs.find(args.str(3));
 
-    if (graphs.find(newg) != graphs.end() || graphs.find(g1) == graphs.end() || graphs.find(g2) == graphs.end())
+    if (graphs.find(newg) || !g1 || !g2)
     {
       std::cout << "<INVALID COMMAND>\n";
       return;
     }
 
     Graph g;
-    const std::string gs[2] = {g1, g2};
+    Graph * gs[2] = {g1, g2};
     for (size_t i = 0; i < 2; ++i)
     {
-      for (auto it = graphs[gs[i]].vertexes.begin(); it != graphs[gs[i]].vertexes.end(); ++it)
+      for (auto it = gs[i]->vertexes.begin(); it != gs[i]->vertexes.end(); ++it)
       {
         g.vertexes.insert(*it);
       }
 
-      for (auto et = graphs[gs[i]].edges.begin(); et != graphs[gs[i]].edges.end(); ++et)
+      for (auto et = gs[i]->edges.begin(); et != gs[i]->edges.end(); ++et)
       {
         for (auto jt = et->second.begin(); jt != et->second.end(); ++jt)
         {
-          auto t1 = et->first;
-          auto t2 = jt->first;
-          g.edges[t1][t2].insert(g.edges[t1][t2].end(), jt->second.begin(), jt->second.end());
+          Array< int > & weights = g.edges[et->first][jt->first];
+          weights.insert(weights.end(), jt->second.begin(), jt->second.end());
         }
       }
     }
 
-    graphs[newg] = g;
+    graphs.create(newg) = std::move(g);
   }
 
-  void cmd_extract(const Array< std::string > & args)
+  void cmd_extract(CommandLine & args)
   {
     if (args.size() < 5)
     {
@@ -301,11 +323,11 @@ namespace savintsev
       return;
     }
 
-    const std::string & newg = args[1];
-    const std::string & oldg = args[2];
-    size_t count = atoi(args[3].c_str());
+    const std::string & newg = args.str(1);
+    Graph * oldg = graphs.find(args.str(2));
+    size_t count = atoi(args.str(3).c_str());
 
-    if (graphs.find(newg) != graphs.end() || graphs.find(oldg) == graphs.end() || args.size() < 4 + count)
+    if (graphs.find(newg) || !oldg || args.size() < 4 + count)
     {
       std::cout << "<INVALID COMMAND>\n";
       return;
@@ -314,8 +336,8 @@ namespace savintsev
     Graph g;
     for (size_t i = 0; i < count; ++i)
     {
-      const std::string & vertex = args[4 + i];
-      if (graphs[oldg].vertexes.find(vertex) == graphs[oldg].vertexes.end())
+      const std::string & vertex = args.str(4 + i);
+      if (oldg->vertexes.find(vertex) == oldg->vertexes.end())
       {
         std::cout << "<INVALID COMMAND>\n";
         return;
@@ -325,19 +347,24 @@ namespace savintsev
 
     for (size_t i = 0; i < count; ++i)
     {
-      const std::string & src = args[4 + i];
+      const std::string & src = args.str(4 + i);
+      auto from = oldg->edges.find(src);
+      if (from == oldg->edges.end())
+      {
+        continue;
+      }
       for (size_t j = 0; j < count; ++j)
       {
-        const std::string & dst = args[4 + j];
-        bool c1 = graphs[oldg].edges.find(src) != graphs[oldg].edges.end();
-        if (c1 && graphs[oldg].edges[src].find(dst) != graphs[oldg].edges[src].end())
+        const std::string & dst = args.str(4 + j);
+        auto to = from->second.find(dst);
+        if (to != from->second.end())
         {
-          g.edges[src][dst] = graphs[oldg].edges[src][dst];
+          g.edges[src][dst] = to->second;
         }
       }
     }
 
-    graphs[newg] = g;
+    graphs.create(newg) = std::move(g);
   }
 }
 
@@ -358,50 +385,40 @@ int main(int argc, char* argv[])
 
   using namespace savintsev;
 
-  std::string line;
-  while (getline(file, line))
+  CommandLine header;
+  CommandLine edge;
+  while (header.read(file))
   {
-    if (line.empty())
-    {
-      continue;
-    }
-    Array< std::string > header = split(line);
     if (header.size() != 2)
     {
       continue;
     }
 
-    std::string name = header[0];
-    int count = atoi(header[1].c_str());
+    int count = atoi(header.str(1).c_str());
     Graph g;
 
     for (int i = 0; i < count; ++i)
     {
-      getline(file, line);
-      if (line.empty())
-      {
-        continue;
-      }
-      Array< std::string > e = split(line);
-      if (e.size() != 3)
+      if (!edge.read(file) || edge.size() != 3)
       {
         continue;
       }
 
-      std::string a = e[0], b = e[1];
-      int w = atoi(e[2].c_str());
+      const std::string & a = edge.str(0);
+      const std::string & b = edge.str(1);
+      int w = atoi(edge.str(2).c_str());
       g.vertexes.insert(a);
       g.vertexes.insert(b);
       g.edges[a][b].push_back(w);
     }
 
-    graphs[name] = g;
+    graphs.create(header.str(0)) = std::move(g);
   }
 
   using namespace std::placeholders;
 
-  savintsev::HashMap< std::string, std::function< void(const Array< std::string > &) > > cmd_map;
-  cmd_map["graphs"] = std::bind(cmd_graphs);
+  savintsev::HashMap< std::string, std::function< void(CommandLine &) > > cmd_map;
+  cmd_map["graphs"] = std::bind(cmd_graphs, _1);
   cmd_map["vertexes"] = std::bind(cmd_vertexes, _1);
   cmd_map["outbound"] = std::bind(cmd_outbound, _1);
   cmd_map["inbound"] = std::bind(cmd_inbound, _1);
@@ -411,26 +428,24 @@ int main(int argc, char* argv[])
   cmd_map["merge"] = std::bind(cmd_merge, _1);
   cmd_map["extract"] = std::bind(cmd_extract, _1);
 
-  std::string input;
-  while (getline(std::cin, input))
+  CommandLine args;
+  while (args.read(std::cin))
   {
-    if (input.empty())
+    if (args.empty())
     {
       continue;
     }
-    Array< std::string > args = split(input);
-    if (args.empty())
+
+    auto command = cmd_map.find(args.str(0));
+    if (command == cmd_map.end())
     {
+      std::cout << "<INVALID COMMAND>\n";
       continue;
     }
 
     try
     {
-      cmd_map.at(args[0])(args);
-    }
-    catch (const std::out_of_range &)
-    {
-      std::cout << "<INVALID COMMAND>\n";
+      command->second(args);
     }
     catch (...)
     {
@@ -0,0 +1,51 @@
+#include <boost/test/unit_test.hpp>
+#include <memory>
+#include <sstream>
+#include <string>
+#include "command-line.hpp"
+
+using namespace savintsev;
+
+BOOST_AUTO_TEST_CASE(cl_test_split)
+{
+  std::istringstream in("bind g a b 5\n\ncut  g a\nlast ");
+  CommandLine line;
+
+  BOOST_TEST(line.read(in));
+  BOOST_TEST(line.size() == 5);
+  BOOST_TEST(line.str(0) == "bind");
+  BOOST_TEST(line.str(4) == "5");
+  BOOST_TEST(line[2].size == 1);
+  BOOST_TEST(*line[2].data == 'a');
+
+  BOOST_TEST(line.read(in));
+  BOOST_TEST(line.empty());
+
+  BOOST_TEST(line.read(in));
+  BOOST_TEST(line.size() == 4);
+  BOOST_TEST(line.str(1) == "");
+  BOOST_TEST(line.str(2) == "g");
+
+  BOOST_TEST(line.read(in));
+  BOOST_TEST(line.size() == 1);
+  BOOST_TEST(line.str(0) == "last");
+
+  BOOST_TEST(!line.read(in));
+  BOOST_TEST(line.empty());
+}
+
+BOOST_AUTO_TEST_CASE(cl_test_words_are_kept)
+{
+  std::istringstream in("outbound graph vertex\nvertexes other\n");
+  CommandLine line;
+
+  BOOST_TEST(line.read(in));
+  const std::string & graph = line.str(1);
+  const std::string & vertex = line.str(2);
+  BOOST_TEST(graph == "graph");
+  BOOST_TEST(vertex == "vertex");
+
+  BOOST_TEST(line.read(in));
+  BOOST_TEST(line.str(1) == "other");
+  BOOST_TEST(std::addressof(line.str(1)) == std::addressof(graph));
+}
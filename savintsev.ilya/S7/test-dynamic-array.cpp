@@ -100,3 +100,19 @@ BOOST_AUTO_TEST_CASE(stress_test)
     BOOST_TEST(arr1[i] == i + 1);
   }
 }
+
+BOOST_AUTO_TEST_CASE(da_test_clear)
+{
+  Array< int > arr(2);
+  arr.push_back(1);
+  arr.push_back(2);
+  arr.pop_front();
+
+  arr.clear();
+  BOOST_TEST(arr.empty());
+
+  arr.push_back(3);
+  BOOST_TEST(arr.size() == 1);
+  BOOST_TEST(arr.front() == 3);
+  BOOST_TEST(arr[0] == 3);
+}
@@ -73,6 +73,7 @@ namespace savintsev
     void push_back(U && rhs);
     void pop_front() noexcept;
     void pop_back() noexcept;
+    void clear() noexcept;
 
     void swap(Array & x) noexcept;
 
@@ -315,6 +316,13 @@ namespace savintsev
     }
   }
 
+  template< typename T >
+  void Array< T >::clear() noexcept
+  {
+    size_ = 0;
+    start_ = 0;
+  }
+
   template< typename T >
   void Array< T >::pop_front() noexcept
   {
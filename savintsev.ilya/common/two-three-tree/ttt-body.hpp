@@ -83,8 +83,8 @@ namespace savintsev
     std::pair< iterator, bool > insert_node(node_type * target, const value_type & val);
 
     node_type * split_node(node_type * node);
-    void insert_data_in_node(node_type * node, const value_type & val);
-    void remove_data_from_node(node_type * node, const value_type & val);
+    template< typename V >
+    void insert_data_in_node(node_type * node, V && val);
     void remove_data_from_node(node_type * node, const key_type & k);
     node_type * clear_nodes(node_type * node);
     node_type * clone_nodes(node_type * other);
@@ -426,73 +426,29 @@ namespace savintsev
   }
 
   template< typename Key, typename Value, typename Compare >
-  void TwoThreeTree< Key, Value, Compare >::insert_data_in_node(node_type * node, const value_type & val)
+  template< typename V >
+  void TwoThreeTree< Key, Value, Compare >::insert_data_in_node(node_type * node, V && val)
   {
     assert(node->len < 3);
 
-    value_type tmp_data[3];
-    size_t tmp_len = node->len;
-
-    for (size_t i = 0; i < tmp_len; ++i)
-    {
-      tmp_data[i] = node->data[i];
-    }
-
-    tmp_data[tmp_len++] = val;
-
-    if (tmp_len == 2)
-    {
-      if (!Compare{}(tmp_data[0].first, tmp_data[1].first))
-      {
-        std::swap(tmp_data[0], tmp_data[1]);
-      }
-    }
-    else if (tmp_len == 3)
-    {
-      if (!Compare{}(tmp_data[0].first, tmp_data[1].first))
-      {
-        std::swap(tmp_data[0], tmp_data[1]);
-      }
-      if (!Compare{}(tmp_data[1].first, tmp_data[2].first))
-      {
-        std::swap(tmp_data[1], tmp_data[2]);
-      }
-      if (!Compare{}(tmp_data[0].first, tmp_data[1].first))
-      {
-        std::swap(tmp_data[0], tmp_data[1]);
-      }
-    }
-
-    for (size_t i = 0; i < tmp_len; ++i)
+    size_t pos = 0;
+    while (pos < node->len && Compare{}(node->data[pos].first, val.first))
     {
-      node->data[i] = std::move(tmp_data[i]);
+      ++pos;
     }
-    node->len = tmp_len;
-  }
-
-  template< typename Key, typename Value, typename Compare >
-  void TwoThreeTree< Key, Value, Compare >::remove_data_from_node(node_type * node, const value_type & val)
-  {
-    remove_data_from_node(node, val.first);
+    node->emplace(pos, std::forward< V >(val));
   }
 
   template< typename Key, typename Value, typename Compare >
   void TwoThreeTree< Key, Value, Compare >::remove_data_from_node(node_type * node, const key_type & k)
   {
-    if (node->len == 0)
-    {
-      return;
-    }
-    if (node->len >= 1 && node->data[0].first == k)
+    for (size_t i = 0; i < node->len; ++i)
     {
-      node->data[0] = node->data[1];
-      node->data[1] = node->data[2];
-      node->len--;
-    }
-    else if (node->len == 2 && node->data[1].first == k)
-    {
-      node->data[1] = node->data[2];
-      node->len--;
+      if (node->data[i].first == k)
+      {
+        node->erase(i);
+        return;
+      }
     }
   }
 
@@ -524,9 +480,8 @@ namespace savintsev
       root = new node_type{};
       for (size_t i = 0; i < other->len; ++i)
       {
-        root->data[i] = other->data[i];
+        root->emplace(i, other->data[i]);
       }
-      root->len = other->len;
       for (size_t i = 0; i < 3; ++i)
       {
         if (other->kids[i])
@@ -625,7 +580,7 @@ namespace savintsev
         parent->kids[0] = parent->kids[1];
         parent->kids[1] = parent->kids[2];
         parent->kids[2] = nullptr;
-        insert_data_in_node(parent->kids[0], parent->data[0]);
+        insert_data_in_node(parent->kids[0], std::move(parent->data[0]));
         parent->kids[0]->kids[2] = parent->kids[0]->kids[1];
         parent->kids[0]->kids[1] = parent->kids[0]->kids[0];
 
@@ -641,13 +596,13 @@ namespace savintsev
         {
           parent->kids[0]->kids[0]->father = parent->kids[0];
         }
-        remove_data_from_node(parent, parent->data[0]);
+        parent->erase(0);
         delete first;
       }
       else if (second == leaf)
       {
-        insert_data_in_node(first, parent->data[0]);
-        remove_data_from_node(parent, parent->data[0]);
+        insert_data_in_node(first, std::move(parent->data[0]));
+        parent->erase(0);
         if (leaf->kids[0])
         {
           first->kids[2] = leaf->kids[0];
@@ -667,9 +622,9 @@ namespace savintsev
       }
       else if (third == leaf)
       {
-        insert_data_in_node(second, parent->data[1]);
+        insert_data_in_node(second, std::move(parent->data[1]));
         parent->kids[2] = nullptr;
-        remove_data_from_node(parent, parent->data[1]);
+        parent->erase(1);
         if (leaf->kids[0])
         {
           second->kids[2] = leaf->kids[0];
@@ -695,11 +650,11 @@ namespace savintsev
           leaf->kids[0] = nullptr;
         }
 
-        insert_data_in_node(leaf, parent->data[1]);
+        insert_data_in_node(leaf, std::move(parent->data[1]));
         if (second->len == 2)
         {
-          parent->data[1] = second->data[1];
-          remove_data_from_node(second, second->data[1]);
+          parent->data[1] = std::move(second->data[1]);
+          second->erase(1);
           leaf->kids[0] = second->kids[2];
           second->kids[2] = nullptr;
           if (leaf->kids[0])
@@ -709,16 +664,16 @@ namespace savintsev
         }
         else if (first->len == 2)
         {
-          parent->data[1] = second->data[0];
+          parent->data[1] = std::move(second->data[0]);
           leaf->kids[0] = second->kids[1];
           second->kids[1] = second->kids[0];
           if (leaf->kids[0])
           {
             leaf->kids[0]->father = leaf;
           }
-          second->data[0] = parent->data[0];
-          parent->data[0] = first->data[1];
-          remove_data_from_node(first, first->data[1]);
+          second->data[0] = std::move(parent->data[0]);
+          parent->data[0] = std::move(first->data[1]);
+          first->erase(1);
           second->kids[0] = first->kids[2];
           if (second->kids[0])
           {
@@ -736,9 +691,9 @@ namespace savintsev
             leaf->kids[0] = leaf->kids[1];
             leaf->kids[1] = nullptr;
           }
-          insert_data_in_node(second, parent->data[1]);
-          parent->data[1] = third->data[0];
-          remove_data_from_node(third, third->data[0]);
+          insert_data_in_node(second, std::move(parent->data[1]));
+          parent->data[1] = std::move(third->data[0]);
+          third->erase(0);
           second->kids[1] = third->kids[0];
           if (second->kids[1])
           {
@@ -755,9 +710,9 @@ namespace savintsev
             leaf->kids[1] = leaf->kids[0];
             leaf->kids[0] = nullptr;
           }
-          insert_data_in_node(second, parent->data[0]);
-          parent->data[0] = first->data[1];
-          remove_data_from_node(first, first->data[1]);
+          insert_data_in_node(second, std::move(parent->data[0]));
+          parent->data[0] = std::move(first->data[1]);
+          first->erase(1);
           second->kids[0] = first->kids[2];
           if (second->kids[0])
           {
@@ -773,11 +728,11 @@ namespace savintsev
           leaf->kids[0] = leaf->kids[1];
           leaf->kids[1] = nullptr;
         }
-        insert_data_in_node(first, parent->data[0]);
+        insert_data_in_node(first, std::move(parent->data[0]));
         if (second->len == 2)
         {
-          parent->data[0] = second->data[0];
-          remove_data_from_node(second, second->data[0]);
+          parent->data[0] = std::move(second->data[0]);
+          second->erase(0);
           first->kids[1] = second->kids[0];
           if (first->kids[1])
           {
@@ -789,10 +744,10 @@ namespace savintsev
         }
         else if (third->len == 2)
         {
-          parent->data[0] = second->data[0];
-          second->data[0] = parent->data[1];
-          parent->data[1] = third->data[0];
-          remove_data_from_node(third, third->data[0]);
+          parent->data[0] = std::move(second->data[0]);
+          second->data[0] = std::move(parent->data[1]);
+          parent->data[1] = std::move(third->data[0]);
+          third->erase(0);
           first->kids[1] = second->kids[0];
           if (first->kids[1])
           {
@@ -812,12 +767,12 @@ namespace savintsev
     }
     else if (parent->len == 1)
     {
-      insert_data_in_node(leaf, parent->data[0]);
+      insert_data_in_node(leaf, std::move(parent->data[0]));
 
       if (first == leaf && second->len == 2)
       {
-        parent->data[0] = second->data[0];
-        remove_data_from_node(second, second->data[0]);
+        parent->data[0] = std::move(second->data[0]);
+        second->erase(0);
 
         if (leaf->kids[0] == nullptr)
         {
@@ -834,8 +789,8 @@ namespace savintsev
       }
       else if (second == leaf && first->len == 2)
       {
-        parent->data[0] = first->data[1];
-        remove_data_from_node(first, first->data[1]);
+        parent->data[0] = std::move(first->data[1]);
+        first->erase(1);
 
         if (leaf->kids[1] == nullptr)
         {
@@ -859,7 +814,7 @@ namespace savintsev
 
     if (parent->kids[0] == leaf)
     {
-      insert_data_in_node(parent->kids[1], parent->data[0]);
+      insert_data_in_node(parent->kids[1], std::move(parent->data[0]));
       parent->kids[1]->kids[2] = parent->kids[1]->kids[1];
       parent->kids[1]->kids[1] = parent->kids[1]->kids[0];
 
@@ -875,13 +830,13 @@ namespace savintsev
       {
         parent->kids[1]->kids[0]->father = parent->kids[1];
       }
-      remove_data_from_node(parent, parent->data[0]);
+      parent->erase(0);
       delete parent->kids[0];
       parent->kids[0] = nullptr;
     }
     else if (parent->kids[1] == leaf)
     {
-      insert_data_in_node(parent->kids[0], parent->data[0]);
+      insert_data_in_node(parent->kids[0], std::move(parent->data[0]));
 
       if (leaf->kids[0])
       {
@@ -896,7 +851,7 @@ namespace savintsev
       {
         parent->kids[0]->kids[2]->father = parent->kids[0];
       }
-      remove_data_from_node(parent, parent->data[0]);
+      parent->erase(0);
       delete parent->kids[1];
       parent->kids[1] = nullptr;
     }
@@ -1045,14 +1000,15 @@ namespace savintsev
       }
     }
 
-    insert_data_in_node(left, node->data[0]);
+    left->emplace(0, std::move(node->data[0]));
     try
     {
-      insert_data_in_node(right, node->data[2]);
+      right->emplace(0, std::move(node->data[2]));
     }
     catch (...)
     {
-      remove_data_from_node(left, node->data[0]);
+      node->data[0] = std::move(left->data[0]);
+      left->erase(0);
       throw;
     }
 
@@ -1062,7 +1018,7 @@ namespace savintsev
       {
         node_type * parent = node->father;
 
-        insert_data_in_node(parent, node->data[1]);
+        insert_data_in_node(parent, std::move(node->data[1]));
 
         if (parent->kids[0] == node)
         {
@@ -1090,19 +1046,22 @@ namespace savintsev
       {
         left->father = node;
         right->father = node;
-        node->data[0] = node->data[1];
+        node->data[0] = std::move(node->data[1]);
+        node->erase(2);
+        node->erase(1);
         node->kids[0] = left;
         node->kids[1] = right;
         node->kids[2] = nullptr;
         node->kids[3] = nullptr;
-        node->len = 1;
         return node;
       }
     }
     catch (...)
     {
-      remove_data_from_node(left, node->data[0]);
-      remove_data_from_node(right, node->data[2]);
+      node->data[0] = std::move(left->data[0]);
+      node->data[2] = std::move(right->data[0]);
+      left->erase(0);
+      right->erase(0);
       throw;
     }
   }
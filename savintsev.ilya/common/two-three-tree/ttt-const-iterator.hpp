@@ -145,7 +145,7 @@ namespace savintsev
       return *this;
     }
 
-    if (pos_ < node_->len - 1)
+    if (pos_ + 1 < node_->len)
     {
       ++pos_;
       return *this;
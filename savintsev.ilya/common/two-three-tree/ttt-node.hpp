@@ -1,19 +1,104 @@
 #ifndef TTT_NODE_H
 #define TTT_NODE_H
 #include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
 
 namespace savintsev
 {
+  template< typename T, size_t N >
+  struct raw_array_t
+  {
+    alignas(T) unsigned char raw[N * sizeof(T)];
+
+    T & operator[](size_t i) noexcept
+    {
+      return reinterpret_cast< T * >(raw)[i];
+    }
+    const T & operator[](size_t i) const noexcept
+    {
+      return reinterpret_cast< const T * >(raw)[i];
+    }
+  };
+
   template< typename T >
   struct node_t
   {
-    T data[3];
+    node_t * kids[4];
+    node_t * father;
+    unsigned char len;
 
-    node_t * kids[4] = {nullptr, nullptr, nullptr, nullptr};
-    node_t * father = nullptr;
+    raw_array_t< T, 3 > data;
 
-    size_t len = 0;
+    node_t() noexcept;
+    node_t(const node_t &) = delete;
+    ~node_t();
+    node_t & operator=(const node_t &) = delete;
+
+    template< typename... Args >
+    void emplace(size_t pos, Args &&... args);
+    void erase(size_t pos) noexcept;
   };
+
+  template< typename T >
+  node_t< T >::node_t() noexcept:
+    kids{nullptr, nullptr, nullptr, nullptr},
+    father(nullptr),
+    len(0)
+  {}
+
+  template< typename T >
+  node_t< T >::~node_t()
+  {
+    for (size_t i = 0; i < len; ++i)
+    {
+      data[i].~T();
+    }
+  }
+
+  template< typename T >
+  template< typename... Args >
+  void node_t< T >::emplace(size_t pos, Args &&... args)
+  {
+    if (pos == len)
+    {
+      new (std::addressof(data[pos])) T(std::forward< Args >(args)...);
+      ++len;
+      return;
+    }
+    new (std::addressof(data[len])) T(std::move(data[len - 1]));
+    for (size_t i = len - 1; i > pos; --i)
+    {
+      data[i] = std::move(data[i - 1]);
+    }
+    data[pos].~T();
+    try
+    {
+      new (std::addressof(data[pos])) T(std::forward< Args >(args)...);
+    }
+    catch (...)
+    {
+      new (std::addressof(data[pos])) T(std::move(data[pos + 1]));
+      for (size_t i = pos + 1; i < len; ++i)
+      {
+        data[i] = std::move(data[i + 1]);
+      }
+      data[len].~T();
+      throw;
+    }
+    ++len;
+  }
+
+  template< typename T >
+  void node_t< T >::erase(size_t pos) noexcept
+  {
+    for (size_t i = pos + 1; i < len; ++i)
+    {
+      data[i - 1] = std::move(data[i]);
+    }
+    data[--len].~T();
+  }
 }
 
 #endif